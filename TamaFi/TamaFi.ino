@@ -8,6 +8,7 @@
 
 #include "pet_logic.h"
 #include "sound.h"
+#include "sound_es8311.h"
 #include "wifi_service.h"
 #include "persistence.h"
 #include "navigation.h"
@@ -15,6 +16,13 @@
 #include "display_amoled.h"
 #include "ui.h"
 #include "battery.h"
+#include "power_guard.h"
+#include "i2c_bus.h"
+#include "energy.h"
+#include "input_latency.h"
+#include "mic.h"
+#include "cpu_governor.h"
+#include "device_config.h"
 
 HWCDC USBSerial;
 #define DBG(x) do { Serial.println(x); USBSerial.println(x); } while(0)
@@ -22,12 +30,229 @@ HWCDC USBSerial;
 // ============ Pet state (owned by orchestrator) ============
 
 PetState petState;
+EnergyModel energyModel;
+InputLatency inputLatency;       // input -> flushed frame (SysInfo "Lag", [latency] on serial)
 
 // ============ Timers ============
 
 static unsigned long lastLogicTick    = 0;
 static unsigned long lastSaveTime     = 0;
-static unsigned long lastBatteryPoll  = 0;
+static unsigned long lastDiagReport   = 0;
+
+static bool micReady = false;
+
+// ============ Power guard: low battery / power key ============
+
+static PowerGuard powerGuard;
+
+// Bounded save first, then everything that draws current goes to its lowest state.
+static void enterPowerEmergency() {
+    unsigned long t0 = millis();
+    saveState(petState);
+    bool saved = persistFlush(POWER_EMERGENCY_SAVE_MS);
+
+    soundStopAll();
+    soundSetVolume(0);
+    wifiSetSuspended(true);
+    displaySleep();
+
+    DBG(String("[power] emergency save ") + (saved ? "ok" : "timeout") + " in " + (millis() - t0) + " ms");
+}
+
+static void leavePowerEmergency() {
+    wifiSetSuspended(false);
+    displayWake(tftBrightnessIndex);
+    soundSetVolume(soundVolume);
+    inputResetActivity();
+    DBG("[power] external power back, resuming");
+}
+
+static void processPowerEvents(unsigned long now) {
+    uint32_t events = batteryTakeEvents(now);
+    switch (powerGuardStep(powerGuard, events, batteryGetInfo().usbConnected)) {
+        case PWR_ACT_SAVE:      saveStateIfChanged(petState); break;
+        case PWR_ACT_EMERGENCY: enterPowerEmergency();        break;
+        case PWR_ACT_RESUME:    leavePowerEmergency();        break;
+        default: break;
+    }
+}
+
+// ============ Energy accounting ============
+
+static uint32_t      energyLastUs      = 0;
+static uint32_t      energyWorkUs      = 0;   // CPU work measured in this loop pass
+static uint32_t      energyFlushSeen   = 0;
+static unsigned long energyBatterySeen = 0;
+
+static void accountEnergy() {
+    uint32_t nowUs   = micros();
+    uint32_t flushes = displayFlushCount();
+
+    EnergyInputs in;
+    in.elapsedUs  = nowUs - energyLastUs;
+    in.cpuWorkUs  = energyWorkUs;
+    in.cpuSleepUs = 0;                        // no light sleep yet
+    in.brightness = displayIsAsleep() ? -1 : (int8_t)tftBrightnessIndex;
+    in.radio      = wifiRadioState();
+    in.audio      = soundIsActive();
+    in.flushes    = (uint16_t)(flushes - energyFlushSeen);
+    energyAccount(energyModel, in);
+
+    energyLastUs    = nowUs;
+    energyWorkUs    = 0;
+    energyFlushSeen = flushes;
+
+    const BatteryInfo &bat = batteryGetInfo();
+    if (bat.updatedMs != energyBatterySeen) {
+        energyBatterySeen = bat.updatedMs;
+        bool discharging  = bat.batteryConnected && !bat.usbConnected && !bat.charging;
+        energyReconcile(energyModel, bat.batteryConnected ? bat.percent : -1, bat.voltage, discharging);
+    }
+}
+
+static float pctOf(uint64_t part, uint64_t whole) {
+    return whole ? (float)part * 100.0f / (float)whole : 0.0f;
+}
+
+static void reportEnergy() {
+    const EnergyModel &m = energyModel;
+    uint64_t total = energyTotalNas(m);
+    float    mah   = (float)total / 3.6e9f;
+    float    volts = (m.mv ? m.mv : 3700) / 1000.0f;
+
+    int32_t left = energyProjectedMin(m, batteryGetInfo().batteryConnected ? batteryGetInfo().percent : -1);
+    USBSerial.printf("[energy] %.2f mAh / %.2f mWh in %lu s, avg %.1f mA, cal %.2f (%u), left %ld min\n",
+                     mah, mah * volts, (unsigned long)(m.totalUs / 1000000ULL), m.avgMa,
+                     m.calib, m.calibCount, (long)left);
+    for (int r = 0; r < ENERGY_RAIL_COUNT; r++) {
+        USBSerial.printf("[energy]   %-8s %7.2f mAh  %5.1f%%\n", energyRailName(r),
+                         (float)m.railNas[r] / 3.6e9f, pctOf(m.railNas[r], total));
+    }
+    USBSerial.printf("[energy]   display off %.0f%% low %.0f%% mid %.0f%% high %.0f%%, %lu flushes\n",
+                     pctOf(m.displayUs[0], m.totalUs), pctOf(m.displayUs[1], m.totalUs),
+                     pctOf(m.displayUs[2], m.totalUs), pctOf(m.displayUs[3], m.totalUs),
+                     (unsigned long)m.flushes);
+    USBSerial.printf("[energy]   radio off %.1f%% scan %.1f%% grace %.1f%% listen %.1f%%, audio %.1f%%\n",
+                     pctOf(m.radioUs[RADIO_OFF], m.totalUs), pctOf(m.radioUs[RADIO_SCANNING], m.totalUs),
+                     pctOf(m.radioUs[RADIO_GRACE], m.totalUs), pctOf(m.radioUs[RADIO_LISTEN], m.totalUs),
+                     pctOf(m.audioUs, m.totalUs));
+    USBSerial.printf("[energy]   cpu work %.1f%% poll %.1f%% sleep %.1f%%\n",
+                     pctOf(m.cpuUs[ENERGY_CPU_WORK], m.totalUs), pctOf(m.cpuUs[ENERGY_CPU_POLL], m.totalUs),
+                     pctOf(m.cpuUs[ENERGY_CPU_SLEEP], m.totalUs));
+}
+
+// ============ CPU clock ============
+
+static Governor cpuGovernor;
+static uint32_t lastFrameUs = 0;    // draw + flush of the previous frame
+
+static bool screenAnimated(Screen s) {
+    return s == SCREEN_BOOT || s == SCREEN_HATCH || s == SCREEN_HOME;
+}
+
+// Runs before the frame so a heavy draw + flush already gets the higher clock.
+static void governCpu(bool userInput, unsigned long now) {
+    GovernorInputs in;
+    in.asleep   = displayIsAsleep();
+    in.animated = screenAnimated(currentScreen);
+    in.scanning = wifiRadioState() == RADIO_SCANNING;
+    in.input    = userInput;
+    in.frameUs  = lastFrameUs;
+
+    uint8_t prev = cpuGovernor.level;
+    if (governorStep(cpuGovernor, in, now) != prev) {
+        setCpuFrequencyMhz(GOV_MHZ[cpuGovernor.level]);
+    }
+}
+
+static void reportGovernor() {
+    uint32_t res[GOV_LEVELS], switches, total = 0;
+    governorTakeResidency(cpuGovernor, res, switches);
+    for (int i = 0; i < GOV_LEVELS; i++) total += res[i];
+    if (!total) return;
+
+    USBSerial.printf("[cpu] ");
+    for (int i = 0; i < GOV_LEVELS; i++) {
+        USBSerial.printf("%u MHz %lu%%  ", GOV_MHZ[i], (unsigned long)((uint64_t)res[i] * 100 / total));
+    }
+    USBSerial.printf("(%lu switches)\n", (unsigned long)switches);
+}
+
+// ============ Diagnostics ============
+
+static void reportSound() {
+    if (!soundEs8311Available()) return;
+    SoundStats st;
+    soundEs8311TakeStats(st);
+    USBSerial.printf("[audio] underruns %lu, ring %lu/%lu (min %lu while playing), dropped msgs %lu\n",
+                     (unsigned long)st.underruns, (unsigned long)st.fill, (unsigned long)st.capacity,
+                     (unsigned long)st.minFill, (unsigned long)st.dropped);
+    USBSerial.printf("[audio] voices %lu/%d, stolen %lu, refused %lu\n", (unsigned long)st.voices, MIX_VOICES,
+                     (unsigned long)st.steals, (unsigned long)st.voiceDrops);
+}
+
+static void reportMic() {
+    MicStats st;
+    micTakeStats(st);
+    if (!st.frames && !st.heldFrames) return;
+    USBSerial.printf("[mic] %lu frames (+%lu held), overruns %lu, floor rms %u, dsp %lu us per s of audio\n",
+                     (unsigned long)st.frames, (unsigned long)st.heldFrames, (unsigned long)st.overruns,
+                     st.floorRms, (unsigned long)(st.audioMs ? (uint64_t)st.dspUs * 1000 / st.audioMs : 0));
+    USBSerial.printf("[mic] clap %u, whistle %u, loud %u\n", st.events[0], st.events[1], st.events[2]);
+}
+
+static void reportInput() {
+    InputStats st;
+    inputTakeStats(st);
+    if (!st.events && !st.irqs) return;
+    USBSerial.printf("[input] %lu events, dropped %lu, touch irqs %lu -> %lu reads, irq overruns %lu\n",
+                     (unsigned long)st.events, (unsigned long)st.dropped, (unsigned long)st.irqs,
+                     (unsigned long)st.reads, (unsigned long)st.irqOverruns);
+    if (!st.events) return;
+    USBSerial.printf("[input] capture->queue avg %lu max %lu ms, queue->consume avg %lu max %lu ms\n",
+                     (unsigned long)(st.recogSumMs / st.events), (unsigned long)st.recogMaxMs,
+                     (unsigned long)(st.queueSumMs / st.events), (unsigned long)st.queueMaxMs);
+}
+
+static void reportLatency() {
+    static uint32_t lastCount = 0;
+    const InputLatency &l = inputLatency;
+    if (l.count == lastCount) return;
+    lastCount = l.count;
+
+    USBSerial.printf("[latency] input->flush since boot: %lu events, avg %lu ms, max %lu ms, lost %lu\n",
+                     (unsigned long)l.count, (unsigned long)(l.sumUs / l.count / 1000),
+                     (unsigned long)(l.maxUs / 1000), (unsigned long)l.lost);
+    USBSerial.print("[latency]  ");
+    for (int b = 0; b < LAT_BUCKETS; b++) {
+        if (b < LAT_BUCKETS - 1) USBSerial.printf(" <%u:%lu", LAT_BUCKET_MS[b], (unsigned long)l.hist[b]);
+        else                     USBSerial.printf(" >=%u:%lu\n", LAT_BUCKET_MS[b - 1], (unsigned long)l.hist[b]);
+    }
+    for (int s = 0; s < LAT_STAGES; s++) {
+        USBSerial.printf("[latency]   %-9s avg %6lu us  max %7lu us\n", latencyStageName(s),
+                         (unsigned long)(l.stageSumUs[s] / l.count), (unsigned long)l.stageMaxUs[s]);
+    }
+}
+
+static void reportI2cBus() {
+    I2cBusStats st;
+    i2cBusTakeStats(st);
+    if (st.windowUs == 0) return;
+    batteryNoteI2cWindow(st.dev[I2C_DEV_PMIC].txns, st.windowUs);   // SysInfo "I2C: N/min"
+
+    uint32_t busy = 0;
+    for (int d = 0; d < I2C_DEV_COUNT; d++) busy += st.dev[d].busyUs;
+    USBSerial.printf("[i2c] util %lu.%lu%%, merged %lu\n",
+                     (unsigned long)(busy * 100ULL / st.windowUs),
+                     (unsigned long)(busy * 1000ULL / st.windowUs % 10),
+                     (unsigned long)st.merged);
+    for (int d = 0; d < I2C_DEV_COUNT; d++) {
+        const I2cDevStats &ds = st.dev[d];
+        if (!ds.txns) continue;
+        USBSerial.printf("[i2c]   %-8s %5lu txn  busy %6lu us  worst wait %5lu us\n", i2cDevName(d),
+                         (unsigned long)ds.txns, (unsigned long)ds.busyUs, (unsigned long)ds.maxWaitUs);
+    }
+}
 
 // ============ Event mapping: PetEvent -> sound / indicators ============
 
@@ -50,8 +275,13 @@ static void processPetEvents() {
                 setIndicatorState(INDICATOR_WIFI);
                 break;
 
-            case PET_EVT_EVOLUTION:
+            case PET_EVT_NEW_PLACE:
                 sndDiscover();
+                setIndicatorState(INDICATOR_WIFI);
+                break;
+
+            case PET_EVT_EVOLUTION:
+                sndEvolve();
                 break;
 
             case PET_EVT_REST_START:
@@ -74,6 +304,14 @@ static void processPetEvents() {
                 setIndicatorState(INDICATOR_SAD);
                 break;
 
+            case PET_EVT_STARTLED:
+                setIndicatorState(INDICATOR_SAD);
+                break;
+
+            case PET_EVT_CALLED:
+                setIndicatorState(INDICATOR_HAPPY);
+                break;
+
             case PET_EVT_ACTIVITY_END:
                 setIndicatorState(INDICATOR_OFF);
                 break;
@@ -84,6 +322,54 @@ static void processPetEvents() {
     }
 }
 
+// ============ Ambient music: mood picks the song, stage the tempo ============
+
+static uint8_t       musicPending      = MUSIC_NONE;
+static unsigned long musicPendingSince = 0;
+static uint8_t       musicMood         = MUSIC_NONE;
+
+static uint8_t musicThemeFor(Mood mood) {
+    switch (mood) {
+        case MOOD_HAPPY:
+        case MOOD_EXCITED: return MUSIC_BRIGHT;
+        case MOOD_HUNGRY:
+        case MOOD_BORED:
+        case MOOD_SICK:    return MUSIC_GLOOMY;
+        default:           return MUSIC_CALM;
+    }
+}
+
+static uint16_t musicTempoFor(Stage stage) {
+    switch (stage) {
+        case STAGE_BABY:  return 115;
+        case STAGE_TEEN:  return 105;
+        case STAGE_ELDER: return 85;
+        default:          return 100;
+    }
+}
+
+// Home screen only, pet awake. A new mood must hold MUSIC_SWITCH_MS before the
+// song changes, so a flickering mood does not restart music every tick.
+static void updateMusic(unsigned long now) {
+    bool on = AMBIENT_MUSIC && !displayIsAsleep() && !powerGuard.emergency &&
+              currentScreen == SCREEN_HOME && petState.restPhase == REST_NONE;
+    if (!on) {
+        sndMusic(MUSIC_NONE, 0);
+        musicMood = MUSIC_NONE;
+        return;
+    }
+
+    uint8_t want = musicThemeFor(petState.mood);
+    if (want != musicPending) {
+        musicPending      = want;
+        musicPendingSince = now;
+    }
+    if (musicMood == MUSIC_NONE || (want != musicMood && now - musicPendingSince >= MUSIC_SWITCH_MS)) {
+        musicMood = want;
+    }
+    sndMusic(musicMood, musicTempoFor(petState.stage));
+}
+
 // ============ setup ============
 
 void setup() {
@@ -97,11 +383,14 @@ void setup() {
     // Hardware init
     inputInit();
     DBG(inputTouchInited() ? "[input] FT3168 OK" : "[input] FT3168 init fail");
+    i2cBusInit();          // Wire is up; every later bus user goes through the arbiter
 
     displayAmoledInit();
 
     if (soundInit()) {
         DBG("[sound] ES8311 OK");
+        micReady = MIC_DETECT && micInit();
+        DBG(micReady ? "[mic] capture OK" : "[mic] off");
     } else {
         DBG("[sound] ES8311 fail, PWM fallback");
     }
@@ -112,6 +401,13 @@ void setup() {
     batteryInit();
     DBG(batteryGetInfo().available ? "[battery] AXP2101 OK" : "[battery] AXP2101 not found");
 
+    powerGuardInit(powerGuard);
+    energyInit(energyModel, ENERGY_TABLE_DEFAULT);
+    latencyInit(inputLatency);
+    governorInit(cpuGovernor, GOV_LEVELS - 1, millis());     // boot at full clock
+    setCpuFrequencyMhz(GOV_MHZ[cpuGovernor.level]);
+    energyLastUs = micros();
+
     // Pet state init
     unsigned long now = millis();
     petInit(petState, now);
@@ -119,6 +415,10 @@ void setup() {
     // Load saved state (overwrites petInit defaults if save exists)
     persistenceInit();
     loadState(petState);
+    loadPlaces();
+    DBG(String("[persist] loaded from ") + persistSourceText(persistStats().loadSource) +
+        " v" + persistStats().loadedVersion + " in " + persistStats().loadUs + " us");
+    wifiSetPassive(wifiPassive);
 
     // Navigation init
     navInit();
@@ -137,22 +437,39 @@ void setup() {
 void loop() {
     unsigned long now = millis();
 
-    // 1. Sound: feed I2S buffer + advance sequencer
-    for (int i = 0; i < 4 && soundFeed(); i++) {}
+    // 1. Sound: ES8311 renders in its own task; here only the PWM buzzer fallback
     sndUpdate();
     stopBuzzerIfNeeded();
 
-    // 2. Input: poll touch/buttons
+    // 2. Input: poll touch/buttons. R1 (OK double tap) only means something on
+    // Home / Pet Status; elsewhere OK fires on release without the 200 ms wait
+    inputSetDoubleTapEnabled(currentScreen == SCREEN_HOME || currentScreen == SCREEN_PET_STATUS);
     inputPoll();
-    InputButton event = inputConsumeEvent();
+    InputEvent  input;
+    InputButton event      = INPUT_NONE;
+    uint32_t    consumedUs = 0;
+    if (inputConsume(input)) {
+        event      = input.button;
+        consumedUs = micros();
+    }
+
+    // 2b. Microphone: a clap or loud noise startles the pet, a whistle calls it
+    if (micReady) {
+        micSetEnabled(!displayIsAsleep() && !powerGuard.emergency);
+        uint8_t heard = micPoll(now);
+        if (heard & (SOUND_EVT_CLAP | SOUND_EVT_LOUD)) petSendCommand(petState, PET_CMD_STARTLE);
+        else if (heard & SOUND_EVT_WHISTLE)            petSendCommand(petState, PET_CMD_WAKE);
+    }
 
     // 3. AutoSleep: BOOT toggles sleep; touch ignored while asleep; idle timeout
     if (event == INPUT_BOOT) {
         if (displayIsAsleep()) {
-            // Пробуждение по BOOT
-            displayWake(tftBrightnessIndex);
-            soundSetVolume(soundVolume);       // восстановить звук
-            inputResetActivity();
+            // Пробуждение по BOOT (power emergency: stays off until USB is back)
+            if (!powerGuard.emergency) {
+                displayWake(tftBrightnessIndex);
+                soundSetVolume(soundVolume);   // восстановить звук
+                inputResetActivity();
+            }
         } else {
             // Принудительный сон по BOOT
             soundStopAll();
@@ -172,9 +489,10 @@ void loop() {
         displaySleep();
     }
 
-    // 4. Navigation: handle input
+    // 4. Navigation: handle input; latency runs until the next flushed frame
     if (event != INPUT_NONE) {
         navHandleInput(event, petState);
+        latencyEvent(inputLatency, input.tMs * 1000u, input.queuedMs * 1000u, consumedUs, micros());
     }
 
     // 5. Pet logic tick (~100 ms)
@@ -187,28 +505,61 @@ void loop() {
         }
     }
 
-    // 6. Check WiFi scan completion -> inject into pet
+    // 6. Check WiFi scan completion -> inject into pet; radio power-down after grace
     if (wifiCheckScanDone()) {
-        petInjectWifiResult(petState, wifiStats, now);
+        petInjectWifiResult(petState, wifiStats, wifiEnv.smooth, now);
+        petInjectPlace(petState, wifiPlace.kind, now);
+    }
+    wifiUpdate(now);
+    if (wifiCheckAmbientUpdate()) {
+        petInjectWifiEnv(petState, wifiEnv.smooth);
     }
 
-    // 7. Process pet events -> sound / indicators
+    // 7. Process pet events -> sound / indicators; background music follows mood
     processPetEvents();
+    updateMusic(now);
 
-    // 8. Battery poll (~5 s)
-    if (now - lastBatteryPoll >= 5000) {
-        lastBatteryPoll = now;
-        batteryUpdate();
-    }
+    // 8. Battery: PMIC events (low battery, power key, USB), then cached model refresh
+    processPowerEvents(now);
+    batteryUpdate(now);
 
     // 9. Autosave
     if (now - lastSaveTime >= autoSaveMs) {
         lastSaveTime = now;
-        saveState(petState);
+        saveStateIfChanged(petState);
+        savePlaces(now);
+    }
+    persistUpdate(petState, now);
+
+    // 10. Diagnostics over USBSerial (60 s)
+    if (now - lastDiagReport >= 60000) {
+        lastDiagReport = now;
+        reportI2cBus();
+        reportEnergy();
+        reportGovernor();
+        reportSound();
+        reportMic();
+        reportInput();
+        reportLatency();
     }
 
-    // 10. Draw UI (skip when display is asleep — save CPU)
+    // 11. CPU clock for this frame, then draw UI (skip when display is asleep — save CPU)
+    governCpu(event != INPUT_NONE, now);
     if (!displayIsAsleep()) {
+        uint32_t workStart = micros();
+        uint32_t flushes   = displayFlushCount();
         uiDrawScreen(currentScreen, mainMenuIndex, settingsMenuIndex);
+        lastFrameUs   = micros() - workStart;
+        if (displayFlushCount() != flushes) {
+            uint32_t flushUs, doneUs;
+            displayLastFlushUs(flushUs, doneUs);
+            latencyFrame(inputLatency, workStart, flushUs, doneUs);
+        }
+        energyWorkUs += lastFrameUs;
+    } else {
+        lastFrameUs = 0;
     }
+
+    // 12. Energy accounting for this pass
+    accountEnergy();
 }
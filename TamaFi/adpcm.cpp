@@ -0,0 +1,86 @@
+#include "adpcm.h"
+
+// ============ IMA step tables ============
+
+static const int16_t STEP[89] = {
+        7,     8,     9,    10,    11,    12,    13,    14,    16,    17,
+       19,    21,    23,    25,    28,    31,    34,    37,    41,    45,
+       50,    55,    60,    66,    73,    80,    88,    97,   107,   118,
+      130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
+      337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
+      876,   963,  1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+     2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
+     5894,  6484,  7132,  7845,  8630,  9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static const int8_t INDEX_ADJ[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+// ============ Decoder ============
+
+void adpcmStart(AdpcmStream &s, const AdpcmClip *clip) {
+    s.clip  = clip;
+    s.pos   = 0;
+    s.byte  = 0;
+    s.left  = 0;
+    s.pred  = 0;
+    s.index = 0;
+    s.hi    = false;
+}
+
+int adpcmDecode(AdpcmStream &s, int16_t *out, int n) {
+    if (!adpcmActive(s)) return 0;
+    const AdpcmClip &c   = *s.clip;
+    const uint8_t   *src = c.data;
+
+    uint32_t avail = c.samples - s.pos;
+    if ((uint32_t)n > avail) n = (int)avail;
+
+    // Locals in registers for the inner loop, written back once
+    int32_t  pred  = s.pred;
+    int      index = s.index;
+    uint32_t byte  = s.byte;
+    uint32_t left  = s.left;
+    bool     hi    = s.hi;
+
+    for (int i = 0; i < n; i++) {
+        if (left == 0) {
+            // Block header: exact first sample + step index
+            if (byte + 4 > c.bytes) { n = i; break; }
+            pred  = (int16_t)(src[byte] | (src[byte + 1] << 8));
+            index = src[byte + 2] > 88 ? 88 : src[byte + 2];
+            byte += 4;
+            hi    = false;
+            left  = adpcmBlockSamples(c.blockAlign) - 1;
+            out[i] = (int16_t)pred;
+            continue;
+        }
+
+        if (byte >= c.bytes) { n = i; break; }
+        uint8_t nib = hi ? src[byte++] >> 4 : src[byte] & 0x0F;
+        hi = !hi;
+        left--;
+
+        int32_t step = STEP[index];
+        int32_t diff = step >> 3;
+        if (nib & 4) diff += step;
+        if (nib & 2) diff += step >> 1;
+        if (nib & 1) diff += step >> 2;
+        pred += (nib & 8) ? -diff : diff;
+        pred  = pred > 32767 ? 32767 : pred < -32768 ? -32768 : pred;
+
+        index += INDEX_ADJ[nib & 7];
+        index  = index < 0 ? 0 : index > 88 ? 88 : index;
+
+        out[i] = (int16_t)pred;
+    }
+
+    s.pred  = (int16_t)pred;
+    s.index = (uint8_t)index;
+    s.byte  = byte;
+    s.left  = (uint16_t)left;
+    s.hi    = hi;
+    s.pos  += (uint32_t)n;
+    if (n == 0) s.pos = c.samples;       // truncated clip: end it
+    return n;
+}
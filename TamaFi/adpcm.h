@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdint.h>
+
+// ============ IMA-ADPCM clips ============
+//
+// Sampled sound effects stored in flash as 4-bit IMA-ADPCM, WAV layout: mono
+// blocks of blockAlign bytes, each starting with a 4-byte header (first
+// sample, step index) followed by 2 * (blockAlign - 4) nibbles, low nibble
+// first. A block header resynchronises the predictor, so a bit error never
+// spreads past one block.
+//
+// Decoding streams straight from flash: the decoder state is a few bytes,
+// there is no clip-sized RAM buffer. Clips are encoded at the output rate
+// (tools/adpcm_encode.py), so no resampling happens here. Pure logic.
+
+struct AdpcmClip {
+    const uint8_t *data;       // in flash
+    uint32_t       bytes;
+    uint32_t       samples;
+    uint16_t       blockAlign; // bytes per block, 256 from the encoder
+    uint16_t       rate;       // Hz, must match the mixer
+};
+
+// Samples in one full block
+inline uint32_t adpcmBlockSamples(uint16_t blockAlign) { return 2u * (blockAlign - 4u) + 1u; }
+
+struct AdpcmStream {
+    const AdpcmClip *clip;
+    uint32_t         pos;      // samples decoded
+    uint32_t         byte;     // read offset in clip->data
+    uint16_t         left;     // samples left in the current block (0 = header next)
+    int16_t          pred;
+    uint8_t          index;    // step table index, 0..88
+    bool             hi;       // next nibble is the high one
+};
+
+void adpcmStart(AdpcmStream &s, const AdpcmClip *clip);
+
+// Decode up to n samples; returns how many (0 once the clip is over).
+int adpcmDecode(AdpcmStream &s, int16_t *out, int n);
+
+inline bool adpcmActive(const AdpcmStream &s) { return s.clip && s.pos < s.clip->samples; }
+inline void adpcmStop(AdpcmStream &s)         { s.clip = nullptr; }
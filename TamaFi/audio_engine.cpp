@@ -0,0 +1,101 @@
+#include "audio_engine.h"
+
+#include <string.h>
+
+// ============ Messages ============
+
+AudioMsg audioMsgTone(int freqHz, int durationMs, uint8_t prio) {
+    AudioMsg m;
+    m.type       = AUDIO_MSG_PLAY;
+    m.prio       = prio;
+    m.freqHz     = (uint16_t)freqHz;
+    m.durationMs = (uint16_t)durationMs;
+    return m;
+}
+
+AudioMsg audioMsgSequence(const int *freqs, const int *times, int length, uint8_t prio) {
+    AudioMsg m;
+    m.type   = AUDIO_MSG_SEQUENCE;
+    m.prio   = prio;
+    m.freqs  = freqs;
+    m.times  = times;
+    m.length = length;
+    return m;
+}
+
+AudioMsg audioMsgClip(const AdpcmClip *clip, uint8_t prio) {
+    AudioMsg m;
+    m.type = AUDIO_MSG_CLIP;
+    m.prio = prio;
+    m.clip = clip;
+    return m;
+}
+
+AudioMsg audioMsgMusic(const uint8_t *song, size_t len, uint16_t tempoPct) {
+    AudioMsg m;
+    m.type      = AUDIO_MSG_MUSIC;
+    m.prio      = MIX_PRIO_AMBIENT;
+    m.amplitude = (int16_t)tempoPct;
+    m.length    = (int)len;
+    m.song      = song;
+    return m;
+}
+
+AudioMsg audioMsgStop() {
+    return AudioMsg();
+}
+
+AudioMsg audioMsgAmplitude(int amplitude) {
+    AudioMsg m;
+    m.type      = AUDIO_MSG_AMPLITUDE;
+    m.amplitude = (int16_t)amplitude;
+    return m;
+}
+
+// ============ Engine ============
+
+void audioEngineInit(AudioEngine &e, uint32_t sampleRate, int16_t amp) {
+    mixerInit(e.mix, sampleRate, amp);
+    trackerStop(e.music);
+}
+
+void audioEngineApply(AudioEngine &e, const AudioMsg &m) {
+    switch (m.type) {
+        case AUDIO_MSG_PLAY:
+            mixerPlayTone(e.mix, m.prio, m.freqHz, m.durationMs);
+            break;
+        case AUDIO_MSG_SEQUENCE:
+            mixerPlaySequence(e.mix, m.prio, m.freqs, m.times, (uint8_t)m.length);
+            break;
+        case AUDIO_MSG_CLIP:
+            mixerPlayClip(e.mix, m.prio, m.clip);
+            break;
+        case AUDIO_MSG_MUSIC:      // a new song replaces the old one
+            if (!m.song || !trackerPlay(e.music, m.song, (size_t)m.length, e.mix.rate, (uint16_t)m.amplitude))
+                trackerStop(e.music);
+            break;
+        case AUDIO_MSG_STOP:
+            mixerStopAll(e.mix);
+            trackerStop(e.music);
+            break;
+        case AUDIO_MSG_AMPLITUDE:  // playing voices follow the volume too
+            mixerSetAmplitude(e.mix, m.amplitude);
+            break;
+    }
+}
+
+bool audioEngineActive(const AudioEngine &e) {
+    return mixerActive(e.mix) || (trackerPlaying(e.music) && e.mix.amp > 0);
+}
+
+int audioEngineRender(AudioEngine &e, int16_t *out, int n) {
+    if (n > MIX_BLOCK_MAX) n = MIX_BLOCK_MAX;
+    int got = mixerRender(e.mix, out, n);
+    if (!trackerPlaying(e.music) || e.mix.amp <= 0) return got;
+
+    alignas(16) int16_t music[MIX_BLOCK_MAX];
+    trackerRender(e.music, music, n, (int16_t)(e.mix.amp / AUDIO_MUSIC_AMP_DIV));
+    if (got == 0) memcpy(out, music, (size_t)n * sizeof(int16_t));
+    else          mixAddSat16(out, music, n);
+    return n;
+}
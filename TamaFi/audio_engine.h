@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "mixer.h"
+#include "tracker.h"
+
+// ============ Audio engine ============
+//
+// Everything between a sound request and PCM: control messages applied to
+// the polyphonic mixer (tones, sequences, ADPCM clips) plus background music,
+// rendered block by block. The ES8311 render task and the host offline
+// output (sound_offline.h) drive the same engine, so what the host renders is
+// what the device plays. Pure logic, runs on the host.
+
+#define AUDIO_MUSIC_AMP_DIV  4      // music channel peak = effect amplitude / 4
+
+enum AudioMsgType : uint8_t {
+    AUDIO_MSG_PLAY,
+    AUDIO_MSG_SEQUENCE,
+    AUDIO_MSG_STOP,
+    AUDIO_MSG_AMPLITUDE,
+    AUDIO_MSG_MUSIC,
+    AUDIO_MSG_CLIP,
+};
+
+struct AudioMsg {
+    AudioMsgType     type       = AUDIO_MSG_STOP;
+    uint8_t          prio       = 0;         // PLAY / SEQUENCE / CLIP (MixPrio)
+    uint16_t         freqHz     = 0;         // PLAY
+    uint16_t         durationMs = 0;         // PLAY
+    int16_t          amplitude  = 0;         // AMPLITUDE; MUSIC: tempo, %
+    const int       *freqs      = nullptr;   // SEQUENCE
+    const int       *times      = nullptr;
+    int              length     = 0;         // SEQUENCE; MUSIC: blob size
+    const uint8_t   *song       = nullptr;   // MUSIC (nullptr = off)
+    const AdpcmClip *clip       = nullptr;   // CLIP
+};
+
+AudioMsg audioMsgTone(int freqHz, int durationMs, uint8_t prio);
+AudioMsg audioMsgSequence(const int *freqs, const int *times, int length, uint8_t prio);
+AudioMsg audioMsgClip(const AdpcmClip *clip, uint8_t prio);
+AudioMsg audioMsgMusic(const uint8_t *song, size_t len, uint16_t tempoPct);
+AudioMsg audioMsgStop();
+AudioMsg audioMsgAmplitude(int amplitude);
+
+struct AudioEngine {
+    Mixer   mix;
+    Tracker music;
+};
+
+void audioEngineInit(AudioEngine &e, uint32_t sampleRate, int16_t amp);
+
+// Apply one message. Tables, clips and songs must outlive playback.
+void audioEngineApply(AudioEngine &e, const AudioMsg &m);
+
+// Something left to render (a voice, or music at non-zero volume).
+bool audioEngineActive(const AudioEngine &e);
+
+// Render n (<= MIX_BLOCK_MAX) samples of effects + music. Returns n, or 0 when idle.
+int audioEngineRender(AudioEngine &e, int16_t *out, int n);
@@ -0,0 +1,55 @@
+#include "audio_ring.h"
+
+#include <string.h>
+
+void audioRingInit(AudioRing &r, int16_t *storage, uint32_t capacity) {
+    r.buf  = storage;
+    r.mask = capacity - 1;
+    r.head.store(0, std::memory_order_relaxed);
+    r.tail.store(0, std::memory_order_relaxed);
+}
+
+uint32_t audioRingFill(const AudioRing &r) {
+    return r.head.load(std::memory_order_acquire) - r.tail.load(std::memory_order_acquire);
+}
+
+uint32_t audioRingFree(const AudioRing &r) {
+    return r.mask + 1 - audioRingFill(r);
+}
+
+uint32_t audioRingWrite(AudioRing &r, const int16_t *src, uint32_t n) {
+    uint32_t head = r.head.load(std::memory_order_relaxed);
+    uint32_t tail = r.tail.load(std::memory_order_acquire);
+    uint32_t room = r.mask + 1 - (head - tail);
+    if (n > room) n = room;
+
+    // Up to two copies: to the end of storage, then from the start
+    uint32_t at    = head & r.mask;
+    uint32_t first = r.mask + 1 - at;
+    if (first > n) first = n;
+    memcpy(r.buf + at, src, first * sizeof(int16_t));
+    memcpy(r.buf, src + first, (n - first) * sizeof(int16_t));
+
+    r.head.store(head + n, std::memory_order_release);
+    return n;
+}
+
+uint32_t audioRingRead(AudioRing &r, int16_t *dst, uint32_t n) {
+    uint32_t tail = r.tail.load(std::memory_order_relaxed);
+    uint32_t head = r.head.load(std::memory_order_acquire);
+    uint32_t fill = head - tail;
+    if (n > fill) n = fill;
+
+    uint32_t at    = tail & r.mask;
+    uint32_t first = r.mask + 1 - at;
+    if (first > n) first = n;
+    memcpy(dst, r.buf + at, first * sizeof(int16_t));
+    memcpy(dst + first, r.buf, (n - first) * sizeof(int16_t));
+
+    r.tail.store(tail + n, std::memory_order_release);
+    return n;
+}
+
+void audioRingDiscard(AudioRing &r) {
+    r.tail.store(r.head.load(std::memory_order_acquire), std::memory_order_release);
+}
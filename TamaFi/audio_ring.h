@@ -0,0 +1,32 @@
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+
+// ============ Audio sample ring ============
+//
+// Single-producer / single-consumer ring of mono samples. The producer only
+// moves head, the consumer only moves tail, so no lock is needed; the
+// acquire/release pair publishes the sample data with the index.
+// Capacity must be a power of two.
+
+struct AudioRing {
+    int16_t              *buf;
+    uint32_t              mask;      // capacity - 1
+    std::atomic<uint32_t> head;      // written by the producer
+    std::atomic<uint32_t> tail;      // written by the consumer
+};
+
+void audioRingInit(AudioRing &r, int16_t *storage, uint32_t capacity);
+
+uint32_t audioRingFill(const AudioRing &r);
+uint32_t audioRingFree(const AudioRing &r);
+
+// Producer side: copy up to n samples in, returns how many fit.
+uint32_t audioRingWrite(AudioRing &r, const int16_t *src, uint32_t n);
+
+// Consumer side: copy up to n samples out, returns how many were there.
+uint32_t audioRingRead(AudioRing &r, int16_t *dst, uint32_t n);
+
+// Consumer side: drop everything currently queued.
+void audioRingDiscard(AudioRing &r);
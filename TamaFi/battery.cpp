@@ -1,43 +1,213 @@
 #include "battery.h"
 #include "device_config.h"
 
+#include "i2c_bus.h"
 #include <Wire.h>
 
 #define XPOWERS_CHIP_AXP2101
 #include "XPowersLib.h"
 
+// XPowersLib is used for one-time setup only (under i2cLock). Runtime reads are
+// register bursts queued on the shared bus (i2c_bus.h) and picked up by later
+// calls, so loop() never waits on the PMIC.
+
 static XPowersPMU power;
 static BatteryInfo info = {};
 
+// ============ Register access (async) ============
+
+#define AXP_REG_STATUS1    0x00    // b5 VBUS good, b3 battery present
+#define AXP_REG_STATUS2    0x01    // b6:5 = 01 charging, b3 = 0 VBUS in use
+#define AXP_REG_INTSTS1    0x48    // 0x48..0x4A IRQ status, write 1 to clear
+#define AXP_REG_VBAT_H     0x34    // 0x34[4:0]:0x35 battery voltage, mV
+#define AXP_REG_BAT_PCT    0xA4    // fuel gauge, %
+
+static uint16_t i2cPerMinute = 0;      // measured by the bus layer, see batteryNoteI2cWindow()
+
+static I2cTxn irqTxn, irqClearTxn, statusTxn, vbatTxn, pctTxn;
+
+static bool pmuRead(I2cTxn &t, uint8_t reg, uint8_t n) {
+    if (t.state == I2C_TXN_QUEUED) return false;
+    i2cTxnRead(t, I2C_DEV_PMIC, AXP2101_I2C_ADDR, reg, n);
+    return i2cSubmit(t);
+}
+
+static bool pmuWrite(I2cTxn &t, uint8_t reg, const uint8_t *buf, uint8_t n) {
+    if (t.state == I2C_TXN_QUEUED) return false;
+    i2cTxnWrite(t, I2C_DEV_PMIC, AXP2101_I2C_ADDR, reg, buf, n);
+    return i2cSubmit(t);
+}
+
+// True once when t finished successfully (data valid); failures are dropped.
+static bool pmuTake(I2cTxn &t) {
+    I2cTxnState st = t.state;
+    if (st == I2C_TXN_DONE || st == I2C_TXN_FAILED) t.state = I2C_TXN_IDLE;
+    return st == I2C_TXN_DONE;
+}
+
+// ============ AXP2101 IRQ events ============
+
+#if PMU_IRQ_PIN >= 0
+static volatile bool pmuIrqPending = false;
+static void IRAM_ATTR onPmuIrq() { pmuIrqPending = true; }
+#endif
+
+// Charge / VBUS / battery presence changed — status bits must be re-read.
+static bool statusStale = true;
+
+static const uint32_t IRQ_STATUS_MASK =
+    XPOWERS_AXP2101_VBUS_INSERT_IRQ | XPOWERS_AXP2101_VBUS_REMOVE_IRQ |
+    XPOWERS_AXP2101_BAT_INSERT_IRQ  | XPOWERS_AXP2101_BAT_REMOVE_IRQ  |
+    XPOWERS_AXP2101_BAT_CHG_START_IRQ | XPOWERS_AXP2101_BAT_CHG_DONE_IRQ;
+
+static const uint32_t IRQ_ENABLED_MASK = IRQ_STATUS_MASK |
+    XPOWERS_AXP2101_WARNING_LEVEL1_IRQ | XPOWERS_AXP2101_WARNING_LEVEL2_IRQ |
+    XPOWERS_AXP2101_PKEY_LONG_IRQ;
+
+class Axp2101Events : public PmicEventSource {
+public:
+    uint32_t take(unsigned long now) override {
+        if (!info.available) return 0;
+
+        uint32_t events = 0;
+        if (pmuTake(irqTxn)) events = decode(irqTxn.data);
+
+#if PMU_IRQ_PIN >= 0
+        (void)now;
+        if (pmuIrqPending && pmuRead(irqTxn, AXP_REG_INTSTS1, 3)) pmuIrqPending = false;
+#else
+        if (now - _lastPoll >= PMU_IRQ_POLL_MS && pmuRead(irqTxn, AXP_REG_INTSTS1, 3)) _lastPoll = now;
+#endif
+        return events;
+    }
+
+private:
+    // All three status registers come in one burst; same bit layout as XPOWERS_AXP2101_*_IRQ
+    uint32_t decode(const uint8_t *sts) {
+        uint32_t irq = sts[0] | ((uint32_t)sts[1] << 8) | ((uint32_t)sts[2] << 16);
+        irq &= IRQ_ENABLED_MASK;
+        if (!irq) return 0;
+        pmuWrite(irqClearTxn, AXP_REG_INTSTS1, sts, 3);   // write-1-to-clear what we saw
+
+        if (irq & IRQ_STATUS_MASK) statusStale = true;
+
+        uint32_t events = 0;
+        if (irq & XPOWERS_AXP2101_WARNING_LEVEL1_IRQ) events |= PMIC_EVT_LOW_WARN;
+        if (irq & XPOWERS_AXP2101_WARNING_LEVEL2_IRQ) events |= PMIC_EVT_LOW_CRIT;
+        if (irq & XPOWERS_AXP2101_PKEY_LONG_IRQ)      events |= PMIC_EVT_PKEY_LONG;
+        if (irq & XPOWERS_AXP2101_VBUS_INSERT_IRQ)    events |= PMIC_EVT_VBUS_IN;
+        if (irq & XPOWERS_AXP2101_VBUS_REMOVE_IRQ)    events |= PMIC_EVT_VBUS_OUT;
+        return events;
+    }
+
+    unsigned long _lastPoll = 0;
+};
+
+static Axp2101Events    axpEvents;
+static PmicEventSource *eventSource = &axpEvents;
+
+static void setupIrqs() {
+    power.disableIRQ(XPOWERS_AXP2101_ALL_IRQ);
+    power.setLowBatWarnThreshold(PMU_LOW_WARN_PCT);
+    power.setLowBatShutdownThreshold(PMU_LOW_CRIT_PCT);
+    power.clearIrqStatus();
+    power.enableIRQ(IRQ_ENABLED_MASK);
+#if PMU_IRQ_PIN >= 0
+    pinMode(PMU_IRQ_PIN, INPUT_PULLUP);
+    attachInterrupt(PMU_IRQ_PIN, onPmuIrq, FALLING);   // IRQ is open-drain, active low
+#endif
+}
+
+// ============ Cached battery model ============
+
+// Gauge refresh: fast while something is moving, slow when the cell is idle.
+static const unsigned long BATT_FAST_MS = 10000;
+static const unsigned long BATT_SLOW_MS = 60000;
+static const int           BATT_LOW_PCT = 20;
+
+static unsigned long lastGaugeRead = 0;
+static unsigned long gaugeInterval = 0;    // 0 = read on next update
+
+static void takeStatus() {
+    const uint8_t *st = statusTxn.data;
+    info.batteryConnected = st[0] & 0x08;
+    info.usbConnected     = (st[0] & 0x20) && !(st[1] & 0x08);
+    info.charging         = ((st[1] >> 5) & 0x03) == 0x01;
+    gaugeInterval         = 0;      // plug / charge change: re-read the gauge too
+}
+
+static void takeVoltage() {
+    info.voltage = ((uint16_t)(vbatTxn.data[0] & 0x1F) << 8) | vbatTxn.data[1];
+}
+
+static void takePercent(int pct) {
+    bool moving = info.charging || pct != info.percent || (pct >= 0 && pct <= BATT_LOW_PCT);
+    info.percent  = pct;
+    gaugeInterval = moving ? BATT_FAST_MS : BATT_SLOW_MS;
+}
+
 void batteryInit() {
+    i2cLock(I2C_DEV_PMIC);
     info.available = power.begin(Wire, AXP2101_I2C_ADDR, IIC_SDA, IIC_SCL);
-    if (!info.available) return;
+    if (info.available) {
+        // Enable ADC channels needed for battery monitoring
+        power.enableBattDetection();
+        power.enableBattVoltageMeasure();
+        power.enableVbusVoltageMeasure();
+        power.enableSystemVoltageMeasure();
 
-    // Enable ADC channels needed for battery monitoring
-    power.enableBattDetection();
-    power.enableBattVoltageMeasure();
-    power.enableVbusVoltageMeasure();
-    power.enableSystemVoltageMeasure();
+        setupIrqs();
+    }
+    i2cUnlock(I2C_DEV_PMIC);
+    if (!info.available) return;
 
-    // First reading right away
-    batteryUpdate();
+    // First reading right away (results land on the next batteryUpdate)
+    batteryUpdate(millis());
 }
 
-void batteryUpdate() {
+void batteryUpdate(unsigned long now) {
     if (!info.available) return;
 
-    info.batteryConnected = power.isBatteryConnect();
-    info.charging         = power.isCharging();
-    info.usbConnected     = power.isVbusIn();
-    info.voltage          = power.getBattVoltage();
+    // Pick up finished reads
+    bool changed = false;
+    if (pmuTake(statusTxn)) { takeStatus();                 changed = true; }
+    if (pmuTake(vbatTxn))   { takeVoltage();                changed = true; }
+    if (pmuTake(pctTxn))    { takePercent(pctTxn.data[0]);  changed = true; }
+    if (changed) info.updatedMs = now;
 
-    if (info.batteryConnected) {
-        info.percent = power.getBatteryPercent();
-    } else {
-        info.percent = -1;
+    // Queue new ones
+    if (statusStale && pmuRead(statusTxn, AXP_REG_STATUS1, 2)) {
+        statusStale = false;
+    }
+    if (now - lastGaugeRead >= gaugeInterval) {
+        lastGaugeRead = now;
+        gaugeInterval = BATT_FAST_MS;   // refined by takePercent() once the reading is in
+        pmuRead(vbatTxn, AXP_REG_VBAT_H, 2);
+        if (info.batteryConnected) pmuRead(pctTxn, AXP_REG_BAT_PCT, 1);
+        else                       takePercent(-1);
     }
 }
 
 const BatteryInfo& batteryGetInfo() {
     return info;
 }
+
+uint32_t batteryTakeEvents(unsigned long now) {
+    uint32_t events = eventSource->take(now);
+    if (events & (PMIC_EVT_VBUS_IN | PMIC_EVT_VBUS_OUT)) statusStale = true;
+    return events;
+}
+
+void batterySetEventSource(PmicEventSource *src) {
+    eventSource = src ? src : &axpEvents;
+}
+
+void batteryNoteI2cWindow(uint32_t pmicTxns, uint32_t windowUs) {
+    if (windowUs == 0) return;
+    uint64_t perMin = (uint64_t)pmicTxns * 60000000ULL / windowUs;
+    i2cPerMinute = perMin > 0xFFFF ? 0xFFFF : (uint16_t)perMin;
+}
+
+uint16_t batteryI2cPerMinute() {
+    return i2cPerMinute;
+}
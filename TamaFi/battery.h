@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Arduino.h>
+#include "power_guard.h"   // PmicEventSource, PMIC_EVT_*
 
 struct BatteryInfo {
     bool     available;         // AXP2101 found on I2C
@@ -9,14 +10,30 @@ struct BatteryInfo {
     uint16_t voltage;           // mV
     bool     charging;          // charge in progress
     bool     usbConnected;      // USB power present
+    unsigned long updatedMs;    // millis() of the last refresh
 };
 
 // Initialize AXP2101 PMIC. Call after inputInit() (Wire already up).
 // Performs first batteryUpdate() internally.
 void batteryInit();
 
-// Poll AXP2101 for current battery state. Call every ~5 s from loop().
-void batteryUpdate();
+// Refresh the cached battery state. Call every loop(); it only touches the bus
+// when PMIC IRQs flagged a charge/VBUS/battery change or the gauge is due
+// (every 10 s while charging, low or changing, every 60 s when stable).
+void batteryUpdate(unsigned long now);
 
-// Read-only access to latest battery data.
+// Read-only access to latest battery data (cached, see updatedMs).
 const BatteryInfo& batteryGetInfo();
+
+// Power events (PMIC_EVT_*) raised since the last call. Cheap; call every loop().
+// AXP2101: IRQ pin if PMU_IRQ_PIN >= 0, otherwise IRQ status polled every PMU_IRQ_POLL_MS.
+uint32_t batteryTakeEvents(unsigned long now);
+
+// Use another event source (simulation); nullptr = AXP2101.
+void batterySetEventSource(PmicEventSource *src);
+
+// PMIC bus transactions per minute as counted by i2c_bus (queued transfers
+// plus XPowersLib lock sections). Fed from the i2cBusTakeStats() window of the
+// 60 s diagnostics; 0 until the first window closes.
+void     batteryNoteI2cWindow(uint32_t pmicTxns, uint32_t windowUs);
+uint16_t batteryI2cPerMinute();
@@ -0,0 +1,135 @@
+#include "beacon_agg.h"
+#include <string.h>
+
+// ============ Ring ============
+
+void beaconRingInit(BeaconRing &r) {
+    r.head.store(0, std::memory_order_relaxed);
+    r.tail.store(0, std::memory_order_relaxed);
+    r.dropped.store(0, std::memory_order_relaxed);
+}
+
+bool beaconRingPush(BeaconRing &r, const BeaconSample &s) {
+    uint32_t head = r.head.load(std::memory_order_relaxed);
+    uint32_t tail = r.tail.load(std::memory_order_acquire);
+    if (head - tail >= BEACON_RING_SIZE) {
+        r.dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    r.buf[head & (BEACON_RING_SIZE - 1)] = s;
+    r.head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+bool beaconRingPop(BeaconRing &r, BeaconSample &out) {
+    uint32_t tail = r.tail.load(std::memory_order_relaxed);
+    uint32_t head = r.head.load(std::memory_order_acquire);
+    if (tail == head) return false;
+    out = r.buf[tail & (BEACON_RING_SIZE - 1)];
+    r.tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+// ============ Aggregator ============
+
+static uint32_t apSlot(const uint8_t b[6]) {
+    uint32_t h = ((uint32_t)b[2] << 24) | ((uint32_t)b[3] << 16) | ((uint32_t)b[4] << 8) | b[5];
+    h ^= (uint32_t)b[0] << 8 | b[1];
+    h *= 2654435761u;
+    return h >> (32 - BEACON_AGG_BITS);
+}
+
+static BeaconAp* apLookup(BeaconAgg &a, const uint8_t bssid[6], bool &found) {
+    uint32_t idx = apSlot(bssid);
+    for (int probe = 0; probe < BEACON_AGG_MAX; probe++) {
+        BeaconAp &ap = a.ap[(idx + probe) & (BEACON_AGG_MAX - 1)];
+        if (!ap.used) { found = false; return &ap; }
+        if (memcmp(ap.bssid, bssid, 6) == 0) { found = true; return &ap; }
+    }
+    found = false;
+    return nullptr;
+}
+
+void beaconAggInit(BeaconAgg &a, uint32_t maxFramesPerSec, unsigned long windowMs) {
+    memset(a.ap, 0, sizeof(a.ap));
+    memset(&a.stats, 0, sizeof(a.stats));
+    a.stats.avgRSSI   = -100;
+    a.maxFramesPerSec = maxFramesPerSec;
+    a.tokens          = maxFramesPerSec;
+    a.lastRefillMs    = 0;
+    a.windowMs        = windowMs;
+}
+
+uint32_t beaconAggProcess(BeaconAgg &a, BeaconRing &r, unsigned long now) {
+    // Token bucket: at most maxFramesPerSec frames folded per second
+    unsigned long elapsed = now - a.lastRefillMs;
+    if (elapsed > 0) {
+        uint64_t refill = (uint64_t)elapsed * a.maxFramesPerSec / 1000;
+        if (refill > 0) {
+            a.tokens       = (uint32_t)((a.tokens + refill > a.maxFramesPerSec) ? a.maxFramesPerSec : a.tokens + refill);
+            a.lastRefillMs = now;
+        }
+    }
+
+    uint32_t done = 0;
+    BeaconSample s;
+    while (a.tokens > 0 && beaconRingPop(r, s)) {
+        a.tokens--;
+        done++;
+
+        bool found;
+        BeaconAp *ap = apLookup(a, s.bssid, found);
+        if (!ap) continue;                      // table full until next refresh
+
+        if (!found) {
+            memcpy(ap->bssid, s.bssid, 6);
+            ap->used   = true;
+            ap->rssiQ4 = (int16_t)(s.rssi * 16);
+            ap->frames = 0;
+        } else {
+            ap->rssiQ4 += (int16_t)((s.rssi * 16 - ap->rssiQ4) / 4);
+        }
+        ap->flags      = s.flags;
+        ap->channel    = s.channel;
+        ap->lastSeenMs = now;
+        if (ap->frames < 0xFFFF) ap->frames++;
+    }
+
+    a.stats.framesProcessed += done;
+    if (a.tokens == 0) a.stats.budgetHits++;   // rest stays in ring (or gets dropped there)
+    return done;
+}
+
+void beaconAggRefresh(BeaconAgg &a, unsigned long now) {
+    BeaconAggStats &st = a.stats;
+    st.apCount = st.strongCount = st.openCount = st.hiddenCount = 0;
+    long rssiSum = 0;
+    bool dropped = false;
+
+    for (int i = 0; i < BEACON_AGG_MAX; i++) {
+        BeaconAp &ap = a.ap[i];
+        if (!ap.used) continue;
+        if (now - ap.lastSeenMs > a.windowMs) { ap.used = false; dropped = true; continue; }
+
+        int rssi = ap.rssiQ4 / 16;
+        st.apCount++;
+        rssiSum += rssi;
+        if (rssi > -60)                      st.strongCount++;
+        if (ap.flags & BEACON_FLAG_OPEN)     st.openCount++;
+        if (ap.flags & BEACON_FLAG_HIDDEN)   st.hiddenCount++;
+    }
+    st.avgRSSI = st.apCount ? (int16_t)(rssiSum / st.apCount) : -100;
+
+    // Re-insert survivors so linear-probe chains stay intact
+    if (dropped) {
+        BeaconAp old[BEACON_AGG_MAX];
+        memcpy(old, a.ap, sizeof(old));
+        memset(a.ap, 0, sizeof(a.ap));
+        for (int i = 0; i < BEACON_AGG_MAX; i++) {
+            if (!old[i].used) continue;
+            bool found;
+            BeaconAp *ap = apLookup(a, old[i].bssid, found);
+            if (ap) *ap = old[i];
+        }
+    }
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+
+// ============ Passive beacon aggregation ============
+//
+// Producer (promiscuous RX callback) pushes parsed beacon samples into a
+// lock-free single-producer/single-consumer ring; the main loop drains it
+// into a deduping per-BSSID table under a frames-per-second budget.
+// Zero hardware deps.
+
+#define BEACON_RING_SIZE     64     // power of two
+#define BEACON_AGG_BITS      6
+#define BEACON_AGG_MAX       (1 << BEACON_AGG_BITS)   // tracked APs (open addressing)
+
+struct BeaconSample {
+    uint8_t  bssid[6];
+    int8_t   rssi;
+    uint8_t  channel;
+    uint8_t  flags;        // BEACON_FLAG_*
+};
+
+#define BEACON_FLAG_OPEN    0x01
+#define BEACON_FLAG_HIDDEN  0x02
+
+// SPSC ring. Push from the RX callback, pop from loop() only.
+struct BeaconRing {
+    BeaconSample          buf[BEACON_RING_SIZE];
+    std::atomic<uint32_t> head;      // written by producer
+    std::atomic<uint32_t> tail;      // written by consumer
+    std::atomic<uint32_t> dropped;   // ring full
+};
+
+void beaconRingInit(BeaconRing &r);
+bool beaconRingPush(BeaconRing &r, const BeaconSample &s);   // producer side, never blocks
+bool beaconRingPop(BeaconRing &r, BeaconSample &out);        // consumer side
+
+struct BeaconAp {
+    uint8_t       bssid[6];
+    bool          used;
+    uint8_t       flags;
+    uint8_t       channel;
+    int16_t       rssiQ4;      // EWMA RSSI, dBm * 16
+    uint16_t      frames;      // saturating
+    unsigned long lastSeenMs;
+};
+
+struct BeaconAggStats {
+    uint16_t apCount;          // APs seen within the window
+    uint16_t strongCount;      // of which RSSI > -60
+    uint16_t openCount;
+    uint16_t hiddenCount;
+    int16_t  avgRSSI;          // mean of per-AP EWMA, dBm (-100 if none)
+    uint32_t framesProcessed;  // total folded in
+    uint32_t budgetHits;       // process() calls that ran out of per-second budget
+};
+
+struct BeaconAgg {
+    BeaconAp       ap[BEACON_AGG_MAX];
+    BeaconAggStats stats;
+    uint32_t       maxFramesPerSec;   // CPU cap
+    uint32_t       tokens;            // frames allowed until next refill
+    unsigned long  lastRefillMs;
+    unsigned long  windowMs;          // AP forgotten after this long unseen
+};
+
+void beaconAggInit(BeaconAgg &a, uint32_t maxFramesPerSec, unsigned long windowMs);
+
+// Drain ring within budget; returns frames processed in this call.
+uint32_t beaconAggProcess(BeaconAgg &a, BeaconRing &r, unsigned long now);
+
+// Drop stale APs and recompute stats. Cheap (fixed table), call ~1/s.
+void beaconAggRefresh(BeaconAgg &a, unsigned long now);
@@ -0,0 +1,66 @@
+#include "cpu_governor.h"
+
+#include <string.h>
+
+const uint16_t GOV_MHZ[GOV_LEVELS] = { 80, 160, 240 };
+
+void governorInit(Governor &g, uint8_t level, unsigned long now) {
+    memset(&g, 0, sizeof(g));
+    g.level  = level < GOV_LEVELS ? level : GOV_LEVELS - 1;
+    g.lastMs = now;
+}
+
+static uint32_t loadPct(uint32_t frameUs, uint32_t mhzNow, uint32_t mhzAt, uint32_t budgetUs) {
+    // Render time scales roughly with 1 / clock
+    uint64_t us = (uint64_t)frameUs * mhzNow / mhzAt;
+    return (uint32_t)(us * 100 / budgetUs);
+}
+
+uint8_t governorStep(Governor &g, const GovernorInputs &in, unsigned long now) {
+    g.residencyMs[g.level] += now - g.lastMs;
+    g.lastMs = now;
+
+    if (in.input) g.boostUntil = now + GOV_BOOST_MS;
+
+    uint8_t want = g.level;
+    if (in.asleep) {
+        want = 0;                                   // nothing to render
+        g.boostUntil = 0;
+    } else {
+        uint8_t floor = (in.animated || in.scanning) ? 1 : 0;
+        uint32_t budget = in.animated ? GOV_BUDGET_ANIM_US : GOV_BUDGET_STATIC_US;
+
+        if ((long)(g.boostUntil - now) > 0) {
+            want = GOV_LEVELS - 1;
+        } else if (in.frameUs) {
+            uint32_t mhz = GOV_MHZ[g.level];
+            if (loadPct(in.frameUs, mhz, mhz, budget) > GOV_UP_LOAD_PCT) {
+                if (g.level < GOV_LEVELS - 1) want = g.level + 1;
+                g.lowSince = 0;
+            } else if (g.level > 0 &&
+                       loadPct(in.frameUs, mhz, GOV_MHZ[g.level - 1], budget) < GOV_DOWN_LOAD_PCT) {
+                if (g.lowSince == 0) g.lowSince = now;
+                if (now - g.lowSince >= GOV_DOWN_HOLD_MS) want = g.level - 1;
+            } else {
+                g.lowSince = 0;
+            }
+        }
+        if (want < floor) want = floor;
+    }
+
+    if (want != g.level) {
+        g.level    = want;
+        g.lowSince = 0;
+        g.switches++;
+    }
+    return g.level;
+}
+
+void governorTakeResidency(Governor &g, uint32_t out[GOV_LEVELS], uint32_t &switches) {
+    for (int i = 0; i < GOV_LEVELS; i++) {
+        out[i] = g.residencyMs[i];
+        g.residencyMs[i] = 0;
+    }
+    switches   = g.switches;
+    g.switches = 0;
+}
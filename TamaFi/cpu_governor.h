@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdint.h>
+
+// ============ CPU frequency governor ============
+//
+// Picks the CPU clock for the next frame from what the device is doing:
+//   - display asleep                    -> lowest level
+//   - animated screen / WiFi scan       -> at least the middle level
+//   - user input                        -> top level for GOV_BOOST_MS
+//   - last frame's render time vs. the frame budget: step up at once when it
+//     gets tight, step down only after it would have fit at the lower clock
+//     for GOV_DOWN_HOLD_MS (hysteresis, no ping-pong)
+// Pure policy: the caller applies GOV_MHZ[level] (setCpuFrequencyMhz) before
+// the frame's draw + flush. 80 MHz is the floor WiFi still runs at.
+
+#define GOV_LEVELS            3
+#define GOV_BUDGET_ANIM_US    33000    // ~30 fps on animated screens
+#define GOV_BUDGET_STATIC_US  100000   // menus / info: 10 fps is plenty
+#define GOV_UP_LOAD_PCT       80       // frame used more than this of its budget -> up
+#define GOV_DOWN_LOAD_PCT     55       // would fit under this at the lower clock -> down
+#define GOV_DOWN_HOLD_MS      2000
+#define GOV_BOOST_MS          500
+
+extern const uint16_t GOV_MHZ[GOV_LEVELS];   // 80, 160, 240
+
+struct GovernorInputs {
+    bool     asleep;       // displayIsAsleep()
+    bool     animated;     // current Screen redraws moving content
+    bool     scanning;     // WiFi scan in flight
+    bool     input;        // user input this pass
+    uint32_t frameUs;      // draw + flush time of the last frame, 0 = none
+};
+
+struct Governor {
+    uint8_t       level;
+    unsigned long lowSince;      // 0 = load not low
+    unsigned long boostUntil;
+    unsigned long lastMs;
+    uint32_t      residencyMs[GOV_LEVELS];
+    uint32_t      switches;
+};
+
+void governorInit(Governor &g, uint8_t level, unsigned long now);
+
+// Level for the next frame. Also books residency up to now.
+uint8_t governorStep(Governor &g, const GovernorInputs &in, unsigned long now);
+
+// Copy the residency counters and start a new window.
+void governorTakeResidency(Governor &g, uint32_t out[GOV_LEVELS], uint32_t &switches);
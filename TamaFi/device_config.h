@@ -27,6 +27,10 @@
 #define IIC_SDA 15
 #define IIC_SCL 14
 #define TP_INT  21
+#define INPUT_DOUBLE_TAP_MS  200   // окно второго тапа по OK (-> R1)
+#define TOUCH_RELEASE_MS     20    // нет IRQ столько — палец убран (FT3168 в monitor mode шлёт IRQ, пока касание)
+#define INPUT_GESTURES       1     // жесты в контентной зоне (gesture.h): 2x тап -> R1, долгий -> R2, 3x -> R3, свайп/drag -> UP/DOWN
+#define INPUT_TOUCH_TRACE    0     // 1 = каждый сэмпл тача в USBSerial ("touch,ms,x,y,down"), для tools/gesture_replay
 
 // ---------- Buttons ----------
 #define BOOT_BTN_PIN  0   // GPIO0, LOW = pressed (не BOOT_PIN — конфликт с esp32-hal.h)
@@ -43,9 +47,38 @@
 #define I2S_DI_IO   10
 #define I2S_WS_IO   45
 #define I2S_DO_IO   8
+// Фоновая музыка на главном экране (трекер, music.cpp): 1 = вкл. Только ES8311.
+#define AMBIENT_MUSIC      1
+#define MUSIC_SWITCH_MS    8000   // настроение должно держаться столько, чтобы сменить песню
+// Микрофон ES8311: хлопок / свист / шум -> реакция питомца (mic.cpp). Только ES8311.
+#define MIC_DETECT         1
+#define MIC_GAIN           4      // es8311_mic_gain_t: 4 = 24 dB
+#define MIC_ECHO_HOLD_MS   150    // после своего звука микрофон ещё столько не слушаем
 
 // ---------- Power Management (AXP2101 PMIC, I2C same bus as touch) ----------
 #define AXP2101_I2C_ADDR  0x34
+// AXP2101 IRQ line. Not routed to a GPIO on this board, so PMU_IRQ_PIN stays
+// -1 and the poll below is permanent: one 3-byte read of the IRQ status
+// registers (0x48..0x4A) every PMU_IRQ_POLL_MS. That is 60 of the 62 PMIC
+// transactions per minute on a stable battery (72 while charging or low; the
+// rest are gauge reads, battery.cpp), and a low-battery warning reaches the
+// emergency save up to PMU_IRQ_POLL_MS late.
+// Set a pin only on a board that wires the IRQ; the poll is then dropped.
+#define PMU_IRQ_PIN       -1
+#define PMU_IRQ_POLL_MS   1000
+#define PMU_LOW_WARN_PCT  15    // warning level 1 -> early save (5..20 %)
+#define PMU_LOW_CRIT_PCT  5     // warning level 2 -> emergency save (0..15 %)
+// Capacity of the attached LiPo (MX1.25 connector); used for runtime projection.
+#define BATTERY_CAPACITY_MAH  500
+
+// ---------- WiFi scan traces ----------
+// 1 = append every real scan to LittleFS as JSON lines (replayable with WifiScanReplay)
+#define WIFI_RECORD_TRACES  0
+#define WIFI_TRACE_PATH     "/scans.jsonl"
+
+// ---------- Passive WiFi sensing (Settings -> WiFi Sense: Listen) ----------
+#define BEACON_MAX_FRAMES_PER_SEC  400   // CPU cap for beacon aggregation
+#define BEACON_DECIMATION          2     // process every Nth beacon
 
 // ---------- Display brightness ----------
 // Controlled via gfx->Display_Brightness(0..255), no separate PWM pin
@@ -141,8 +141,21 @@ void setActionStripVisible(bool visible) {
   actionStripVisible = visible;
 }
 
+static uint32_t flushCount = 0;
+static uint32_t flushStartUs = 0, flushDoneUs = 0;
+
 void flushContentAndDrawControlBar() {
+  flushStartUs = micros();
   contentCanvas->flush();
+  flushDoneUs = micros();
+  flushCount++;
+}
+
+uint32_t displayFlushCount() { return flushCount; }
+
+void displayLastFlushUs(uint32_t& startUs, uint32_t& doneUs) {
+  startUs = flushStartUs;
+  doneUs  = flushDoneUs;
 }
 
 void drawSpriteToContent(int x, int y, int w, int h, const uint16_t* buffer, uint16_t transparentColor) {
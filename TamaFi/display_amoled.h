@@ -11,6 +11,12 @@ void displayAmoledInit();
 // 240x240 content canvas — draw here; then call flushContentAndDrawControlBar().
 Arduino_GFX* getContentCanvas();
 
+// Frames pushed to the panel since boot (energy accounting).
+uint32_t displayFlushCount();
+
+// micros() at start and end of the latest flush (input latency).
+void displayLastFlushUs(uint32_t& startUs, uint32_t& doneUs);
+
 // Real display (368x448) — for control bar.
 Arduino_GFX* getDisplayGfx();
 // Яркость 0–255 (обёртка над setBrightness SH8601).
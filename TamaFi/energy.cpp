@@ -0,0 +1,126 @@
+#include "energy.h"
+#include "device_config.h"
+
+#include <string.h>
+
+// Rough figures for the 1.8" AMOLED board at 3.7 V; energyReconcile() corrects
+// the sum, per-state numbers can be refined with a meter (USB current while
+// forcing one state at a time).
+const EnergyTable ENERGY_TABLE_DEFAULT = {
+    { 28, 48, 2 },          // CPU: poll, work, light sleep
+    { 1, 18, 38, 70 },      // display: asleep, low, mid, high (mostly-dark scenes)
+    180,                    // one 368x368 QSPI flush, ~6 ms at +30 mA
+    { 0, 110, 75, 95 },     // radio: off, scanning, grace, listen
+    22,                     // audio
+    BATTERY_CAPACITY_MAH,
+};
+
+void energyInit(EnergyModel &m, const EnergyTable &table) {
+    memset(&m, 0, sizeof(m));
+    m.table  = table;
+    m.calib  = 1.0f;
+    m.refPct = -1;
+}
+
+void energyAccount(EnergyModel &m, const EnergyInputs &in) {
+    if (in.elapsedUs == 0) return;
+    const EnergyTable &t = m.table;
+    uint32_t us = in.elapsedUs;
+
+    // CPU: split the interval by measured work / sleep time
+    uint32_t workUs  = in.cpuWorkUs  > us ? us : in.cpuWorkUs;
+    uint32_t sleepUs = in.cpuSleepUs > us - workUs ? us - workUs : in.cpuSleepUs;
+    uint32_t pollUs  = us - workUs - sleepUs;
+
+    m.cpuUs[ENERGY_CPU_WORK]  += workUs;
+    m.cpuUs[ENERGY_CPU_SLEEP] += sleepUs;
+    m.cpuUs[ENERGY_CPU_POLL]  += pollUs;
+
+    uint64_t rail[ENERGY_RAIL_COUNT];
+    rail[ENERGY_RAIL_CPU] = (uint64_t)workUs  * t.cpuMa[ENERGY_CPU_WORK] +
+                            (uint64_t)sleepUs * t.cpuMa[ENERGY_CPU_SLEEP] +
+                            (uint64_t)pollUs  * t.cpuMa[ENERGY_CPU_POLL];
+
+    uint8_t disp = in.brightness < 0 ? 0 : (uint8_t)(in.brightness > 2 ? 3 : in.brightness + 1);
+    m.displayUs[disp] += us;
+    rail[ENERGY_RAIL_DISPLAY] = (uint64_t)us * t.displayMa[disp];
+
+    m.flushes += in.flushes;
+    rail[ENERGY_RAIL_FLUSH] = (uint64_t)in.flushes * t.flushUas * 1000;
+
+    uint8_t radio = in.radio < ENERGY_RADIO_STATES ? in.radio : 0;
+    m.radioUs[radio] += us;
+    rail[ENERGY_RAIL_RADIO] = (uint64_t)us * t.radioMa[radio];
+
+    if (in.audio) m.audioUs += us;
+    rail[ENERGY_RAIL_AUDIO] = in.audio ? (uint64_t)us * t.audioMa : 0;
+
+    uint64_t sum = 0;
+    for (int r = 0; r < ENERGY_RAIL_COUNT; r++) {
+        m.railNas[r] += rail[r];
+        sum += rail[r];
+    }
+    m.totalUs += us;
+
+    // Average current of this interval, smoothed over ENERGY_AVG_TAU_MS
+    float ma    = (float)sum / (float)us;
+    float alpha = (float)us / ((float)ENERGY_AVG_TAU_MS * 1000.0f + (float)us);
+    m.avgMa = (m.avgMa == 0.0f) ? ma : m.avgMa + alpha * (ma - m.avgMa);
+}
+
+uint64_t energyTotalNas(const EnergyModel &m) {
+    uint64_t sum = 0;
+    for (int r = 0; r < ENERGY_RAIL_COUNT; r++) sum += m.railNas[r];
+    return sum;
+}
+
+bool energyReconcile(EnergyModel &m, int pct, uint16_t mv, bool discharging) {
+    if (mv) m.mv = mv;
+
+    if (!discharging || pct < 0) {
+        m.refPct = -1;          // charging or gauge unknown: window closed
+        return false;
+    }
+    if (m.refPct < 0 || pct > m.refPct) {
+        m.refPct = (int8_t)pct;
+        m.refNas = energyTotalNas(m);
+        return false;
+    }
+
+    int drop = m.refPct - pct;
+    if (drop < ENERGY_CAL_MIN_DROP) return false;
+
+    uint64_t now      = energyTotalNas(m);
+    uint64_t modelled = now - m.refNas;
+    m.refPct = (int8_t)pct;
+    m.refNas = now;
+    if (modelled == 0) return false;
+
+    // drop % of capacity; 1 mAh = 3.6e9 nA*s
+    float measured = (float)drop / 100.0f * m.table.capacityMah * 3.6e9f;
+    float ratio    = measured / (float)modelled;
+    if (ratio < ENERGY_CAL_MIN) ratio = ENERGY_CAL_MIN;
+    if (ratio > ENERGY_CAL_MAX) ratio = ENERGY_CAL_MAX;
+
+    // Gauge steps are coarse: average over windows instead of trusting one
+    m.calib = (m.calibCount == 0) ? ratio : m.calib * 0.7f + ratio * 0.3f;
+    if (m.calibCount < 255) m.calibCount++;
+    return true;
+}
+
+int32_t energyProjectedMin(const EnergyModel &m, int pct) {
+    if (pct < 0 || m.avgMa <= 0.0f) return -1;
+    float leftMah = (float)pct * m.table.capacityMah / 100.0f;
+    return (int32_t)(leftMah * 60.0f / (m.avgMa * m.calib));
+}
+
+const char *energyRailName(uint8_t rail) {
+    switch (rail) {
+        case ENERGY_RAIL_CPU:     return "cpu";
+        case ENERGY_RAIL_DISPLAY: return "display";
+        case ENERGY_RAIL_FLUSH:   return "flush";
+        case ENERGY_RAIL_RADIO:   return "radio";
+        case ENERGY_RAIL_AUDIO:   return "audio";
+        default:                  return "?";
+    }
+}
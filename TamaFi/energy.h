@@ -0,0 +1,99 @@
+#pragma once
+
+#include <stdint.h>
+
+// ============ Energy accounting ============
+//
+// Counts time spent in every power-relevant state (display brightness, radio,
+// audio, CPU work / poll / sleep) and turns it into charge with a per-state
+// current table. The table is a first guess; energyReconcile() compares the
+// modelled charge with what the AXP2101 gauge says left the cell and keeps a
+// correction factor, so the runtime projection converges on the real device.
+//
+// Units: currents in mA, time in us, charge in nA*s (mA * us). Pure logic,
+// cheap enough to run every loop().
+
+enum EnergyRail {
+    ENERGY_RAIL_CPU = 0,
+    ENERGY_RAIL_DISPLAY,   // panel emission at the current brightness
+    ENERGY_RAIL_FLUSH,     // QSPI frame transfers
+    ENERGY_RAIL_RADIO,
+    ENERGY_RAIL_AUDIO,     // I2S + codec + PA
+    ENERGY_RAIL_COUNT
+};
+
+enum EnergyCpuState {
+    ENERGY_CPU_POLL = 0,   // loop() spinning with nothing to do
+    ENERGY_CPU_WORK,       // drawing / mixing / scan processing
+    ENERGY_CPU_SLEEP,      // light sleep
+    ENERGY_CPU_STATES
+};
+
+#define ENERGY_DISPLAY_STATES  4   // 0 = asleep, 1..3 = brightness index 0..2
+#define ENERGY_RADIO_STATES    4   // WifiRadioState
+
+// Battery-side current per state. Calibratable; see ENERGY_TABLE_DEFAULT.
+struct EnergyTable {
+    uint16_t cpuMa[ENERGY_CPU_STATES];
+    uint16_t displayMa[ENERGY_DISPLAY_STATES];
+    uint16_t flushUas;                      // charge of one full content flush
+    uint16_t radioMa[ENERGY_RADIO_STATES];
+    uint16_t audioMa;
+    uint16_t capacityMah;                   // cell capacity for gauge % -> mAh
+};
+
+extern const EnergyTable ENERGY_TABLE_DEFAULT;
+
+// What the device did since the previous energyAccount() call.
+struct EnergyInputs {
+    uint32_t elapsedUs;
+    uint32_t cpuWorkUs;    // part of elapsed spent in ENERGY_CPU_WORK
+    uint32_t cpuSleepUs;   // part of elapsed spent in light sleep
+    int8_t   brightness;   // -1 = display asleep, 0..2 = tftBrightnessIndex
+    uint8_t  radio;        // WifiRadioState
+    bool     audio;        // sound playing
+    uint16_t flushes;      // frames pushed to the panel
+};
+
+struct EnergyModel {
+    EnergyTable table;
+
+    uint64_t railNas[ENERGY_RAIL_COUNT];    // modelled charge since init
+    uint64_t cpuUs[ENERGY_CPU_STATES];      // residency
+    uint64_t displayUs[ENERGY_DISPLAY_STATES];
+    uint64_t radioUs[ENERGY_RADIO_STATES];
+    uint64_t audioUs;
+    uint32_t flushes;
+    uint64_t totalUs;
+
+    float    avgMa;        // model current, EWMA over ~ENERGY_AVG_TAU_MS
+    float    calib;        // measured / modelled charge (1.0 until first reconcile)
+    uint8_t  calibCount;   // reconciliations folded into calib
+
+    // Reconciliation reference point (start of the current discharge window)
+    int8_t   refPct;       // -1 = no window open
+    uint64_t refNas;
+    uint16_t mv;           // last cell voltage, for mWh
+};
+
+#define ENERGY_AVG_TAU_MS      300000   // 5 min smoothing for the projection
+#define ENERGY_CAL_MIN_DROP    3        // gauge points per reconciliation window
+#define ENERGY_CAL_MIN         0.5f     // clamp on the correction factor
+#define ENERGY_CAL_MAX         2.5f
+
+void energyInit(EnergyModel &m, const EnergyTable &table);
+
+// Fold one interval into the counters.
+void energyAccount(EnergyModel &m, const EnergyInputs &in);
+
+// Feed the latest gauge reading. Windows only run while discharging; each
+// window of ENERGY_CAL_MIN_DROP points updates calib. Returns true if it did.
+bool energyReconcile(EnergyModel &m, int pct, uint16_t mv, bool discharging);
+
+// Total modelled charge, nA*s (uncorrected). mAh = nAs / 3.6e9.
+uint64_t energyTotalNas(const EnergyModel &m);
+
+// Minutes left at the current average draw, corrected by calib; -1 if unknown.
+int32_t energyProjectedMin(const EnergyModel &m, int pct);
+
+const char *energyRailName(uint8_t rail);
@@ -0,0 +1,209 @@
+#include "gesture.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+GestureConfig gestureDefaultConfig(int16_t areaTop, int16_t areaBottom) {
+    GestureConfig c;
+    c.areaTop        = areaTop;
+    c.areaBottom     = areaBottom;
+    c.tapSlopPx      = 16;
+    c.tapMaxMs       = 250;
+    c.multiTapMs     = 250;
+    c.multiTapSlopPx = 48;
+    c.longPressMs    = 600;
+    c.swipeMinPx     = 40;      // IDEAS.md 12.1
+    c.swipeMinPxS    = 250;
+    c.swipeMaxMs     = 400;
+    c.dragStepPx     = 48;
+    return c;
+}
+
+void gestureInit(GestureEngine &g, const GestureConfig &cfg) {
+    memset(&g, 0, sizeof(g));
+    g.cfg = cfg;
+}
+
+static uint32_t dist2(int dx, int dy) {
+    return (uint32_t)(dx * dx + dy * dy);
+}
+
+static uint32_t isqrt(uint32_t v) {
+    uint32_t r = 0, bit = 1u << 30;
+    while (bit > v) bit >>= 2;
+    while (bit) {
+        if (v >= r + bit) { v -= r + bit; r = (r >> 1) + bit; }
+        else              { r >>= 1; }
+        bit >>= 2;
+    }
+    return r;
+}
+
+static uint8_t dirOf(int dx, int dy) {
+    if (abs(dx) >= abs(dy)) return dx < 0 ? GESTURE_DIR_LEFT : GESTURE_DIR_RIGHT;
+    return dy < 0 ? GESTURE_DIR_UP : GESTURE_DIR_DOWN;
+}
+
+static Gesture make(const GestureEngine &g, uint8_t type, uint32_t tMs) {
+    Gesture e;
+    e.type  = type;
+    e.dir   = GESTURE_DIR_NONE;
+    e.x     = g.x0;
+    e.y     = g.y0;
+    e.dx    = (int16_t)(g.x - g.x0);
+    e.dy    = (int16_t)(g.y - g.y0);
+    e.speed = 0;
+    e.tMs   = tMs;
+    return e;
+}
+
+// Emit the pending tap run as one gesture
+static int flushTaps(GestureEngine &g, uint32_t tMs, Gesture *out) {
+    if (g.taps == 0) return 0;
+    uint8_t type = g.taps >= 3 ? GESTURE_TRIPLE_TAP : g.taps == 2 ? GESTURE_DOUBLE_TAP : GESTURE_TAP;
+    g.taps = 0;
+    Gesture e = make(g, type, tMs);
+    e.x = g.tapX;
+    e.y = g.tapY;
+    e.dx = e.dy = 0;
+    out[0] = e;
+    return 1;
+}
+
+static bool moved(const GestureEngine &g) {
+    uint32_t slop = g.cfg.tapSlopPx;
+    return dist2(g.x - g.x0, g.y - g.y0) > slop * slop;
+}
+
+// Detents crossed along the drag axis since the last call
+static int dragSteps(GestureEngine &g, uint32_t tMs, Gesture *out, int room) {
+    int travel = g.dragVertical ? g.y - g.y0 : g.x - g.x0;
+    int steps  = travel / (int)g.cfg.dragStepPx;
+    int n = 0;
+    while (g.dragSteps != steps && n < room) {
+        int8_t s = steps > g.dragSteps ? 1 : -1;
+        g.dragSteps += s;
+        Gesture e = make(g, GESTURE_DRAG, tMs);
+        if (g.dragVertical) e.dir = s < 0 ? GESTURE_DIR_UP : GESTURE_DIR_DOWN;
+        else                e.dir = s < 0 ? GESTURE_DIR_LEFT : GESTURE_DIR_RIGHT;
+        out[n++] = e;
+    }
+    return n;
+}
+
+static int press(GestureEngine &g, const TouchSample &s, Gesture *out) {
+    int n = 0;
+    // A touch far away or too late ends the tap run before this stroke
+    if (g.taps > 0 && (s.tMs - g.tapUpMs > g.cfg.multiTapMs ||
+                       dist2(s.x - g.tapX, s.y - g.tapY) >
+                           (uint32_t)g.cfg.multiTapSlopPx * g.cfg.multiTapSlopPx)) {
+        n += flushTaps(g, s.tMs, out + n);
+    }
+    g.down      = true;
+    g.active    = s.y >= g.cfg.areaTop && s.y < g.cfg.areaBottom;
+    g.longFired = false;
+    g.dragging  = false;
+    g.dragSteps = 0;
+    g.x0 = g.x = s.x;
+    g.y0 = g.y = s.y;
+    g.t0 = g.t = s.tMs;
+    if (!g.active) n += flushTaps(g, s.tMs, out + n);
+    return n;
+}
+
+static int move(GestureEngine &g, const TouchSample &s, Gesture *out) {
+    g.x = s.x;
+    g.y = s.y;
+    g.t = s.tMs;
+    if (!g.active || g.longFired) return 0;
+    int n = 0;
+    if (!g.dragging) {
+        if (!moved(g) || s.tMs - g.t0 <= g.cfg.swipeMaxMs) return 0;
+        g.dragging     = true;      // slow move: drag, not swipe
+        g.dragVertical = abs(g.y - g.y0) >= abs(g.x - g.x0);
+        n = flushTaps(g, s.tMs, out);
+    }
+    return n + dragSteps(g, s.tMs, out + n, GESTURE_MAX_OUT - n);
+}
+
+static int release(GestureEngine &g, uint32_t tMs, Gesture *out) {
+    g.down = false;
+    if (!g.active) return 0;
+    g.active = false;
+    if (g.longFired) return 0;
+    if (g.dragging) {
+        out[0] = make(g, GESTURE_DRAG_END, tMs);
+        out[0].dir = g.dragVertical ? (g.y < g.y0 ? GESTURE_DIR_UP : GESTURE_DIR_DOWN)
+                                    : (g.x < g.x0 ? GESTURE_DIR_LEFT : GESTURE_DIR_RIGHT);
+        return 1;
+    }
+
+    uint32_t dur = g.t - g.t0;
+    int dx = g.x - g.x0, dy = g.y - g.y0;
+    uint32_t d = isqrt(dist2(dx, dy));
+    if (moved(g)) {
+        int n = flushTaps(g, tMs, out);               // taps before the swipe keep their order
+        uint32_t speed = dur ? d * 1000u / dur : 0xFFFF;
+        if (d < g.cfg.swipeMinPx || speed < g.cfg.swipeMinPxS) return n;   // neither tap nor swipe
+        out[n] = make(g, GESTURE_SWIPE, tMs);
+        out[n].dir   = dirOf(dx, dy);
+        out[n].speed = (uint16_t)(speed > 0xFFFF ? 0xFFFF : speed);
+        return n + 1;
+    }
+    if (tMs - g.t0 > g.cfg.tapMaxMs) return flushTaps(g, tMs, out);   // too long for a tap, too short to be long
+
+    if (g.taps == 0) {
+        g.tapX = g.x0;
+        g.tapY = g.y0;
+    }
+    g.taps++;
+    g.tapUpMs = tMs;
+    if (g.taps >= 3) return flushTaps(g, tMs, out);  // nothing longer to wait for
+    return 0;
+}
+
+int gestureFeed(GestureEngine &g, const TouchSample &s, Gesture *out) {
+    if (!s.down) return g.down ? release(g, s.tMs, out) : 0;
+    if (!g.down) return press(g, s, out);
+    return move(g, s, out);
+}
+
+int gestureTick(GestureEngine &g, uint32_t now, Gesture *out) {
+    if (g.down) {
+        if (!g.active || g.longFired || g.dragging || moved(g)) return 0;
+        if (now - g.t0 < g.cfg.longPressMs) return 0;
+        g.longFired = true;
+        int n = flushTaps(g, now, out);               // a long press ends any tap run
+        out[n] = make(g, GESTURE_LONG_PRESS, now);
+        return n + 1;
+    }
+    if (g.taps > 0 && now - g.tapUpMs > g.cfg.multiTapMs) return flushTaps(g, now, out);
+    return 0;
+}
+
+InputButton gestureButton(const Gesture &g) {
+    switch (g.type) {
+        case GESTURE_DOUBLE_TAP: return INPUT_R1;
+        case GESTURE_LONG_PRESS: return INPUT_R2;
+        case GESTURE_TRIPLE_TAP: return INPUT_R3;
+        case GESTURE_SWIPE:
+        case GESTURE_DRAG:
+            if (g.dir == GESTURE_DIR_UP)   return INPUT_DOWN;
+            if (g.dir == GESTURE_DIR_DOWN) return INPUT_UP;
+            return INPUT_NONE;
+        default:
+            return INPUT_NONE;
+    }
+}
+
+const char *gestureName(uint8_t type) {
+    static const char *const NAMES[GESTURE_TYPES] = {
+        "none", "tap", "double_tap", "triple_tap", "long_press", "swipe", "drag", "drag_end"
+    };
+    return type < GESTURE_TYPES ? NAMES[type] : "?";
+}
+
+const char *gestureDirName(uint8_t dir) {
+    static const char *const NAMES[] = { "", "left", "right", "up", "down" };
+    return dir <= GESTURE_DIR_DOWN ? NAMES[dir] : "?";
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <stdint.h>
+#include "input_queue.h"   // TouchSample, InputButton
+
+// ============ Gesture recogniser ============
+//
+// Streaming classifier over single-finger touch samples (the same samples
+// the strip tap recogniser gets). Fixed state per stroke — start, last
+// sample, tap run — whatever the stroke length, so it runs per sample in
+// constant time and memory. Pure logic: timestamps come from the caller,
+// host replay lives in tools/gesture_replay.cpp.
+//
+//   tap / double / triple   finger lifted within tapSlopPx and tapMaxMs;
+//                           taps within multiTapMs chain (triple fires at
+//                           once, single / double after the window)
+//   long press              held longPressMs within tapSlopPx
+//   swipe                   lifted after >= swipeMinPx at >= swipeMinPxS
+//                           within swipeMaxMs; dominant axis gives direction
+//   drag                    moved past tapSlopPx while held longer than
+//                           swipeMaxMs; one DRAG per dragStepPx travelled
+
+enum GestureType : uint8_t {
+    GESTURE_NONE = 0,
+    GESTURE_TAP,
+    GESTURE_DOUBLE_TAP,
+    GESTURE_TRIPLE_TAP,
+    GESTURE_LONG_PRESS,
+    GESTURE_SWIPE,
+    GESTURE_DRAG,          // one step of an ongoing drag
+    GESTURE_DRAG_END,
+    GESTURE_TYPES
+};
+
+enum GestureDir : uint8_t {
+    GESTURE_DIR_NONE = 0,
+    GESTURE_DIR_LEFT,
+    GESTURE_DIR_RIGHT,
+    GESTURE_DIR_UP,        // towards y = 0
+    GESTURE_DIR_DOWN
+};
+
+struct Gesture {
+    uint8_t  type;         // GestureType
+    uint8_t  dir;          // GestureDir (swipe / drag)
+    int16_t  x, y;         // stroke start
+    int16_t  dx, dy;       // travel since stroke start
+    uint16_t speed;        // px/s (swipe: average over the stroke)
+    uint32_t tMs;          // sample that completed it
+};
+
+struct GestureConfig {
+    int16_t  areaTop, areaBottom;   // strokes starting outside [top, bottom) are ignored
+    uint16_t tapSlopPx;             // max travel of a tap / long press
+    uint16_t tapMaxMs;              // max contact time of a tap
+    uint16_t multiTapMs;            // lift-to-touch gap that chains taps
+    uint16_t multiTapSlopPx;        // chained taps land this close to the first
+    uint16_t longPressMs;
+    uint16_t swipeMinPx;
+    uint16_t swipeMinPxS;           // px/s
+    uint16_t swipeMaxMs;
+    uint16_t dragStepPx;
+};
+
+// Thresholds for the 368x448 AMOLED at ~60 samples/s.
+GestureConfig gestureDefaultConfig(int16_t areaTop, int16_t areaBottom);
+
+struct GestureEngine {
+    GestureConfig cfg;
+    bool     active;           // stroke in progress (started inside the area)
+    bool     down;             // finger on the panel
+    bool     longFired;
+    bool     dragging;
+    int16_t  x0, y0;           // stroke start
+    int16_t  x, y;             // last sample
+    uint32_t t0, t;
+    int16_t  dragSteps;        // detents emitted along the drag axis (signed)
+    bool     dragVertical;
+    uint8_t  taps;             // chained taps waiting for the window
+    int16_t  tapX, tapY;
+    uint32_t tapUpMs;
+};
+
+#define GESTURE_MAX_OUT  4     // most gestures one call can emit
+
+void gestureInit(GestureEngine &g, const GestureConfig &cfg);
+
+// Feed one sample; writes up to GESTURE_MAX_OUT gestures to out, returns count.
+int gestureFeed(GestureEngine &g, const TouchSample &s, Gesture *out);
+
+// Time-driven gestures: long press while held, single / double tap after the
+// chain window. Call every poll. Same output contract.
+int gestureTick(GestureEngine &g, uint32_t now, Gesture *out);
+
+// Device mapping (input.cpp): double tap -> R1, long press -> R2, triple tap
+// -> R3; swipe or drag up -> DOWN and down -> UP (the list follows the
+// finger). Everything else -> INPUT_NONE.
+InputButton gestureButton(const Gesture &g);
+
+const char *gestureName(uint8_t type);
+const char *gestureDirName(uint8_t dir);
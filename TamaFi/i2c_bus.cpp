@@ -0,0 +1,261 @@
+#include "i2c_bus.h"
+
+#include <Wire.h>
+#include <string.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+
+// Queue order, lower value = served first. Touch and audio only ever use
+// i2cLock() (their drivers talk to Wire directly), so they have no rank and
+// i2cSubmit() refuses them.
+static const uint8_t PRIO_LOCK_ONLY = 0xFF;
+static const uint8_t DEV_PRIO[I2C_DEV_COUNT] = {
+    PRIO_LOCK_ONLY,   // TOUCH
+    0,                // EXPANDER
+    PRIO_LOCK_ONLY,   // AUDIO
+    1,                // PMIC
+};
+
+static SemaphoreHandle_t busMutex   = nullptr;   // held while Wire is in use
+static SemaphoreHandle_t queueMutex = nullptr;   // guards pending[] and stats
+static TaskHandle_t      busTask    = nullptr;
+
+static I2cTxn  *pending[I2C_QUEUE_MAX];
+static int      pendingCount = 0;
+
+static std::atomic<int> lockWanted(0);           // library callers waiting for the bus
+
+static I2cBusStats    stats;
+static uint32_t       statsStartUs = 0;
+static uint32_t       lockStartUs  = 0;
+
+// ============ Stats ============
+
+static void noteWait(uint8_t dev, uint32_t waitUs) {
+    I2cDevStats &d = stats.dev[dev];
+    d.txns++;
+    if (waitUs > d.maxWaitUs) d.maxWaitUs = waitUs;
+}
+
+// ============ Raw transfers (bus mutex held) ============
+
+static bool rawRead(uint8_t addr, uint8_t reg, uint8_t *buf, uint8_t n) {
+    Wire.beginTransmission(addr);
+    Wire.write(reg);
+    if (Wire.endTransmission(false) != 0) return false;
+    if (Wire.requestFrom(addr, n) != n) return false;
+    for (uint8_t i = 0; i < n; i++) buf[i] = Wire.read();
+    return true;
+}
+
+static bool rawWrite(uint8_t addr, uint8_t reg, const uint8_t *buf, uint8_t n) {
+    Wire.beginTransmission(addr);
+    Wire.write(reg);
+    Wire.write(buf, n);
+    return Wire.endTransmission() == 0;
+}
+
+// ============ Scheduling ============
+
+// Index of the next transaction: best priority, then oldest.
+static int pickNext() {
+    int best = -1;
+    for (int i = 0; i < pendingCount; i++) {
+        const I2cTxn *t = pending[i];
+        if (best < 0) { best = i; continue; }
+        const I2cTxn *b = pending[best];
+        uint8_t pt = DEV_PRIO[t->dev], pb = DEV_PRIO[b->dev];
+        if (pt < pb || (pt == pb && (int32_t)(t->queuedUs - b->queuedUs) < 0)) best = i;
+    }
+    return best;
+}
+
+static void removeAt(int i) {
+    pending[i] = pending[--pendingCount];
+}
+
+// Pull every pending read on the same address whose range touches [lo, hi)
+// into batch[], growing the range up to I2C_BURST_MAX. Returns batch size.
+static int collectBurst(I2cTxn *first, I2cTxn **batch, int &lo, int &hi) {
+    int n = 0;
+    batch[n++] = first;
+    lo = first->reg;
+    hi = first->reg + first->len;
+
+    bool grew = true;
+    while (grew && n < I2C_QUEUE_MAX) {
+        grew = false;
+        for (int i = 0; i < pendingCount; i++) {
+            I2cTxn *t = pending[i];
+            if (t->write || t->addr != first->addr) continue;
+            int tlo = t->reg, thi = t->reg + t->len;
+            if (thi < lo || tlo > hi) continue;                 // gap between ranges
+            int nlo = tlo < lo ? tlo : lo;
+            int nhi = thi > hi ? thi : hi;
+            if (nhi - nlo > I2C_BURST_MAX) continue;
+            lo = nlo; hi = nhi;
+            batch[n++] = t;
+            removeAt(i);
+            grew = true;
+            break;
+        }
+    }
+    return n;
+}
+
+static void runBatch(I2cTxn **batch, int n, int lo, int hi) {
+    I2cTxn  *first = batch[0];
+    uint8_t  burst[I2C_BURST_MAX];
+    uint32_t start = micros();
+
+    xSemaphoreTake(busMutex, portMAX_DELAY);
+    bool ok = first->write ? rawWrite(first->addr, first->reg, first->data, first->len)
+                           : rawRead(first->addr, (uint8_t)lo, burst, (uint8_t)(hi - lo));
+    xSemaphoreGive(busMutex);
+    uint32_t busy = micros() - start;
+
+    xSemaphoreTake(queueMutex, portMAX_DELAY);
+    stats.dev[first->dev].busyUs += busy;
+    if (n > 1) stats.merged += n - 1;
+    for (int i = 0; i < n; i++) noteWait(batch[i]->dev, start - batch[i]->queuedUs);
+    xSemaphoreGive(queueMutex);
+
+    for (int i = 0; i < n; i++) {
+        I2cTxn *t = batch[i];
+        if (ok && !t->write) memcpy(t->data, burst + (t->reg - lo), t->len);
+        t->state = ok ? I2C_TXN_DONE : I2C_TXN_FAILED;
+    }
+}
+
+static void busTaskFn(void *) {
+    I2cTxn *batch[I2C_QUEUE_MAX];
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        for (;;) {
+            while (lockWanted > 0) vTaskDelay(1);     // library call waiting: let it in
+
+            xSemaphoreTake(queueMutex, portMAX_DELAY);
+            int idx = pickNext();
+            if (idx < 0) { xSemaphoreGive(queueMutex); break; }
+            I2cTxn *t = pending[idx];
+            removeAt(idx);
+            int lo = t->reg, hi = t->reg + t->len;
+            int n = 1;
+            batch[0] = t;
+            if (!t->write) n = collectBurst(t, batch, lo, hi);
+            xSemaphoreGive(queueMutex);
+
+            runBatch(batch, n, lo, hi);
+        }
+    }
+}
+
+// ============ Public API ============
+
+void i2cBusInit() {
+    busMutex   = xSemaphoreCreateMutex();
+    queueMutex = xSemaphoreCreateMutex();
+    if (!busMutex || !queueMutex) return;
+
+    memset(&stats, 0, sizeof(stats));
+    statsStartUs = micros();
+
+    if (xTaskCreatePinnedToCore(busTaskFn, "i2c", 3072, nullptr, 2, &busTask, 0) != pdPASS) {
+        busTask = nullptr;    // transfers run inline from i2cSubmit()
+    }
+}
+
+void i2cTxnRead(I2cTxn &t, I2cDev dev, uint8_t addr, uint8_t reg, uint8_t len) {
+    t.dev   = dev;
+    t.addr  = addr;
+    t.reg   = reg;
+    t.len   = len > I2C_TXN_MAX_DATA ? I2C_TXN_MAX_DATA : len;
+    t.write = false;
+}
+
+void i2cTxnWrite(I2cTxn &t, I2cDev dev, uint8_t addr, uint8_t reg, const uint8_t *data, uint8_t len) {
+    t.dev   = dev;
+    t.addr  = addr;
+    t.reg   = reg;
+    t.len   = len > I2C_TXN_MAX_DATA ? I2C_TXN_MAX_DATA : len;
+    t.write = true;
+    memcpy(t.data, data, t.len);
+}
+
+bool i2cSubmit(I2cTxn &t) {
+    if (t.state == I2C_TXN_QUEUED) return false;
+    if (t.dev >= I2C_DEV_COUNT || DEV_PRIO[t.dev] == PRIO_LOCK_ONLY) return false;
+    t.queuedUs = micros();
+
+    if (!busTask) {
+        I2cTxn *one = &t;
+        t.state = I2C_TXN_QUEUED;
+        if (busMutex) {
+            runBatch(&one, 1, t.reg, t.reg + t.len);
+        } else {
+            bool ok = t.write ? rawWrite(t.addr, t.reg, t.data, t.len) : rawRead(t.addr, t.reg, t.data, t.len);
+            t.state = ok ? I2C_TXN_DONE : I2C_TXN_FAILED;
+        }
+        return true;
+    }
+
+    xSemaphoreTake(queueMutex, portMAX_DELAY);
+    if (pendingCount >= I2C_QUEUE_MAX) {
+        xSemaphoreGive(queueMutex);
+        return false;
+    }
+    t.state = I2C_TXN_QUEUED;
+    pending[pendingCount++] = &t;
+    xSemaphoreGive(queueMutex);
+
+    xTaskNotifyGive(busTask);
+    return true;
+}
+
+void i2cLock(I2cDev dev) {
+    if (!busMutex) return;
+    uint32_t t0 = micros();
+    lockWanted++;
+    xSemaphoreTake(busMutex, portMAX_DELAY);
+    lockWanted--;
+    lockStartUs = micros();
+
+    xSemaphoreTake(queueMutex, portMAX_DELAY);
+    noteWait(dev, lockStartUs - t0);
+    xSemaphoreGive(queueMutex);
+}
+
+void i2cUnlock(I2cDev dev) {
+    if (!busMutex) return;
+    uint32_t busy = micros() - lockStartUs;
+    xSemaphoreGive(busMutex);
+
+    xSemaphoreTake(queueMutex, portMAX_DELAY);
+    stats.dev[dev].busyUs += busy;
+    xSemaphoreGive(queueMutex);
+}
+
+void i2cBusTakeStats(I2cBusStats &out) {
+    if (!queueMutex) { memset(&out, 0, sizeof(out)); return; }
+
+    xSemaphoreTake(queueMutex, portMAX_DELAY);
+    uint32_t now = micros();
+    out          = stats;
+    out.windowUs = now - statsStartUs;
+    memset(&stats, 0, sizeof(stats));
+    statsStartUs = now;
+    xSemaphoreGive(queueMutex);
+}
+
+const char *i2cDevName(uint8_t dev) {
+    switch (dev) {
+        case I2C_DEV_TOUCH:    return "touch";
+        case I2C_DEV_EXPANDER: return "expander";
+        case I2C_DEV_AUDIO:    return "audio";
+        case I2C_DEV_PMIC:     return "pmic";
+        default:               return "?";
+    }
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <Arduino.h>
+
+// ============ Shared I2C bus arbiter ============
+//
+// Touch (FT3168), codec (ES8311), PMIC (AXP2101) and the TCA9554 expander all
+// sit on Wire (IIC_SDA / IIC_SCL). Two ways onto the bus:
+//   - Register transfers we own (PMIC polling, expander setup) are I2cTxn
+//     queued to one owner task: highest priority first (expander > PMIC),
+//     FIFO within a level; pending reads on the same address whose register
+//     ranges touch or overlap are merged into one burst. Callers own their
+//     I2cTxn and poll its state (no blocking).
+//   - Library drivers that talk to Wire themselves (touch, codec volume, PMIC
+//     setup) wrap each call in i2cLock()/i2cUnlock(). A lock is not queued or
+//     prioritised: the owner task steps aside between transfers while a lock
+//     is wanted, so a touch read waits for at most one queued transfer.
+
+enum I2cDev : uint8_t {
+    I2C_DEV_TOUCH = 0,     // FT3168 (library, i2cLock)
+    I2C_DEV_EXPANDER,      // TCA9554 (queued)
+    I2C_DEV_AUDIO,         // ES8311 control (library, i2cLock)
+    I2C_DEV_PMIC,          // AXP2101 (queued; i2cLock for setup)
+    I2C_DEV_COUNT
+};
+
+enum I2cTxnState : uint8_t {
+    I2C_TXN_IDLE = 0,      // never submitted / result consumed
+    I2C_TXN_QUEUED,
+    I2C_TXN_DONE,
+    I2C_TXN_FAILED
+};
+
+#define I2C_TXN_MAX_DATA  8    // payload of one transaction
+#define I2C_BURST_MAX     16   // longest merged read
+#define I2C_QUEUE_MAX     12
+
+struct I2cTxn {
+    uint8_t  dev;              // I2cDev: EXPANDER or PMIC (priority and stats bucket)
+    uint8_t  addr;             // 7-bit address
+    uint8_t  reg;              // first register
+    uint8_t  len;              // bytes to read / write
+    bool     write;
+    uint8_t  data[I2C_TXN_MAX_DATA];
+
+    volatile I2cTxnState state;
+    uint32_t queuedUs;         // set by i2cSubmit
+};
+
+// Per-device numbers since the last i2cBusTakeStats().
+struct I2cDevStats {
+    uint32_t txns;             // queued transfers + library lock sections
+    uint32_t busyUs;           // time the device held the bus
+    uint32_t maxWaitUs;        // worst queue / lock wait
+};
+
+struct I2cBusStats {
+    I2cDevStats dev[I2C_DEV_COUNT];
+    uint32_t    merged;        // reads folded into another read's burst
+    uint32_t    windowUs;      // length of the measurement window
+};
+
+// Start the owner task. Call once after Wire.begin().
+void i2cBusInit();
+
+// Fill a transaction. Data for writes is copied in; len <= I2C_TXN_MAX_DATA.
+void i2cTxnRead(I2cTxn &t, I2cDev dev, uint8_t addr, uint8_t reg, uint8_t len);
+void i2cTxnWrite(I2cTxn &t, I2cDev dev, uint8_t addr, uint8_t reg, const uint8_t *data, uint8_t len);
+
+// Queue a transaction. False if the queue is full, t is still queued or t.dev
+// is a lock-only device (touch, audio).
+// Without the owner task (init failed) the transfer runs inline.
+bool i2cSubmit(I2cTxn &t);
+
+// Exclusive bus access for library drivers (touch reads, codec volume, PMIC setup).
+void i2cLock(I2cDev dev);
+void i2cUnlock(I2cDev dev);
+
+// Copy and reset the counters (utilisation = sum(busyUs) / windowUs).
+void i2cBusTakeStats(I2cBusStats &out);
+
+const char *i2cDevName(uint8_t dev);
@@ -1,58 +1,55 @@
 #include "input.h"
+#include "input_queue.h"
+#include "gesture.h"
 #include "device_config.h"
 
+#include "i2c_bus.h"
 #include <Wire.h>
 #include <memory>
+#include <string.h>
 
 #include "Arduino_DriveBus_Library.h"
 
+#if INPUT_TOUCH_TRACE
+  #include <HWCDC.h>
+  extern HWCDC USBSerial;   // TamaFi.ino
+#endif
+
 #define TCA9554_INPUT  0x00
 #define TCA9554_OUTPUT 0x01
 #define TCA9554_CONFIG 0x03   // TI TCA9554: 0=Input, 1=Output, 2=Polarity, 3=Configuration
 
-static InputButton pendingEvent = INPUT_NONE;
 static bool lastBoot = true;
 static bool lastPwr = true;
-static bool lastTouchActive = false;
-static int lastTouchX = 0, lastTouchY = 0;
-static unsigned long lastI2CPollMs = 0;
-static const unsigned long I2C_POLL_INTERVAL_MS = 20;
 static unsigned long lastActiveMs = 0;  // для детекции бездействия (AutoSleep)
 
-// Двойной тап по центральной зоне (OK) => виртуальная кнопка R1
-static unsigned long touchStartMs = 0;
-static InputButton touchStartButton = INPUT_NONE;
-static bool pendingOkTap = false;
-static unsigned long pendingOkTapTime = 0;
-static const unsigned long DOUBLE_OK_MS = 200;
+// IRQ тача -> метки времени -> одно чтение I2C за опрос -> распознаватель -> очередь событий
+static TouchStampRing touchStamps;
+static TapRecognizer  taps;
+static GestureEngine  gestures;          // контентная зона: свайпы, долгий тап, 2x/3x тап
+static InputQueue     events;
+static uint32_t       lastIrqMs = 0;     // последняя метка IRQ (палец ещё на экране)
+static InputStats     stats;
 
 // FT3168 через библиотеку (как в примере 02_Drawing_board)
 static std::shared_ptr<Arduino_IIC_DriveBus> touchBus;
 static std::unique_ptr<Arduino_FT3x68> touchFT3168;
 static bool touchInited = false;
 
-void Arduino_IIC_Touch_Interrupt(void) {
-  if (touchFT3168) touchFT3168->IIC_Interrupt_Flag = true;
-}
-
-static const int CONTROL_STRIP_TOP = CONTENT_H;
-
-static InputButton mapTouchToButton(int x, int y) {
-  if (y < CONTROL_STRIP_TOP) return INPUT_NONE;
-  const int thirdW = LCD_W / 3;
-  if (x < thirdW)            return INPUT_UP;
-  if (x < 2 * thirdW)        return INPUT_OK;
-  return INPUT_DOWN;
+// Только метка времени: I2C из прерывания нельзя, координаты читает inputPoll()
+void IRAM_ATTR Arduino_IIC_Touch_Interrupt(void) {
+  touchStampPush(touchStamps, millis());
 }
 
-// Как в 02_Drawing_board: по флагу прерывания читаем X,Y (не по количеству пальцев)
-static bool readTouchOnInterrupt(int16_t& outX, int16_t& outY) {
+// Как в 02_Drawing_board: после прерывания читаем X,Y (не по количеству пальцев)
+static bool readTouch(int16_t& outX, int16_t& outY) {
   if (!touchInited || !touchFT3168) return false;
-  if (!touchFT3168->IIC_Interrupt_Flag) return false;
 
   touchFT3168->IIC_Interrupt_Flag = false;
+  i2cLock(I2C_DEV_TOUCH);
   int32_t x = (int32_t)touchFT3168->IIC_Read_Device_Value(Arduino_IIC_Touch::Value_Information::TOUCH_COORDINATE_X);
   int32_t y = (int32_t)touchFT3168->IIC_Read_Device_Value(Arduino_IIC_Touch::Value_Information::TOUCH_COORDINATE_Y);
+  i2cUnlock(I2C_DEV_TOUCH);
   if (x < 0 || y < 0) return false;
 
   if (x > LCD_W || y > LCD_H) {
@@ -67,32 +64,44 @@ static bool readTouchOnInterrupt(int16_t& outX, int16_t& outY) {
   return true;
 }
 
+// TCA9554 через арбитр шины (до i2cBusInit() транзакция выполняется сразу).
+// Только инициализация, поэтому ждём результата.
+static bool expanderXfer(I2cTxn& t) {
+  if (!i2cSubmit(t)) return false;
+  while (t.state == I2C_TXN_QUEUED) delay(1);
+  bool ok = (t.state == I2C_TXN_DONE);
+  t.state = I2C_TXN_IDLE;
+  return ok;
+}
+
+static bool expanderWrite(uint8_t reg, uint8_t value) {
+  I2cTxn t = {};
+  i2cTxnWrite(t, I2C_DEV_EXPANDER, TCA9554_I2C_ADDR, reg, &value, 1);
+  return expanderXfer(t);
+}
+
+static bool expanderRead(uint8_t reg, uint8_t& value) {
+  I2cTxn t = {};
+  i2cTxnRead(t, I2C_DEV_EXPANDER, TCA9554_I2C_ADDR, reg, 1);
+  if (!expanderXfer(t)) return false;
+  value = t.data[0];
+  return true;
+}
+
 static bool pwrPresent = true;  // после первого NACK перестаём опрашивать PWR (меньше спама в логе)
 static bool readPwr() {
   if (!pwrPresent) return false;
-  Wire.beginTransmission(TCA9554_I2C_ADDR);
-  Wire.write(TCA9554_INPUT);
-  if (Wire.endTransmission(false) != 0) { pwrPresent = false; return false; }
-  if (Wire.requestFrom((uint8_t)TCA9554_I2C_ADDR, (uint8_t)1) != 1) { pwrPresent = false; return false; }
-  uint8_t b = Wire.read();
+  uint8_t b;
+  if (!expanderRead(TCA9554_INPUT, b)) { pwrPresent = false; return false; }
   return (b >> PWR_EXIO_BIT) & 1;
 }
 
 // Как в примере 04: расширитель TCA9554 пины 0,1,2 — LOW, пауза, HIGH (питание/сброс тача)
 static void expanderInitForTouch() {
-  Wire.beginTransmission(TCA9554_I2C_ADDR);
-  Wire.write(TCA9554_CONFIG);
-  Wire.write((uint8_t)0xF8);  // пины 0,1,2 = output
-  if (Wire.endTransmission() != 0) return;
-  Wire.beginTransmission(TCA9554_I2C_ADDR);
-  Wire.write(TCA9554_OUTPUT);
-  Wire.write((uint8_t)0x00);   // 0,1,2 LOW
-  if (Wire.endTransmission() != 0) return;
+  if (!expanderWrite(TCA9554_CONFIG, 0xF8)) return;   // пины 0,1,2 = output
+  if (!expanderWrite(TCA9554_OUTPUT, 0x00)) return;   // 0,1,2 LOW
   delay(20);
-  Wire.beginTransmission(TCA9554_I2C_ADDR);
-  Wire.write(TCA9554_OUTPUT);
-  Wire.write((uint8_t)0x07);   // 0,1,2 HIGH
-  if (Wire.endTransmission() != 0) return;
+  expanderWrite(TCA9554_OUTPUT, 0x07);                // 0,1,2 HIGH
 }
 
 void inputInit() {
@@ -103,6 +112,12 @@ void inputInit() {
 
   lastActiveMs = millis();
 
+  touchStampInit(touchStamps);
+  inputQueueInit(events);
+  const TapConfig cfg = { (int16_t)CONTENT_H, (int16_t)LCD_W, INPUT_DOUBLE_TAP_MS, true };
+  tapInit(taps, cfg);
+  gestureInit(gestures, gestureDefaultConfig(0, (int16_t)CONTENT_H));
+
   expanderInitForTouch();
   delay(50);
 
@@ -116,79 +131,106 @@ void inputInit() {
   }
 }
 
+// Сэмпл в оба распознавателя: полоса кнопок и жесты в контентной зоне
+static void feedTouch(const TouchSample& s, uint32_t now) {
+#if INPUT_TOUCH_TRACE
+  USBSerial.printf("touch,%lu,%d,%d,%d\n", (unsigned long)s.tMs, s.x, s.y, s.down ? 1 : 0);
+#endif
+  tapFeed(taps, s, now, events);
+#if INPUT_GESTURES
+  Gesture g[GESTURE_MAX_OUT];
+  int n = gestureFeed(gestures, s, g);
+  for (int i = 0; i < n; i++) {
+    InputButton b = gestureButton(g[i]);
+    if (b != INPUT_NONE) inputQueuePush(events, InputEvent{ b, g[i].tMs, now });
+  }
+#endif
+}
+
+// Жесты по времени (долгий тап, окно 2x/3x тапа)
+static void tickTouch(uint32_t now) {
+  tapTick(taps, now, events);
+#if INPUT_GESTURES
+  Gesture g[GESTURE_MAX_OUT];
+  int n = gestureTick(gestures, now, g);
+  for (int i = 0; i < n; i++) {
+    InputButton b = gestureButton(g[i]);
+    if (b != INPUT_NONE) inputQueuePush(events, InputEvent{ b, g[i].tMs, now });
+  }
+#endif
+}
+
 bool inputTouchInited() { return touchInited; }
 unsigned long inputLastActiveMs() { return lastActiveMs; }
 
 void inputPoll() {
-  if (pendingEvent != INPUT_NONE) return;
-
-  unsigned long now = millis();
+  uint32_t now = millis();
 
   // --- Опрос кнопки BOOT (GPIO0, LOW = pressed) ---
   bool bootNow = (digitalRead(BOOT_BTN_PIN) == LOW);
   if (bootNow && !lastBoot) {
-    pendingEvent = INPUT_BOOT;
+    // BOOT вне распознавателя: отложенный OK остаётся в окне двойного тапа
+    InputEvent e = { INPUT_BOOT, now, now };
+    inputQueuePush(events, e);
     lastActiveMs = now;
   }
   lastBoot = bootNow;
-  if (pendingEvent != INPUT_NONE) return;   // BOOT сгенерировал событие — не читать тач
-
-  if (now - lastI2CPollMs >= I2C_POLL_INTERVAL_MS) {
-    lastI2CPollMs = now;
-    // PWR не опрашиваем — кнопка не используется, TCA9554 может отсутствовать (NACK в логе)
+  // PWR не опрашиваем — кнопка не используется, TCA9554 может отсутствовать (NACK в логе)
 
+  // --- Тач: все IRQ с прошлого опроса -> одно чтение, время = первый IRQ ---
+  uint32_t irqMs, firstMs = 0, n = 0;
+  while (touchStampPop(touchStamps, irqMs)) {
+    if (n++ == 0) firstMs = irqMs;
+    lastIrqMs = irqMs;
+  }
+  if (n > 0) {
+    stats.irqs += n;
+    stats.reads++;
     int16_t tx, ty;
-    bool touchActive = readTouchOnInterrupt(tx, ty);
-    if (touchActive) {
+    if (readTouch(tx, ty)) {
       lastActiveMs = now;            // любое касание в любой зоне = активность
-      if (!lastTouchActive) {
-        // Старт нового тапа — запоминаем кнопку и время
-        InputButton b = mapTouchToButton(tx, ty);
-        touchStartButton = b;
-        touchStartMs = now;
-
-        // Для UP/DOWN сразу генерим событие на нажатие
-        if (b == INPUT_UP || b == INPUT_DOWN) {
-          pendingEvent = b;
-        }
-      }
-      lastTouchX = tx;
-      lastTouchY = ty;
-    } else {
-      // Переход "палец был на экране -> убран"
-      if (lastTouchActive && touchStartButton != INPUT_NONE) {
-        if (touchStartButton == INPUT_OK) {
-          // Логика одинарного/двойного тапа по OK:
-          if (pendingOkTap && (now - pendingOkTapTime) <= DOUBLE_OK_MS) {
-            // Второй тап в пределах окна — считаем двойным тапом
-            pendingEvent = INPUT_R1;
-            pendingOkTap = false;
-          } else {
-            // Первый тап: ждём возможный второй
-            pendingOkTap = true;
-            pendingOkTapTime = now;
-          }
-        }
-        // Для UP/DOWN событие уже было сгенерировано на нажатие
-        touchStartButton = INPUT_NONE;
-      }
-    }
-    lastTouchActive = touchActive;
-
-    // Если есть отложенный одиночный тап по OK и окно двойного тапа истекло —
-    // генерируем обычный INPUT_OK (если ещё нет другого события).
-    if (pendingOkTap && (now - pendingOkTapTime) > DOUBLE_OK_MS && pendingEvent == INPUT_NONE) {
-      pendingEvent = INPUT_OK;
-      pendingOkTap = false;
+      const TouchSample s = { firstMs, tx, ty, true };
+      feedTouch(s, now);
     }
+  } else if (taps.down && now - lastIrqMs > TOUCH_RELEASE_MS) {
+    // IRQ прекратились — палец убран; момент отпускания = последний IRQ
+    const TouchSample s = { lastIrqMs, 0, 0, false };
+    feedTouch(s, now);
   }
+
+  // Одиночный OK, когда окно двойного тапа истекло; долгий тап и серии тапов
+  tickTouch(now);
+}
+
+bool inputConsume(InputEvent& out) {
+  if (!inputQueuePop(events, out)) return false;
+  uint32_t now   = millis();
+  uint32_t recog = out.queuedMs - out.tMs;
+  uint32_t wait  = now - out.queuedMs;
+  stats.events++;
+  stats.recogSumMs += recog;
+  stats.queueSumMs += wait;
+  if (recog > stats.recogMaxMs) stats.recogMaxMs = recog;
+  if (wait > stats.queueMaxMs)  stats.queueMaxMs = wait;
+  lastActiveMs = now;              // любое событие = активность
+  return true;
 }
 
 InputButton inputConsumeEvent() {
-  InputButton e = pendingEvent;
-  pendingEvent = INPUT_NONE;
-  if (e != INPUT_NONE) lastActiveMs = millis();  // любое событие = активность
-  return e;
+  InputEvent e;
+  return inputConsume(e) ? e.button : INPUT_NONE;
+}
+
+void inputSetDoubleTapEnabled(bool on) {
+  if (on != taps.cfg.doubleTap) tapSetDoubleTap(taps, on, millis(), events);
+}
+
+void inputTakeStats(InputStats& out) {
+  out = stats;
+  out.dropped     = events.drops;
+  out.irqOverruns = touchStamps.overruns.exchange(0);
+  events.drops = 0;
+  memset(&stats, 0, sizeof(stats));
 }
 
 void inputResetActivity() {
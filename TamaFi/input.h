@@ -1,6 +1,6 @@
 #pragma once
 
-#include <Arduino.h>
+#include <stdint.h>
 
 // Virtual buttons (same semantics as original 6 GPIO buttons)
 enum InputButton {
@@ -14,15 +14,31 @@ enum InputButton {
   INPUT_BOOT       // Hardware BOOT button (GPIO0) — sleep/wake toggle
 };
 
+// Button event with its timing. tMs = capture time of the touch sample (or
+// button edge) that completed it; queuedMs = when the recogniser emitted it.
+struct InputEvent {
+  InputButton button;
+  uint32_t    tMs;
+  uint32_t    queuedMs;
+};
+
 // Call once from setup()
 void inputInit();
 
-// Call every loop(); then use inputConsumeEvent() to get edge events
+// Call every loop(): drains touch IRQs (one I2C read per poll), BOOT edge,
+// double-tap timeout. Events queue up (input_queue.h), none are dropped.
 void inputPoll();
 
 // Returns next button event (edge: just pressed) or INPUT_NONE. One event per press.
 InputButton inputConsumeEvent();
 
+// Same, with timestamps. false when the queue is empty.
+bool inputConsume(InputEvent& out);
+
+// OK double tap -> R1. Off: a single OK fires on release instead of after
+// the double-tap window (INPUT_DOUBLE_TAP_MS). Screens without R1 turn it off.
+void inputSetDoubleTapEnabled(bool on);
+
 // true, если тач (FT3168) успешно инициализирован
 bool inputTouchInited();
 
@@ -31,3 +47,17 @@ unsigned long inputLastActiveMs();
 
 // Принудительный сброс таймера бездействия (например, при пробуждении из сна).
 void inputResetActivity();
+
+// Метрики ввода с прошлого вызова. Задержки в мс от захвата (IRQ тача / кнопка).
+struct InputStats {
+  uint32_t events;        // событий отдано
+  uint32_t dropped;       // потеряно: очередь полна
+  uint32_t irqs;          // прерываний тача
+  uint32_t reads;         // чтений I2C (несколько IRQ за один опрос — одно чтение)
+  uint32_t irqOverruns;   // IRQ потеряно: кольцо меток полно
+  uint32_t recogMaxMs;    // захват -> событие в очереди (распознавание, окно двойного тапа)
+  uint32_t recogSumMs;
+  uint32_t queueMaxMs;    // очередь -> inputConsume
+  uint32_t queueSumMs;
+};
+void inputTakeStats(InputStats& out);
@@ -0,0 +1,71 @@
+#include "input_latency.h"
+
+#include <string.h>
+
+const uint16_t LAT_BUCKET_MS[LAT_BUCKETS - 1] = { 17, 33, 50, 67, 100, 150, 200, 300, 500 };
+
+void latencyInit(InputLatency &l) {
+    memset(&l, 0, sizeof(l));
+}
+
+void latencyEvent(InputLatency &l, uint32_t captureUs, uint32_t queuedUs,
+                  uint32_t consumedUs, uint32_t navDoneUs) {
+    if (l.inflight >= LAT_INFLIGHT) {
+        // No frame since: keep the newest, the oldest never reached the panel
+        memmove(&l.pending[0], &l.pending[1], sizeof(LatencyPending) * (LAT_INFLIGHT - 1));
+        l.inflight--;
+        l.lost++;
+    }
+    l.pending[l.inflight++] = { captureUs, queuedUs, consumedUs, navDoneUs };
+}
+
+static void addStage(InputLatency &l, uint8_t stage, uint32_t us) {
+    l.stageSumUs[stage] += us;
+    if (us > l.stageMaxUs[stage]) l.stageMaxUs[stage] = us;
+}
+
+static void addTotal(InputLatency &l, uint32_t us) {
+    uint32_t ms = us / 1000;
+    int b = 0;
+    while (b < LAT_BUCKETS - 1 && ms >= LAT_BUCKET_MS[b]) b++;
+    l.hist[b]++;
+    l.count++;
+    l.sumUs += us;
+    l.lastUs = us;
+    if (us > l.maxUs) l.maxUs = us;
+}
+
+void latencyFrame(InputLatency &l, uint32_t drawUs, uint32_t flushUs, uint32_t doneUs) {
+    uint8_t keep = 0;
+    for (uint8_t i = 0; i < l.inflight; i++) {
+        const LatencyPending &p = l.pending[i];
+        if ((int32_t)(drawUs - p.navDoneUs) < 0) {    // handled after this frame began
+            l.pending[keep++] = p;
+            continue;
+        }
+        addStage(l, LAT_STAGE_RECOGNISE, p.queuedUs - p.captureUs);
+        addStage(l, LAT_STAGE_QUEUE,     p.consumedUs - p.queuedUs);
+        addStage(l, LAT_STAGE_NAV,       p.navDoneUs - p.consumedUs);
+        addStage(l, LAT_STAGE_LOOP,      drawUs - p.navDoneUs);
+        addStage(l, LAT_STAGE_RENDER,    flushUs - drawUs);
+        addStage(l, LAT_STAGE_FLUSH,     doneUs - flushUs);
+        addTotal(l, doneUs - p.captureUs);
+    }
+    l.inflight = keep;
+}
+
+uint16_t latencyPercentileMs(const InputLatency &l, uint8_t pct) {
+    if (l.count == 0) return 0;
+    uint64_t need = ((uint64_t)l.count * pct + 99) / 100;
+    uint64_t seen = 0;
+    for (int b = 0; b < LAT_BUCKETS - 1; b++) {
+        seen += l.hist[b];
+        if (seen >= need) return LAT_BUCKET_MS[b];
+    }
+    return UINT16_MAX;
+}
+
+const char *latencyStageName(uint8_t stage) {
+    static const char *const NAMES[LAT_STAGES] = { "recognise", "queue", "nav", "loop", "render", "flush" };
+    return stage < LAT_STAGES ? NAMES[stage] : "?";
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stdint.h>
+
+// ============ Input-to-flush latency ============
+//
+// Follows every button event from touch capture to the first completed panel
+// flush that drew the screen after navHandleInput() handled it, and splits
+// the time into stages:
+//
+//   recognise  capture (touch IRQ / button edge) -> queued: release timeout,
+//              double-tap window
+//   queue      queued -> consumed by loop()
+//   nav        navHandleInput()
+//   loop       rest of loop() before drawing (pet tick, WiFi, saves...)
+//   render     uiDrawScreen() up to the flush call
+//   flush      flushContentAndDrawControlBar() itself
+//
+// Totals land in a fixed histogram. Times in us (capture stamps are millis,
+// scaled, so totals carry up to 1 ms of that rounding). Pure logic.
+
+enum LatencyStage : uint8_t {
+    LAT_STAGE_RECOGNISE = 0,
+    LAT_STAGE_QUEUE,
+    LAT_STAGE_NAV,
+    LAT_STAGE_LOOP,
+    LAT_STAGE_RENDER,
+    LAT_STAGE_FLUSH,
+    LAT_STAGES
+};
+
+#define LAT_BUCKETS    10
+#define LAT_INFLIGHT   4      // events handled but not yet on the panel
+
+// Upper bucket edges, ms (last bucket is open-ended).
+extern const uint16_t LAT_BUCKET_MS[LAT_BUCKETS - 1];
+
+struct LatencyPending {
+    uint32_t captureUs, queuedUs, consumedUs, navDoneUs;
+};
+
+struct InputLatency {
+    LatencyPending pending[LAT_INFLIGHT];
+    uint8_t        inflight;
+    uint32_t       hist[LAT_BUCKETS];
+    uint32_t       count;
+    uint64_t       sumUs;
+    uint32_t       maxUs;
+    uint32_t       lastUs;                   // most recent total
+    uint64_t       stageSumUs[LAT_STAGES];
+    uint32_t       stageMaxUs[LAT_STAGES];
+    uint32_t       lost;                     // in flight overflowed (display asleep, no flush)
+};
+
+void latencyInit(InputLatency &l);
+
+// An event went through navHandleInput(): capture / queue stamps from the
+// InputEvent (ms * 1000), consumed and nav-done from micros().
+void latencyEvent(InputLatency &l, uint32_t captureUs, uint32_t queuedUs,
+                  uint32_t consumedUs, uint32_t navDoneUs);
+
+// A frame was flushed: drawing started at drawUs, flush ran flushUs..doneUs.
+// Completes every pending event handled before drawUs.
+void latencyFrame(InputLatency &l, uint32_t drawUs, uint32_t flushUs, uint32_t doneUs);
+
+// Total latency below which pct % of events fall, ms (bucket edge; 0 = no data,
+// UINT16_MAX = beyond the last edge).
+uint16_t latencyPercentileMs(const InputLatency &l, uint8_t pct);
+
+const char *latencyStageName(uint8_t stage);
@@ -0,0 +1,107 @@
+#include "input_queue.h"
+
+#include <string.h>
+
+// ============ Touch IRQ ring ============
+
+void touchStampInit(TouchStampRing &r) {
+    r.head.store(0, std::memory_order_relaxed);
+    r.tail.store(0, std::memory_order_relaxed);
+    r.overruns.store(0, std::memory_order_relaxed);
+}
+
+bool touchStampPop(TouchStampRing &r, uint32_t &ms) {
+    uint32_t tail = r.tail.load(std::memory_order_relaxed);
+    if (r.head.load(std::memory_order_acquire) == tail) return false;
+    ms = r.stamp[tail & (TOUCH_STAMP_RING - 1)];
+    r.tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+// ============ Event queue ============
+
+void inputQueueInit(InputQueue &q) {
+    memset(&q, 0, sizeof(q));
+}
+
+bool inputQueuePush(InputQueue &q, const InputEvent &e) {
+    if (q.head - q.tail >= INPUT_QUEUE_LEN) {
+        q.drops++;
+        return false;
+    }
+    q.ev[q.head & (INPUT_QUEUE_LEN - 1)] = e;
+    q.head++;
+    return true;
+}
+
+bool inputQueuePop(InputQueue &q, InputEvent &out) {
+    if (q.head == q.tail) return false;
+    out = q.ev[q.tail & (INPUT_QUEUE_LEN - 1)];
+    q.tail++;
+    return true;
+}
+
+uint32_t inputQueueFill(const InputQueue &q) {
+    return q.head - q.tail;
+}
+
+// ============ Tap recogniser ============
+
+void tapInit(TapRecognizer &r, const TapConfig &cfg) {
+    memset(&r, 0, sizeof(r));
+    r.cfg = cfg;
+}
+
+static void emit(InputQueue &q, InputButton b, uint32_t tMs, uint32_t now) {
+    InputEvent e = { b, tMs, now };
+    inputQueuePush(q, e);
+}
+
+static InputButton stripButton(const TapConfig &c, int x, int y) {
+    if (y < c.stripTop) return INPUT_NONE;
+    const int thirdW = c.width / 3;
+    if (x < thirdW)     return INPUT_UP;
+    if (x < 2 * thirdW) return INPUT_OK;
+    return INPUT_DOWN;
+}
+
+static void flushOk(TapRecognizer &r, uint32_t now, InputQueue &q) {
+    if (!r.okPending) return;
+    r.okPending = false;
+    emit(q, INPUT_OK, r.okPendingMs, now);
+}
+
+void tapFeed(TapRecognizer &r, const TouchSample &s, uint32_t now, InputQueue &q) {
+    if (s.down) {
+        if (r.down) return;                      // still held: nothing new
+        r.down = true;
+        InputButton b = stripButton(r.cfg, s.x, s.y);
+        r.pressButton = (uint8_t)b;
+        if (b != INPUT_OK) flushOk(r, now, q);   // keep order: pending OK goes first
+        if (b == INPUT_UP || b == INPUT_DOWN) emit(q, b, s.tMs, now);
+        return;
+    }
+
+    if (!r.down) return;
+    r.down = false;
+    if (r.pressButton != INPUT_OK) return;       // UP / DOWN fired on press
+    if (!r.cfg.doubleTap) {
+        emit(q, INPUT_OK, s.tMs, now);
+    } else if (r.okPending && s.tMs - r.okPendingMs <= r.cfg.doubleTapMs) {
+        r.okPending = false;
+        emit(q, INPUT_R1, s.tMs, now);
+    } else {
+        flushOk(r, now, q);                      // first tap's window already ran out
+        r.okPending   = true;
+        r.okPendingMs = s.tMs;
+    }
+}
+
+void tapTick(TapRecognizer &r, uint32_t now, InputQueue &q) {
+    if (r.okPending && now - r.okPendingMs > r.cfg.doubleTapMs) flushOk(r, now, q);
+}
+
+void tapSetDoubleTap(TapRecognizer &r, bool on, uint32_t now, InputQueue &q) {
+    r.cfg.doubleTap = on;
+    if (!on) flushOk(r, now, q);
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+#include "input.h"   // InputButton, InputEvent
+
+// ============ Touch IRQ ring ============
+//
+// The FT3168 interrupt only records *when* it fired (millis); the coordinates
+// are read over I2C later from inputPoll(). Single producer (the ISR) /
+// single consumer (loop), same head/tail scheme as audio_ring.h. Push is
+// inline so it lands in the IRAM interrupt handler.
+
+#define TOUCH_STAMP_RING  16     // power of two
+
+struct TouchStampRing {
+    uint32_t              stamp[TOUCH_STAMP_RING];
+    std::atomic<uint32_t> head;       // written by the ISR
+    std::atomic<uint32_t> tail;       // written by the consumer
+    std::atomic<uint32_t> overruns;   // stamps lost, ring full
+};
+
+inline void touchStampPush(TouchStampRing &r, uint32_t ms) {
+    uint32_t head = r.head.load(std::memory_order_relaxed);
+    if (head - r.tail.load(std::memory_order_acquire) >= TOUCH_STAMP_RING) {
+        r.overruns.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    r.stamp[head & (TOUCH_STAMP_RING - 1)] = ms;
+    r.head.store(head + 1, std::memory_order_release);
+}
+
+void touchStampInit(TouchStampRing &r);
+
+// Consumer side: oldest stamp, false when empty.
+bool touchStampPop(TouchStampRing &r, uint32_t &ms);
+
+// ============ Event queue ============
+//
+// Recognised button events in order, each with its capture time. Deep enough
+// for a burst of taps between two loop() passes; a full queue drops the new
+// event and counts it.
+
+#define INPUT_QUEUE_LEN  16      // power of two
+
+struct InputQueue {
+    InputEvent ev[INPUT_QUEUE_LEN];
+    uint32_t   head, tail;
+    uint32_t   drops;
+};
+
+void inputQueueInit(InputQueue &q);
+bool inputQueuePush(InputQueue &q, const InputEvent &e);
+bool inputQueuePop(InputQueue &q, InputEvent &out);
+uint32_t inputQueueFill(const InputQueue &q);
+
+// ============ Tap recogniser ============
+//
+// Touch samples -> UP / OK / DOWN / R1 over the control strip:
+//   - UP and DOWN fire on touch down
+//   - OK fires on release; with the double tap on it first waits doubleTapMs
+//     for a second OK tap, which turns the pair into R1
+//   - any other press while an OK is pending emits that OK first (order kept)
+// Pure logic: the caller supplies timestamps, so it runs on the host.
+
+struct TouchSample {
+    uint32_t tMs;        // capture time (touch IRQ)
+    int16_t  x, y;
+    bool     down;       // false = finger lifted (x, y unused)
+};
+
+struct TapConfig {
+    int16_t  stripTop;       // y where the control strip starts
+    int16_t  width;          // panel width, split in thirds
+    uint16_t doubleTapMs;    // second OK tap window
+    bool     doubleTap;      // OK double tap -> R1 enabled
+};
+
+struct TapRecognizer {
+    TapConfig cfg;
+    bool      down;          // finger on the panel
+    uint8_t   pressButton;   // InputButton under the current press
+    bool      okPending;     // single OK waiting for a second tap
+    uint32_t  okPendingMs;   // release time of that tap
+};
+
+void tapInit(TapRecognizer &r, const TapConfig &cfg);
+
+// Feed one sample; events go to q, stamped with the sample time and now.
+void tapFeed(TapRecognizer &r, const TouchSample &s, uint32_t now, InputQueue &q);
+
+// Emit a pending single OK once the double tap window has passed.
+void tapTick(TapRecognizer &r, uint32_t now, InputQueue &q);
+
+// Turning the double tap off releases a pending OK at once.
+void tapSetDoubleTap(TapRecognizer &r, bool on, uint32_t now, InputQueue &q);
@@ -0,0 +1,102 @@
+#include "mic.h"
+#include "device_config.h"
+#include "sound_es8311.h"
+#include "audio_ring.h"
+
+#include <Arduino.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#define MIC_READ_FRAMES  128       // 8 ms per I2S read
+
+static int16_t   ringStorage[MIC_RING_SAMPLES];
+static AudioRing ring;
+
+static TaskHandle_t          captureTask = nullptr;
+static std::atomic<bool>     enabled(false);
+static std::atomic<uint32_t> overruns(0);
+
+static SoundDetector detector;
+static MicStats      stats = {};
+static unsigned long lastOwnSound = 0;
+
+// ============ Capture task: I2S RX -> ring ============
+
+static void captureTaskFn(void*) {
+    int16_t stereo[MIC_READ_FRAMES * 2];
+    int16_t mono[MIC_READ_FRAMES];
+
+    for (;;) {
+        if (!enabled.load()) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+        size_t n = soundEs8311MicRead(stereo, MIC_READ_FRAMES);   // blocks on DMA
+        if (n == 0) {
+            vTaskDelay(1);
+            continue;
+        }
+        // The mono mic may land in one slot or both; the average works for either
+        for (size_t i = 0; i < n; i++) mono[i] = (int16_t)(((int32_t)stereo[i * 2] + stereo[i * 2 + 1]) / 2);
+        uint32_t put = audioRingWrite(ring, mono, (uint32_t)n);
+        if (put < n) overruns += (uint32_t)(n - put);
+    }
+}
+
+// ============ Public API ============
+
+bool micInit() {
+    if (captureTask) return true;
+    if (!soundEs8311Available()) return false;
+    audioRingInit(ring, ringStorage, MIC_RING_SAMPLES);
+    detectInit(detector);
+    if (xTaskCreatePinnedToCore(captureTaskFn, "mic", 3072, nullptr, MIC_CAPTURE_PRIO, &captureTask, 0) != pdPASS) {
+        captureTask = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void micSetEnabled(bool on) {
+    if (!captureTask || enabled.load() == on) return;
+    enabled.store(on);
+    if (on) {
+        audioRingDiscard(ring);      // nothing from before the pause
+        detectHold(detector);
+        xTaskNotifyGive(captureTask);
+    }
+}
+
+uint8_t micPoll(unsigned long now) {
+    if (!captureTask || !enabled.load()) return SOUND_EVT_NONE;
+
+    if (soundEs8311IsPlaying()) lastOwnSound = now;
+    bool hold = now - lastOwnSound < MIC_ECHO_HOLD_MS;
+
+    int16_t  frame[DETECT_FRAME];
+    uint8_t  evt = SOUND_EVT_NONE;
+    uint32_t t0  = micros();
+    while (audioRingFill(ring) >= DETECT_FRAME) {
+        audioRingRead(ring, frame, DETECT_FRAME);
+        stats.audioMs += DETECT_FRAME * 1000 / DETECT_RATE;
+        if (hold) {
+            detectHold(detector);
+            stats.heldFrames++;
+            continue;
+        }
+        uint8_t e = detectFrame(detector, frame);
+        stats.frames++;
+        for (int k = 0; k < 3; k++) if (e & (1 << k)) stats.events[k]++;
+        evt |= e;
+    }
+    stats.dspUs += micros() - t0;
+    return evt;
+}
+
+void micTakeStats(MicStats &out) {
+    out = stats;
+    out.overruns = overruns.exchange(0);
+    out.floorRms = detectFloorRms(detector);
+    stats = {};
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdint.h>
+#include "sound_detect.h"   // SoundEvent
+
+// ============ Microphone ============
+//
+// Task "mic" (core 0) reads the ES8311 ADC over I2S RX and pushes mono
+// samples into a ring; micPoll() in loop() runs sound_detect on whole frames
+// and returns the events. Frames captured while the speaker plays (and
+// MIC_ECHO_HOLD_MS after) are not classified.
+
+#define MIC_CAPTURE_PRIO  4        // below the audio render / writer tasks
+#define MIC_RING_SAMPLES  4096     // 256 ms of slack for a slow loop()
+
+// Start capture. Needs soundEs8311Init(). Returns false without ES8311.
+bool micInit();
+
+// Pause / resume capture (e.g. while the display sleeps).
+void micSetEnabled(bool on);
+
+// Classify what arrived since the last call. Returns a SoundEvent mask.
+uint8_t micPoll(unsigned long now);
+
+struct MicStats {
+    uint32_t frames;         // frames classified
+    uint32_t heldFrames;     // skipped while our own sound played
+    uint32_t overruns;       // samples lost, ring full
+    uint32_t dspUs;          // detector time
+    uint32_t audioMs;        // audio time behind it
+    uint16_t floorRms;
+    uint16_t events[3];      // clap, whistle, loud
+};
+
+// Counters since the previous call.
+void micTakeStats(MicStats &out);
@@ -0,0 +1,180 @@
+#include "mixer.h"
+
+#include <string.h>
+
+// esp-dsp: saturating 16-bit vector add (EE.VADDS.S16) on the S3.
+// Needs 16-byte aligned buffers and n % 8 == 0, which mixer blocks satisfy.
+#if defined(CONFIG_IDF_TARGET_ESP32S3) && __has_include("dsps_add.h")
+  #include "dsps_add.h"
+  #define MIX_USE_DSP 1
+#else
+  #define MIX_USE_DSP 0
+#endif
+
+// ============ Saturating add ============
+
+void mixAddSat16(int16_t *__restrict acc, const int16_t *__restrict src, int n) {
+#if MIX_USE_DSP
+    if ((n & 7) == 0 && ((uintptr_t)acc & 15) == 0 && ((uintptr_t)src & 15) == 0) {
+        dsps_add_s16_aes3(acc, src, acc, n, 1, 1, 1, 0);
+        return;
+    }
+#endif
+    // Branch-free clamp in fixed groups of 8: GCC vectorises the inner loop
+    // even at -O2 (known trip count), the tail runs scalar
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        for (int k = 0; k < 8; k++) {
+            int32_t s = (int32_t)acc[i + k] + (int32_t)src[i + k];
+            s = s > 32767 ? 32767 : s;
+            s = s < -32768 ? -32768 : s;
+            acc[i + k] = (int16_t)s;
+        }
+    }
+    for (; i < n; i++) {
+        int32_t s = (int32_t)acc[i] + (int32_t)src[i];
+        s = s > 32767 ? 32767 : s;
+        s = s < -32768 ? -32768 : s;
+        acc[i] = (int16_t)s;
+    }
+}
+
+// ============ Voice allocation ============
+
+void mixerInit(Mixer &m, uint32_t sampleRate, int16_t amp) {
+    memset(&m, 0, sizeof(m));
+    m.rate = sampleRate;
+    m.amp  = amp;
+}
+
+static bool voiceBusy(const MixVoice &v) {
+    return synthActive(v.synth) || v.step < v.length || adpcmActive(v.clip);
+}
+
+static int allocVoice(Mixer &m, uint8_t prio) {
+    int victim = -1;
+    for (int i = 0; i < MIX_VOICES; i++) {
+        const MixVoice &v = m.v[i];
+        if (!voiceBusy(v)) return i;
+        if (v.prio > prio) continue;
+        if (victim < 0 || v.prio < m.v[victim].prio ||
+            (v.prio == m.v[victim].prio && (int32_t)(v.order - m.v[victim].order) < 0)) {
+            victim = i;
+        }
+    }
+    if (victim < 0) m.drops++;
+    else            m.steals++;
+    return victim;
+}
+
+static uint32_t msToSamples(const Mixer &m, uint32_t ms) {
+    return m.rate * ms / 1000;
+}
+
+static void startStep(Mixer &m, MixVoice &v) {
+    synthStart(v.synth, SYNTH_SINE, (uint32_t)v.freqs[v.step],
+               msToSamples(m, (uint32_t)v.times[v.step]), m.amp, m.rate);
+    v.step++;
+}
+
+int mixerPlayTone(Mixer &m, uint8_t prio, uint32_t freqHz, uint32_t durationMs) {
+    int i = allocVoice(m, prio);
+    if (i < 0) return -1;
+    MixVoice &v = m.v[i];
+    adpcmStop(v.clip);
+    v.freqs  = nullptr;
+    v.times  = nullptr;
+    v.length = v.step = 0;
+    v.prio   = prio;
+    v.order  = m.order++;
+    synthStart(v.synth, SYNTH_SINE, freqHz, msToSamples(m, durationMs), m.amp, m.rate);
+    return i;
+}
+
+int mixerPlaySequence(Mixer &m, uint8_t prio, const int *freqs, const int *times, uint8_t length) {
+    if (!freqs || !times || length == 0) return -1;
+    int i = allocVoice(m, prio);
+    if (i < 0) return -1;
+    MixVoice &v = m.v[i];
+    adpcmStop(v.clip);
+    v.freqs  = freqs;
+    v.times  = times;
+    v.length = length;
+    v.step   = 0;
+    v.prio   = prio;
+    v.order  = m.order++;
+    startStep(m, v);
+    return i;
+}
+
+int mixerPlayClip(Mixer &m, uint8_t prio, const AdpcmClip *clip) {
+    if (!clip || clip->samples == 0 || clip->rate != m.rate) return -1;
+    int i = allocVoice(m, prio);
+    if (i < 0) return -1;
+    MixVoice &v = m.v[i];
+    synthStop(v.synth);
+    v.freqs  = nullptr;
+    v.times  = nullptr;
+    v.length = v.step = 0;
+    v.prio   = prio;
+    v.order  = m.order++;
+    adpcmStart(v.clip, clip);
+    return i;
+}
+
+void mixerStopAll(Mixer &m) {
+    for (int i = 0; i < MIX_VOICES; i++) {
+        adpcmStop(m.v[i].clip);
+        synthStop(m.v[i].synth);
+        m.v[i].length = m.v[i].step = 0;
+    }
+}
+
+void mixerSetAmplitude(Mixer &m, int16_t amp) {
+    m.amp = amp;
+    for (int i = 0; i < MIX_VOICES; i++) m.v[i].synth.amp = amp;
+}
+
+bool mixerActive(const Mixer &m) {
+    return mixerActiveVoices(m) > 0;
+}
+
+int mixerActiveVoices(const Mixer &m) {
+    int n = 0;
+    for (int i = 0; i < MIX_VOICES; i++) n += voiceBusy(m.v[i]);
+    return n;
+}
+
+// ============ Render ============
+
+int mixerRender(Mixer &m, int16_t *out, int n) {
+    if (n > MIX_BLOCK_MAX) n = MIX_BLOCK_MAX;
+    alignas(16) int16_t tmp[MIX_BLOCK_MAX];
+    bool any = false;
+
+    memset(out, 0, (size_t)n * sizeof(int16_t));
+    for (int i = 0; i < MIX_VOICES; i++) {
+        MixVoice &v = m.v[i];
+        if (!voiceBusy(v)) continue;
+
+        int got = 0;
+        if (adpcmActive(v.clip)) {
+            // Decode straight into the block, then apply the volume
+            got = adpcmDecode(v.clip, tmp, n);
+            for (int k = 0; k < got; k++) tmp[k] = (int16_t)((tmp[k] * (int32_t)m.amp) >> 15);
+        } else {
+            // Fill the block, chaining sequence steps back to back
+            while (got < n) {
+                got += synthRender(v.synth, tmp + got, n - got);
+                if (synthActive(v.synth)) continue;
+                if (v.step >= v.length) break;
+                startStep(m, v);
+            }
+        }
+        if (got == 0) continue;
+        if (got < n) memset(tmp + got, 0, (size_t)(n - got) * sizeof(int16_t));
+        mixAddSat16(out, tmp, n);
+        any = true;
+    }
+    return any ? n : 0;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stdint.h>
+#include "synth.h"
+#include "adpcm.h"
+
+// ============ Polyphonic mixer ============
+//
+// MIX_VOICES voices, each playing a single tone, a tone sequence or an
+// ADPCM clip streamed from flash, summed with Q15 saturation. A new sound
+// takes a free voice; if none is free it steals the lowest-priority voice
+// (oldest first) whose priority is not above its own, otherwise it is
+// dropped. UI clicks therefore overlay event jingles instead of cutting
+// them off. Pure logic, runs on the host.
+
+#define MIX_VOICES     4
+#define MIX_BLOCK_MAX  128      // samples per mixerRender() call
+
+enum MixPrio : uint8_t {
+    MIX_PRIO_AMBIENT = 0,       // background music, first to go
+    MIX_PRIO_UI,                // clicks / beeps
+    MIX_PRIO_EVENT,             // feed, discover, rest
+    MIX_PRIO_ALERT              // hatch, evolution
+};
+
+struct MixVoice {
+    SynthVoice  synth;
+    AdpcmStream clip;           // sampled voice (clip.clip == nullptr for synth voices)
+    const int  *freqs;          // sequence tables (nullptr for a single tone)
+    const int  *times;
+    uint8_t     length;
+    uint8_t     step;
+    uint8_t     prio;
+    uint32_t    order;          // start counter, smaller = older
+};
+
+struct Mixer {
+    MixVoice v[MIX_VOICES];
+    uint32_t rate;
+    int16_t  amp;               // peak amplitude per voice (volume)
+    uint32_t order;
+    uint32_t steals;            // voices cut to make room
+    uint32_t drops;             // sounds refused (all voices busy with higher priority)
+};
+
+void mixerInit(Mixer &m, uint32_t sampleRate, int16_t amp);
+
+// Start a tone / sequence. Returns the voice index or -1 if dropped.
+// Sequence tables must stay valid while playing.
+int mixerPlayTone(Mixer &m, uint8_t prio, uint32_t freqHz, uint32_t durationMs);
+int mixerPlaySequence(Mixer &m, uint8_t prio, const int *freqs, const int *times, uint8_t length);
+
+// Clip must be encoded at the mixer rate and stay valid while playing (flash).
+// Full-scale clip samples come out at the voice amplitude.
+int mixerPlayClip(Mixer &m, uint8_t prio, const AdpcmClip *clip);
+
+void mixerStopAll(Mixer &m);
+
+// Volume for playing and future voices.
+void mixerSetAmplitude(Mixer &m, int16_t amp);
+
+bool mixerActive(const Mixer &m);
+int  mixerActiveVoices(const Mixer &m);
+
+// Mix n (<= MIX_BLOCK_MAX) samples. Returns n, or 0 when every voice is idle.
+int mixerRender(Mixer &m, int16_t *out, int n);
+
+// acc[i] = sat16(acc[i] + src[i]). Uses the ESP32-S3 vector unit when esp-dsp
+// is available, a loop the host compiler vectorises otherwise.
+void mixAddSat16(int16_t *__restrict acc, const int16_t *__restrict src, int n);
@@ -0,0 +1,156 @@
+#include "music.h"
+#include "tracker.h"
+
+// ============ Songs ============
+
+// C major pentatonic, slow; lead with light vibrato over a sine bass
+TRACKER_SONG(SONG_CALM,
+    "tempo 76 4\n"
+    "channels 2\n"
+    "inst 0 tri 11 2 vib 3 4\n"
+    "inst 1 sin 9 1\n"
+    "pat 0\n"
+    "E-4:0 C-3:1\n"
+    "...   ...\n"
+    "G-4   ...\n"
+    "...   ...\n"
+    "A-4   G-2\n"
+    "...   ...\n"
+    "G-4   ...\n"
+    "...   ...\n"
+    "E-4   A-2\n"
+    "...   ...\n"
+    "D-4   ...\n"
+    "...   ...\n"
+    "C-4   F-2\n"
+    "...   ...\n"
+    "...   ...\n"
+    "===   ...\n"
+    "pat 1\n"
+    "D-4:0 F-2:1\n"
+    "...   ...\n"
+    "E-4   ...\n"
+    "...   ...\n"
+    "G-4   C-3\n"
+    "...   ...\n"
+    "A-4   ...\n"
+    "...   ...\n"
+    "G-4   G-2\n"
+    "...   ...\n"
+    "E-4   ...\n"
+    "D-4   ...\n"
+    "C-4   C-3\n"
+    "...   ...\n"
+    "...   ...\n"
+    "===   ===\n"
+    "order 0 1 0 1\n");
+
+// Major chord arpeggios on a square lead, bouncy triangle bass
+TRACKER_SONG(SONG_BRIGHT,
+    "tempo 118 4\n"
+    "channels 3\n"
+    "inst 0 sq 6 3 arp 47\n"
+    "inst 1 tri 11 4\n"
+    "inst 2 sq 5 2 vib 2 6\n"
+    "inst 3 sq 6 3 arp 37\n"
+    "pat 0\n"
+    "C-4:0 C-3:1 E-5:2\n"
+    "...   ...   ...\n"
+    "...   C-4   G-5\n"
+    "...   ...   ...\n"
+    "...   G-2   E-5\n"
+    "...   ...   ...\n"
+    "...   G-3   C-5\n"
+    "...   ...   ...\n"
+    "F-4   F-2   D-5\n"
+    "...   ...   ...\n"
+    "...   F-3   F-5\n"
+    "...   ...   ...\n"
+    "G-4   G-2   E-5\n"
+    "...   ...   ...\n"
+    "...   G-3   D-5\n"
+    "...   ...   ===\n"
+    "pat 1\n"
+    "A-3:3 A-2:1 C-5:2\n"
+    "...   ...   ...\n"
+    "...   A-3   E-5\n"
+    "...   ...   ...\n"
+    "F-4:0 F-2   A-5\n"
+    "...   ...   ...\n"
+    "...   F-3   G-5\n"
+    "...   ...   ...\n"
+    "G-4   G-2   E-5\n"
+    "...   ...   ...\n"
+    "...   G-3   D-5\n"
+    "...   ...   ...\n"
+    "C-4   C-3   C-5\n"
+    "...   ...   ...\n"
+    "===   C-3   ===\n"
+    "...   ===   ...\n"
+    "order 0 1\n");
+
+// A minor, slow and sparse, wide vibrato
+TRACKER_SONG(SONG_GLOOMY,
+    "tempo 64 4\n"
+    "channels 2\n"
+    "inst 0 sin 11 1 vib 6 3\n"
+    "inst 1 tri 9 1\n"
+    "pat 0\n"
+    "A-4:0 A-2:1\n"
+    "...   ...\n"
+    "...   ...\n"
+    "...   ...\n"
+    "G-4   ...\n"
+    "...   ...\n"
+    "E-4   E-2\n"
+    "...   ...\n"
+    "...   ...\n"
+    "...   ...\n"
+    "D-4   F-2\n"
+    "...   ...\n"
+    "C-4   ...\n"
+    "...   ...\n"
+    "D-4   E-2\n"
+    "===   ===\n"
+    "pat 1\n"
+    "C-4:0 F-2:1\n"
+    "...   ...\n"
+    "...   ...\n"
+    "...   ...\n"
+    "B-3   E-2\n"
+    "...   ...\n"
+    "...   ...\n"
+    "...   ...\n"
+    "A-3   A-2\n"
+    "...   ...\n"
+    "...   ...\n"
+    "...   ...\n"
+    "...   ...\n"
+    "...   ...\n"
+    "===   ...\n"
+    "...   ===\n"
+    "order 0 1\n");
+
+// ============ Lookup ============
+
+const uint8_t *musicSong(uint8_t theme, size_t *len) {
+    const uint8_t *data = nullptr;
+    size_t         size = 0;
+    switch (theme) {
+        case MUSIC_CALM:   data = SONG_CALM.data;   size = SONG_CALM.size;   break;
+        case MUSIC_BRIGHT: data = SONG_BRIGHT.data; size = SONG_BRIGHT.size; break;
+        case MUSIC_GLOOMY: data = SONG_GLOOMY.data; size = SONG_GLOOMY.size; break;
+        default: break;
+    }
+    if (len) *len = size;
+    return data;
+}
+
+const char *musicThemeName(uint8_t theme) {
+    switch (theme) {
+        case MUSIC_CALM:   return "calm";
+        case MUSIC_BRIGHT: return "bright";
+        case MUSIC_GLOOMY: return "gloomy";
+        default:           return "none";
+    }
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ============ Ambient music ============
+//
+// Background songs in the tracker format (tracker.h), compiled at build time.
+// The orchestrator picks one by mood and plays it on the home screen.
+
+enum MusicTheme : uint8_t {
+    MUSIC_NONE = 0,
+    MUSIC_CALM,        // calm / curious
+    MUSIC_BRIGHT,      // happy / excited
+    MUSIC_GLOOMY,      // hungry / bored / sick
+    MUSIC_THEMES
+};
+
+// Compiled blob of a theme; nullptr for MUSIC_NONE.
+const uint8_t *musicSong(uint8_t theme, size_t *len);
+
+const char *musicThemeName(uint8_t theme);
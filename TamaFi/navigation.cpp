@@ -2,6 +2,7 @@
 #include "sound.h"
 #include "persistence.h"
 #include "display_amoled.h"    // setDisplayBrightness
+#include "wifi_service.h"      // wifiSetPassive
 
 // Forward declaration — defined in ui.cpp
 void uiOnScreenChange(Screen newScreen);
@@ -21,6 +22,7 @@ uint8_t  tftBrightnessIndex  = 1;
 uint32_t autoSleepMs         = 60000;  // 0=Off, 30000, 60000, 120000
 uint16_t autoSaveMs          = 30000;
 uint8_t  petSkin             = 0;       // 0=Golem, 1=Dragon, 2=Robot, 3=Other
+uint8_t  wifiPassive         = 0;       // 0=Scan only, 1=Listen
 
 // ============ Internal helpers ============
 
@@ -55,8 +57,8 @@ void navHandleInput(InputButton e, PetState &petState) {
     bool r3   = (e == INPUT_R3);
 
     // Beep feedback
-    if (up || down) { sndBeep();   for (int i = 0; i < 4 && soundFeed(); i++) {} }
-    if (ok)         { sndBeepOk(); for (int i = 0; i < 4 && soundFeed(); i++) {} }
+    if (up || down) sndBeep();
+    if (ok)         sndBeepOk();
 
     // ===== QUICK-ACCESS from HOME (R1) =====
     if (currentScreen == SCREEN_HOME) {
@@ -128,8 +130,8 @@ void navHandleInput(InputButton e, PetState &petState) {
 
     // ===== SETTINGS =====
     if (currentScreen == SCREEN_SETTINGS) {
-        if (up)   { sndClick(); settingsMenuIndex = (settingsMenuIndex - 1 + 8) % 8; }
-        if (down) { sndClick(); settingsMenuIndex = (settingsMenuIndex + 1) % 8; }
+        if (up)   { sndClick(); settingsMenuIndex = (settingsMenuIndex - 1 + 9) % 9; }
+        if (down) { sndClick(); settingsMenuIndex = (settingsMenuIndex + 1) % 9; }
         if (ok) {
             sndClick();
             switch (settingsMenuIndex) {
@@ -160,20 +162,25 @@ void navHandleInput(InputButton e, PetState &petState) {
                     else if (autoSaveMs == 30000) autoSaveMs = 60000;
                     else                          autoSaveMs = 15000;
                     break;
-                case 5:  // Reset Pet (stats only)
+                case 5:  // WiFi Sense (Scan <-> Listen)
+                    wifiPassive = wifiPassive ? 0 : 1;
+                    wifiSetPassive(wifiPassive);
+                    break;
+                case 6:  // Reset Pet (stats only)
                     petSendCommand(petState, PET_CMD_RESET);
                     break;
-                case 6:  // Reset All
+                case 7:  // Reset All
                     petSendCommand(petState, PET_CMD_RESET_FULL);
                     petFlushCommands(petState, millis());
                     hasHatchedOnce = false;
                     saveState(petState);
                     navSetScreen(SCREEN_HATCH);
                     return;
-                case 7:  // Back
+                case 8:  // Back
                     navSetScreen(SCREEN_MENU);
-                    break;
+                    return;
             }
+            persistRequestSave(millis());
         }
         return;
     }
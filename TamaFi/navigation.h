@@ -36,6 +36,7 @@ extern uint8_t  tftBrightnessIndex;
 extern uint32_t autoSleepMs;        // 0=Off, 30000, 60000, 120000
 extern uint16_t autoSaveMs;
 extern uint8_t  petSkin;            // 0=Golem, 1=Dragon, 2=Robot, 3=Other
+extern uint8_t  wifiPassive;        // 0=Scan only, 1=Listen to beacons between scans
 
 // ============ API ============
 
@@ -1,75 +1,446 @@
 #include "persistence.h"
-#include "navigation.h"       // soundVolume, tftBrightnessIndex, hasHatchedOnce, petSkin
+#include "navigation.h"       // soundVolume, tftBrightnessIndex, hasHatchedOnce, petSkin, wifiPassive
 #include "sound.h"            // soundSetVolume
+#include "wifi_service.h"     // wifiPlaces
+#include "save_blob.h"
+#include "save_journal.h"
 #include <Preferences.h>
+#include <nvs.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <string.h>
 
 static Preferences prefs;
 
+// prefs is used by the writer task and, during setup(), by load and legacy
+// migration on loop()'s task. Recursive: writeBlob() holds it across
+// journalWrite(), whose store callbacks take it again.
+static SemaphoreHandle_t nvsMutex = nullptr;
+
+static void nvsLock()   { if (nvsMutex) xSemaphoreTakeRecursive(nvsMutex, portMAX_DELAY); }
+static void nvsUnlock() { if (nvsMutex) xSemaphoreGiveRecursive(nvsMutex); }
+
+// ============ NVS slot backend ============
+
+class NvsSaveStore : public SaveStore {
+public:
+    size_t read(uint8_t slot, void *buf, size_t cap) override {
+        const char *key = slotKey(slot);
+        nvsLock();
+        size_t len = prefs.getBytesLength(key);
+        if (len > 0 && len <= cap) len = prefs.getBytes(key, buf, len);
+        else                       len = 0;
+        nvsUnlock();
+        return len;
+    }
+
+    bool write(uint8_t slot, const void *buf, size_t len) override {
+        nvsLock();
+        bool ok = prefs.putBytes(slotKey(slot), buf, len) == len;
+        nvsUnlock();
+        return ok;
+    }
+
+private:
+    static const char *slotKey(uint8_t slot) { return slot ? "slotB" : "slotA"; }
+};
+
+static NvsSaveStore nvsStore;
+static SaveJournal  journal;
+
+static void startWriter();
+
 void persistenceInit() {
+    nvsMutex = xSemaphoreCreateRecursiveMutex();
     prefs.begin("tamafi2", false);
+    journalInit(journal, &nvsStore);
+    startWriter();
 }
 
-void saveState(const PetState &pet) {
-    prefs.putInt("hunger",  pet.pet.hunger);
-    prefs.putInt("happy",   pet.pet.happiness);
-    prefs.putInt("health",  pet.pet.health);
+// ============ Save statistics ============
+
+static PersistStats stats;
+
+const PersistStats &persistStats() { return stats; }
+
+const char *persistSourceText(PersistSource src) {
+    switch (src) {
+        case PERSIST_SRC_BLOB:    return "journal";
+        case PERSIST_SRC_LEGACY:  return "legacy format";
+        case PERSIST_SRC_CORRUPT: return "corrupt blob, defaults";
+        default:                  return "defaults";
+    }
+}
+
+static size_t nvsFreeEntries() {
+    nvs_stats_t st;
+    if (nvs_get_stats(NULL, &st) != ESP_OK) return 0;
+    return st.free_entries;
+}
+
+// ============ Blob <-> state ============
+
+static void packState(const PetState &pet, SaveBlob &b) {
+    memset(&b, 0, sizeof(b));
+
+    b.hunger      = (int16_t)pet.pet.hunger;
+    b.happiness   = (int16_t)pet.pet.happiness;
+    b.health      = (int16_t)pet.pet.health;
+    b.ageTotalMin = pet.pet.ageDays * 1440UL + pet.pet.ageHours * 60UL + pet.pet.ageMinutes;
+    b.stage       = (uint8_t)pet.stage;
+    b.hatched     = hasHatchedOnce ? 1 : 0;
+
+    b.traitCuriosity = pet.traitCuriosity;
+    b.traitActivity  = pet.traitActivity;
+    b.traitStress    = pet.traitStress;
+
+    b.soundVolume        = soundVolume;
+    b.tftBrightnessIndex = tftBrightnessIndex;
+    b.petSkin            = petSkin;
+    b.wifiPassive        = wifiPassive;
+    b.autoSleepMs        = autoSleepMs;
+    b.autoSaveSec        = (uint16_t)(autoSaveMs / 1000);  // сохраняем в секундах
 
-    prefs.putULong("ageMin", pet.pet.ageMinutes);
-    prefs.putULong("ageHr",  pet.pet.ageHours);
-    prefs.putULong("ageDay", pet.pet.ageDays);
+    saveBlobSeal(b);
+}
+
+static void unpackState(const SaveBlob &b, PetState &pet) {
+    pet.pet.hunger     = b.hunger;
+    pet.pet.happiness  = b.happiness;
+    pet.pet.health     = b.health;
+    pet.pet.ageMinutes = b.ageTotalMin % 60;
+    pet.pet.ageHours   = (b.ageTotalMin / 60) % 24;
+    pet.pet.ageDays    = b.ageTotalMin / 1440;
+    pet.stage          = (Stage)b.stage;
+    hasHatchedOnce     = b.hatched != 0;
+
+    pet.traitCuriosity = b.traitCuriosity;
+    pet.traitActivity  = b.traitActivity;
+    pet.traitStress    = b.traitStress;
+
+    soundVolume        = b.soundVolume;
+    tftBrightnessIndex = b.tftBrightnessIndex;
+    petSkin            = b.petSkin;
+    wifiPassive        = b.wifiPassive;
+    autoSleepMs        = b.autoSleepMs;
+    autoSaveMs         = (uint16_t)(b.autoSaveSec * 1000);
+}
+
+// ============ Legacy formats (pre-journal firmware) ============
 
-    prefs.putUChar("stage",  (uint8_t)pet.stage);
-    prefs.putBool("hatched", hasHatchedOnce);
+// v0: one NVS key per field, packed as a blob image (saveBlobFromLegacy).
+static size_t readLegacyKeys(uint8_t *img) {
+    nvsLock();
+    if (prefs.getInt("hunger", -1) == -1) { nvsUnlock(); return 0; }
 
-    prefs.putUChar("sndVol", soundVolume);
-    prefs.putUChar("tftBri", tftBrightnessIndex);
-    prefs.putUChar("petSkin", petSkin);
+    SaveLegacyKeys k;
+    k.hunger  = prefs.getInt("hunger", 70);
+    k.happy   = prefs.getInt("happy",  70);
+    k.health  = prefs.getInt("health", 70);
+    k.ageMin  = prefs.getULong("ageMin", 0);
+    k.ageHr   = prefs.getULong("ageHr",  0);
+    k.ageDay  = prefs.getULong("ageDay", 0);
+    k.stage   = prefs.getUChar("stage", (uint8_t)STAGE_BABY);
+    k.hatched = prefs.getBool("hatched", false);
+    k.sndVol  = prefs.getUChar("sndVol", 3);
+    k.tftBri  = prefs.getUChar("tftBri", 1);
+    k.petSkin = prefs.getUChar("petSkin", 0);
+    k.passive = prefs.getUChar("passive", 0);
+    k.tCur    = prefs.getUChar("tCur", 70);
+    k.tAct    = prefs.getUChar("tAct", 60);
+    k.tStr    = prefs.getUChar("tStr", 40);
+    k.sleepMs = prefs.getULong("sleepMs", 60000);
+    k.saveMs  = prefs.getUShort("saveMs", 30);
+    nvsUnlock();
 
-    prefs.putUChar("tCur", pet.traitCuriosity);
-    prefs.putUChar("tAct", pet.traitActivity);
-    prefs.putUChar("tStr", pet.traitStress);
+    return saveBlobFromLegacy(k, img);
+}
 
-    prefs.putULong("sleepMs", autoSleepMs);
-    prefs.putUShort("saveMs", (uint16_t)(autoSaveMs / 1000));  // сохраняем в секундах
+static void removeLegacy() {
+    static const char *const KEYS[] = {
+        "hunger", "happy", "health", "ageMin", "ageHr", "ageDay",
+        "stage", "hatched", "sndVol", "tftBri", "petSkin", "passive",
+        "tCur", "tAct", "tStr", "sleepMs", "saveMs"
+    };
+    nvsLock();
+    for (const char *k : KEYS) prefs.remove(k);
+    nvsUnlock();
+}
+
+// ============ Public API ============
+
+// CRC of the last image handed to the writer; an identical image is not rewritten.
+static uint32_t      savedCrc    = 0;
+static bool          savedValid  = false;
+static bool          savePending = false;
+static unsigned long saveDueAt   = 0;
+
+// ============ Background writer ============
+//
+// loop() only packs immutable snapshots and drops them into one-slot queues;
+// a low-priority task on core 0 does every NVS write. There is one slot per
+// job type (pet state, place DB): a snapshot posted while a write is in flight
+// overwrites the queued one of the same type, so bursts of requests coalesce
+// into a single write of the newest data. The write counters in stats are only
+// touched by the writer.
+
+struct SaveJob {
+    SaveBlob blob;
+    uint32_t ticket;
+};
+
+struct PlacesJob {
+    uint8_t  buf[PLACE_DB_BLOB_SIZE];
+    uint16_t len;
+    uint32_t ticket;
+};
+
+// Old-format data is only removed once its converted copy is on flash.
+static const uint32_t MIGRATE_FLUSH_MS = 1000;
+
+static QueueHandle_t     saveQueue    = nullptr;
+static QueueHandle_t     placesQueue  = nullptr;
+static TaskHandle_t      writerTask   = nullptr;
+static uint32_t          lastTicket   = 0;        // main side
+static volatile uint32_t doneTicket   = 0;        // writer side
+static volatile bool     writeFailed  = false;    // writer -> main
+static volatile bool     placesFailed = false;    // writer -> main
+
+static bool writeBlob(const SaveBlob &b) {
+    nvsLock();
+    size_t   freeBefore = nvsFreeEntries();
+    uint32_t t0         = micros();
+    bool     ok         = journalWrite(journal, &b, sizeof(b));
+    uint32_t dt         = micros() - t0;
+    size_t   freeAfter  = nvsFreeEntries();
+
+    stats.lastSaveUs = dt;
+    if (dt > stats.maxSaveUs) stats.maxSaveUs = dt;
+    // Free count only drops by what was written; a page GC in between shows as 0.
+    stats.lastEntries = freeBefore > freeAfter ? (uint16_t)(freeBefore - freeAfter) : 0;
+    if (ok) {
+        stats.saves++;
+        stats.flashWrites++;
+    } else {
+        stats.failures++;
+    }
+    nvsUnlock();
+    return ok;
+}
+
+static bool writePlaces(const uint8_t *buf, size_t len) {
+    nvsLock();
+    bool ok = prefs.putBytes("places", buf, len) == len;
+    if (ok) stats.flashWrites++;
+    else    stats.failures++;
+    nvsUnlock();
+    return ok;
+}
+
+static void saveTask(void *) {
+    static SaveJob   job;
+    static PlacesJob places;
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        // Drain both slots until a full pass finds them empty: every ticket up
+        // to the highest one seen is then on flash (or failed).
+        uint32_t done = doneTicket;
+        bool     got;
+        do {
+            got = false;
+            if (xQueueReceive(saveQueue, &job, 0) == pdTRUE) {
+                if (!writeBlob(job.blob)) writeFailed = true;
+                if (job.ticket > done) done = job.ticket;
+                got = true;
+            }
+            if (xQueueReceive(placesQueue, &places, 0) == pdTRUE) {
+                if (!writePlaces(places.buf, places.len)) placesFailed = true;
+                if (places.ticket > done) done = places.ticket;
+                got = true;
+            }
+        } while (got);
+        doneTicket = done;
+    }
+}
+
+static void startWriter() {
+    saveQueue   = xQueueCreate(1, sizeof(SaveJob));
+    placesQueue = xQueueCreate(1, sizeof(PlacesJob));
+    if (!saveQueue || !placesQueue ||
+        xTaskCreatePinnedToCore(saveTask, "save", PERSIST_TASK_STACK, nullptr,
+                                PERSIST_TASK_PRIO, &writerTask, 0) != pdPASS) {
+        saveQueue = placesQueue = nullptr;    // no task — fall back to synchronous writes
+    }
+}
+
+// A failed background write invalidates savedCrc so the next autosave retries.
+static void collectWriteStatus() {
+    if (writeFailed) {
+        writeFailed = false;
+        savedValid  = false;
+    }
+}
+
+// Hand a sealed blob to the writer (or write it inline without one).
+static void submitBlob(const SaveBlob &b) {
+    savedCrc   = b.crc;
+    savedValid = true;
+
+    if (!saveQueue) {
+        if (!writeBlob(b)) savedValid = false;
+        return;
+    }
+
+    SaveJob job;
+    job.blob   = b;
+    job.ticket = ++lastTicket;
+    if (uxQueueMessagesWaiting(saveQueue) > 0) stats.coalesced++;
+    xQueueOverwrite(saveQueue, &job);
+    xTaskNotifyGive(writerTask);
+}
+
+static void noteStall(uint32_t t0) {
+    uint32_t dt = micros() - t0;
+    stats.lastStallUs = dt;
+    if (dt > stats.maxStallUs) stats.maxStallUs = dt;
+}
+
+// ============ Public API ============
+
+void saveState(const PetState &pet) {
+    uint32_t t0 = micros();
+    SaveBlob b;
+    packState(pet, b);
+    collectWriteStatus();
+    submitBlob(b);
+    savePending = false;
+    noteStall(t0);
+}
+
+bool saveStateIfChanged(const PetState &pet) {
+    uint32_t t0 = micros();
+    SaveBlob b;
+    packState(pet, b);
+    savePending = false;
+    collectWriteStatus();
+    bool changed = !savedValid || b.crc != savedCrc;
+    if (changed) submitBlob(b);
+    else         stats.skipped++;
+    noteStall(t0);      // pack + CRC cost loop() the same whether or not it writes
+    return changed;
+}
+
+bool persistFlush(uint32_t timeoutMs) {
+    if (!saveQueue) return true;
+    unsigned long start = millis();
+    while (doneTicket != lastTicket) {
+        if (millis() - start >= timeoutMs) return false;
+        vTaskDelay(1);
+    }
+    return !writeFailed;
+}
+
+void persistRequestSave(unsigned long now) {
+    // Every press pushes the deadline out, so cycling through a setting saves once.
+    savePending = true;
+    saveDueAt   = now + PERSIST_DEBOUNCE_MS;
+}
+
+void persistUpdate(const PetState &pet, unsigned long now) {
+    if (savePending && (long)(now - saveDueAt) >= 0) {
+        saveStateIfChanged(pet);
+    }
 }
 
 void loadState(PetState &pet) {
-    int h = prefs.getInt("hunger", -1);
-    if (h == -1) {
-        // First boot — use defaults already in petState
+    uint32_t t0 = micros();
+    uint8_t  img[SAVE_IMAGE_MAX];
+    SaveBlob b;
+    uint8_t  from = 0;              // stored version, 0 = per-key layout
+    bool     found = true;
+
+    // Newest format first; each older one is upgraded through the migration table.
+    size_t len = journalLoad(journal, img, sizeof(img));
+    if (len > 0 && (from = saveBlobUpgrade(img, len, b)) != 0) {
+        stats.loadSource = PERSIST_SRC_BLOB;
+    } else if ((len = readLegacyKeys(img)) > 0 && saveBlobUpgrade(img, len, b) != 0) {
+        stats.loadSource = PERSIST_SRC_LEGACY;
+    } else {
+        found = false;
+    }
+
+    if (found) {
+        unpackState(b, pet);
+        savedCrc            = b.crc;
+        savedValid          = true;
+        stats.loadedVersion = from;
+
+        if (stats.loadSource == PERSIST_SRC_LEGACY || from != SAVE_BLOB_VERSION) {
+            // Persist the upgraded form once; old data goes only after it is on flash.
+            saveState(pet);
+            if (persistFlush(MIGRATE_FLUSH_MS) && stats.loadSource == PERSIST_SRC_LEGACY) {
+                removeLegacy();
+            }
+        }
+    } else {
+        // First boot or corrupt blob — use defaults already in petState
+        nvsLock();
+        bool hadData       = prefs.isKey("slotA") || prefs.isKey("slotB");
+        nvsUnlock();
+        stats.loadSource   = hadData ? PERSIST_SRC_CORRUPT : PERSIST_SRC_DEFAULTS;
         hasHatchedOnce     = false;
         soundVolume        = 3;
         tftBrightnessIndex = 1;
         petSkin            = 0;
+        wifiPassive        = 0;
         autoSleepMs        = 60000;
         autoSaveMs         = 30000;
         saveState(pet);
-        return;
     }
 
-    pet.pet.hunger     = prefs.getInt("hunger", 70);
-    pet.pet.happiness  = prefs.getInt("happy",  70);
-    pet.pet.health     = prefs.getInt("health", 70);
+    // Apply loaded volume level to hardware
+    soundSetVolume(soundVolume);
 
-    pet.pet.ageMinutes = prefs.getULong("ageMin", 0);
-    pet.pet.ageHours   = prefs.getULong("ageHr",  0);
-    pet.pet.ageDays    = prefs.getULong("ageDay", 0);
+    stats.loadUs = micros() - t0;
+}
 
-    pet.stage          = (Stage)prefs.getUChar("stage", (uint8_t)STAGE_BABY);
-    hasHatchedOnce     = prefs.getBool("hatched", false);
+void savePlaces(unsigned long now) {
+    static unsigned long savedAt = 0;
 
-    soundVolume        = prefs.getUChar("sndVol", 3);
-    tftBrightnessIndex = prefs.getUChar("tftBri", 1);
-    petSkin            = prefs.getUChar("petSkin", 0);
+    if (placesFailed) {
+        placesFailed     = false;
+        wifiPlaces.dirty = true;    // retry with the next autosave
+    }
+    bool due = wifiPlaces.touched && now - savedAt >= PERSIST_PLACES_REFRESH_MS;
+    if (!wifiPlaces.dirty && !due) return;
 
-    // Apply loaded volume level to hardware
-    soundSetVolume(soundVolume);
+    static PlacesJob job;           // too big for the loop() stack; the queue copies it
+    size_t len = placeDbSerialize(wifiPlaces, job.buf, sizeof(job.buf));
+    if (len == 0) return;
+    wifiPlaces.dirty   = false;
+    wifiPlaces.touched = false;
+    savedAt            = now;
 
-    pet.traitCuriosity = prefs.getUChar("tCur", 70);
-    pet.traitActivity  = prefs.getUChar("tAct", 60);
-    pet.traitStress    = prefs.getUChar("tStr", 40);
+    if (!placesQueue) {
+        if (!writePlaces(job.buf, len)) wifiPlaces.dirty = true;
+        return;
+    }
 
-    autoSleepMs        = prefs.getULong("sleepMs", 60000);
-    uint16_t saveSec   = prefs.getUShort("saveMs", 30);
-    autoSaveMs         = (uint16_t)(saveSec * 1000);
+    job.len    = (uint16_t)len;
+    job.ticket = ++lastTicket;
+    xQueueOverwrite(placesQueue, &job);
+    xTaskNotifyGive(writerTask);
+}
+
+void loadPlaces() {
+    uint8_t buf[PLACE_DB_BLOB_SIZE];
+    nvsLock();
+    size_t  len = prefs.getBytes("places", buf, sizeof(buf));
+    nvsUnlock();
+    if (len == 0 || !placeDbDeserialize(wifiPlaces, buf, len)) {
+        placeDbInit(wifiPlaces);    // missing or unknown format — start fresh
+    }
 }
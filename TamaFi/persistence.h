@@ -2,12 +2,74 @@
 
 #include "pet_logic.h"
 
+// ============ Save statistics ============
+
+enum PersistSource {
+    PERSIST_SRC_DEFAULTS = 0,   // nothing stored (first boot)
+    PERSIST_SRC_BLOB,           // valid SaveBlob from the A/B journal
+    PERSIST_SRC_LEGACY,         // old per-key layout, converted
+    PERSIST_SRC_CORRUPT         // journal slots present but none valid
+};
+
+struct PersistStats {
+    uint32_t      lastSaveUs;   // duration of last NVS write (writer task)
+    uint32_t      maxSaveUs;
+    uint32_t      lastStallUs;  // time loop() spent in the last save request (skipped ones too)
+    uint32_t      maxStallUs;
+    uint32_t      coalesced;    // snapshots replaced before the writer got to them
+    uint16_t      lastEntries;  // NVS entries consumed by last save
+    uint32_t      saves;
+    uint32_t      failures;
+    uint32_t      skipped;      // autosaves skipped because the blob was unchanged
+    uint32_t      flashWrites;  // all NVS writes since boot (state + places)
+    PersistSource loadSource;
+    uint8_t       loadedVersion; // save format version found at boot (0 = per-key layout)
+    uint32_t      loadUs;        // loadState() incl. migration and the upgraded save
+};
+
+const PersistStats &persistStats();
+const char *persistSourceText(PersistSource src);
+
 // Open NVS namespace. Call once in setup().
 void persistenceInit();
 
-// Save pet state + user settings to NVS.
+// Debounce for settings-triggered saves.
+#define PERSIST_DEBOUNCE_MS  2000
+
+// Background writer task (core 0).
+#define PERSIST_TASK_STACK   4096
+#define PERSIST_TASK_PRIO    1
+
+// Save pet state + user settings to NVS as one CRC-checked blob, written to the
+// inactive slot of an A/B journal (save_journal.h) so a torn write never loses
+// the previous save.
+// Snapshots the state and returns; the write happens on the background task.
+// Always queues a write; use for resets and other must-persist points.
 void saveState(const PetState &pet);
 
+// Autosave path: writes only if the blob differs from the last one on flash.
+// Returns true when a write happened.
+bool saveStateIfChanged(const PetState &pet);
+
+// Schedule a debounced save (settings changes). Serviced by persistUpdate().
+void persistRequestSave(unsigned long now);
+void persistUpdate(const PetState &pet, unsigned long now);
+
+// Wait until every queued save has reached flash (shutdown paths).
+// Returns false on timeout or if the last write failed.
+bool persistFlush(uint32_t timeoutMs);
+
 // Load pet state + user settings from NVS.
-// On first boot (no saved data), writes defaults.
+// Takes the newest valid journal slot; falls back to the legacy formats, then
+// to defaults (first boot or both slots corrupt).
 void loadState(PetState &pet);
+
+// Known-places database (wifiPlaces). Save snapshots it for the background
+// writer; never writes flash on the caller's task. Structural changes (dirty)
+// go out with the next call, visit counts and signature drift (touched) at
+// most every PERSIST_PLACES_REFRESH_MS, so a pet sitting at home does not
+// rewrite the blob on every autosave.
+#define PERSIST_PLACES_REFRESH_MS  (6UL * 60 * 60 * 1000)
+
+void savePlaces(unsigned long now);
+void loadPlaces();
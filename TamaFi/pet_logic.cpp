@@ -18,6 +18,8 @@ static const unsigned long REST_MAX_MS         = 15000;
 static const uint32_t DECISION_INTERVAL_MIN = 8000;
 static const uint32_t DECISION_INTERVAL_MAX = 15000;
 
+static const unsigned long NEW_PLACE_EXCITED_MS = 120000;
+
 // ============ Queue helpers ============
 
 static void pushEvent(PetState &s, PetEvent evt) {
@@ -59,6 +61,7 @@ static void resetStats(PetState &s, bool full, unsigned long now) {
     }
 
     s.lastWifi         = WifiStats();
+    s.wifiEnv          = WifiEnvSmoothed();
     s.lastWifiScanTime = 0;
     s.wifiResultReady  = false;
 
@@ -75,8 +78,12 @@ static void resetStats(PetState &s, bool full, unsigned long now) {
 }
 
 // ============ Internal: mood ============
+// Environment-driven moods use the smoothed model, so a single noisy scan
+// does not flip the pet between BORED and EXCITED.
 
 static void updateMood(PetState &s, unsigned long now) {
+    const WifiEnvSmoothed &env = s.wifiEnv;
+
     if (s.pet.health < 25 ||
         (s.lastWifi.netCount == 0 && s.lastWifiScanTime > 0 &&
          now - s.lastWifiScanTime > 60000)) {
@@ -89,22 +96,35 @@ static void updateMood(PetState &s, unsigned long now) {
         return;
     }
 
-    if (s.pet.happiness > 80 && s.lastWifi.netCount > 8) {
+    // Fresh surroundings are exciting; home is calming (below)
+    if (s.newPlaceTime > 0 && now - s.newPlaceTime < NEW_PLACE_EXCITED_MS &&
+        s.pet.happiness > 50) {
         s.mood = MOOD_EXCITED;
         return;
     }
 
-    if (s.pet.happiness > 60 && s.lastWifi.netCount > 0) {
+    if (s.pet.happiness > 80 && env.netCount > 8.f) {
+        s.mood = MOOD_EXCITED;
+        return;
+    }
+
+    if (s.pet.happiness > 60 && env.netCount >= 0.5f) {
         s.mood = MOOD_HAPPY;
         return;
     }
 
-    if (s.lastWifi.netCount == 0 && now - s.lastWifiScanTime > 30000) {
+    if (env.netCount < 0.5f && now - s.lastWifiScanTime > 30000) {
         s.mood = MOOD_BORED;
         return;
     }
 
-    if (s.lastWifi.hiddenCount > 0 || s.lastWifi.openCount > 0) {
+    if (s.place == PLACE_HOME) {
+        s.mood = MOOD_CALM;
+        return;
+    }
+
+    // Expected hidden+open networks per scan, or something coming closer
+    if ((env.hiddenRatio + env.openRatio) * env.netCount >= 0.5f || env.approaching > 0) {
         s.mood = MOOD_CURIOUS;
         return;
     }
@@ -298,6 +318,30 @@ static void decideNextActivity(PetState &s, unsigned long now) {
     }
 }
 
+// ============ Internal: reactions to sound ============
+
+// Cut rest short; the wake animation starts from the current frame.
+static bool interruptRest(PetState &s, unsigned long now) {
+    if (s.activity != ACT_REST || (s.restPhase != REST_ENTER && s.restPhase != REST_DEEP)) return false;
+    s.restPhase        = REST_WAKE;
+    s.restPhaseStart   = now;
+    s.lastRestAnimTime = now;
+    pushEvent(s, PET_EVT_REST_END);
+    return true;
+}
+
+static void startle(PetState &s, unsigned long now) {
+    interruptRest(s, now);
+    s.pet.happiness = constrain(s.pet.happiness - (1 + s.traitStress / 40), 0, 100);
+    pushEvent(s, PET_EVT_STARTLED);
+}
+
+static void answerCall(PetState &s, unsigned long now) {
+    if (interruptRest(s, now)) return;
+    s.pet.happiness = constrain(s.pet.happiness + 2, 0, 100);
+    pushEvent(s, PET_EVT_CALLED);
+}
+
 // ============ Internal: process command queue ============
 
 static void processCommands(PetState &s, unsigned long now) {
@@ -310,6 +354,12 @@ static void processCommands(PetState &s, unsigned long now) {
             case PET_CMD_RESET_FULL:
                 resetStats(s, true, now);
                 break;
+            case PET_CMD_STARTLE:
+                if (!s.isDead) startle(s, now);
+                break;
+            case PET_CMD_WAKE:
+                if (!s.isDead) answerCall(s, now);
+                break;
             default:
                 break;
         }
@@ -354,9 +404,13 @@ void petInit(PetState &s, unsigned long now) {
     s.currentDecisionInterval = 10000;
 
     s.lastWifi         = WifiStats();
+    s.wifiEnv          = WifiEnvSmoothed();
     s.lastWifiScanTime = 0;
     s.wifiResultReady  = false;
 
+    s.place        = PLACE_UNKNOWN;
+    s.newPlaceTime = 0;
+
     s.isDead = false;
 
     s.cmdHead = s.cmdTail = 0;
@@ -464,8 +518,24 @@ PetEvent petPollEvent(PetState &s) {
     return evt;
 }
 
-void petInjectWifiResult(PetState &s, const WifiStats &wifi, unsigned long now) {
+void petInjectWifiResult(PetState &s, const WifiStats &wifi,
+                         const WifiEnvSmoothed &env, unsigned long now) {
     s.lastWifi         = wifi;
+    s.wifiEnv          = env;
     s.lastWifiScanTime = now;
     s.wifiResultReady  = true;
 }
+
+void petInjectWifiEnv(PetState &s, const WifiEnvSmoothed &env) {
+    s.wifiEnv = env;
+}
+
+void petInjectPlace(PetState &s, PlaceKind place, unsigned long now) {
+    if (place == PLACE_UNKNOWN) return;     // too few networks — keep last guess
+
+    s.place = place;
+    if (place == PLACE_NEW) {
+        s.newPlaceTime = now;
+        pushEvent(s, PET_EVT_NEW_PLACE);
+    }
+}
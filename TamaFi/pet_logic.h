@@ -1,6 +1,9 @@
 #pragma once
 
 #include <Arduino.h>
+#include "wifi_env.h"        // WifiEnvSmoothed
+#include "wifi_ingest.h"     // WifiStats, WifiNetworkInfo, MAX_WIFI_LIST
+#include "wifi_places.h"     // PlaceKind
 
 // ============ Pet behavior enums ============
 
@@ -35,25 +38,6 @@ enum RestPhase {
     REST_WAKE
 };
 
-// ============ WiFi data types (used by pet logic and wifi_service) ============
-
-struct WifiStats {
-    int netCount    = 0;
-    int strongCount = 0;
-    int hiddenCount = 0;
-    int avgRSSI     = -100;
-    int openCount   = 0;
-    int wpaCount    = 0;
-};
-
-const int MAX_WIFI_LIST = 12;
-
-struct WifiNetworkInfo {
-    String ssid;
-    int    rssi;
-    bool   isOpen;
-};
-
 // ============ Pet core data ============
 
 struct Pet {
@@ -72,6 +56,8 @@ enum PetCommand {
     PET_CMD_NONE = 0,
     PET_CMD_RESET,         // reset stats, keep age/stage/traits
     PET_CMD_RESET_FULL,    // full reset: stats + age + stage + re-randomize traits
+    PET_CMD_STARTLE,       // clap / loud noise heard: jolt awake, a little upset
+    PET_CMD_WAKE,          // whistle heard: wake gently, or come when called
 };
 
 // ============ Events (pet -> orchestrator) ============
@@ -87,6 +73,9 @@ enum PetEvent {
     PET_EVT_WIFI_REQUEST,  // pet wants a WiFi scan (hunt or discover)
     PET_EVT_DEATH,         // pet died (hunger+happiness+health == 0)
     PET_EVT_ACTIVITY_END,  // activity finished, back to idle
+    PET_EVT_NEW_PLACE,     // scan fingerprint matched no known place
+    PET_EVT_STARTLED,      // PET_CMD_STARTLE handled
+    PET_EVT_CALLED,        // PET_CMD_WAKE while awake: pet answers
 };
 
 // ============ Ring buffer size ============
@@ -131,9 +120,14 @@ struct PetState {
     uint32_t      currentDecisionInterval;
 
     // --- WiFi data (injected by orchestrator) ---
-    WifiStats     lastWifi;
-    unsigned long lastWifiScanTime;
-    bool          wifiResultReady;
+    WifiStats       lastWifi;      // raw last scan (feeding)
+    WifiEnvSmoothed wifiEnv;       // smoothed environment (mood)
+    unsigned long   lastWifiScanTime;
+    bool            wifiResultReady;
+
+    // --- Location (injected by orchestrator) ---
+    PlaceKind       place;
+    unsigned long   newPlaceTime;   // last time an unknown place was learned (0 = never)
 
     // --- Death flag ---
     bool isDead;
@@ -168,4 +162,12 @@ PetEvent petPollEvent(PetState &state);
 void petFlushCommands(PetState &state, unsigned long now);
 
 // Inject WiFi scan result (called by orchestrator when wifi scan completes).
-void petInjectWifiResult(PetState &state, const WifiStats &wifi, unsigned long now);
+// wifi: raw stats of this scan; env: smoothed environment after folding it in.
+void petInjectWifiResult(PetState &state, const WifiStats &wifi,
+                         const WifiEnvSmoothed &env, unsigned long now);
+
+// Update smoothed environment only (passive sensing between scans).
+void petInjectWifiEnv(PetState &state, const WifiEnvSmoothed &env);
+
+// Inject location fingerprint result of the same scan.
+void petInjectPlace(PetState &state, PlaceKind place, unsigned long now);
@@ -0,0 +1,41 @@
+#include "power_guard.h"
+
+uint32_t PmicEventScript::take(unsigned long now) {
+    uint32_t events = 0;
+    while (_next < _count && now >= _steps[_next].atMs) {
+        events |= _steps[_next].events;
+        _next++;
+    }
+    return events;
+}
+
+void powerGuardInit(PowerGuard &g) {
+    g.emergency = false;
+    g.warned    = false;
+}
+
+PowerAction powerGuardStep(PowerGuard &g, uint32_t events, bool usbPowered) {
+    if (events & PMIC_EVT_VBUS_IN) {
+        usbPowered = true;
+        g.warned   = false;
+    }
+    if (events & PMIC_EVT_VBUS_OUT) usbPowered = false;
+
+    if (g.emergency) {
+        if (!usbPowered) return PWR_ACT_NONE;
+        g.emergency = false;
+        return PWR_ACT_RESUME;
+    }
+
+    if (events & (PMIC_EVT_LOW_CRIT | PMIC_EVT_PKEY_LONG)) {
+        if (usbPowered) return PWR_ACT_SAVE;
+        g.emergency = true;
+        return PWR_ACT_EMERGENCY;
+    }
+
+    if ((events & PMIC_EVT_LOW_WARN) && !g.warned) {
+        g.warned = true;
+        return PWR_ACT_SAVE;
+    }
+    return PWR_ACT_NONE;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ============ PMIC events ============
+//
+// Bitmask of power events since the last take(). The AXP2101 backend lives in
+// battery.cpp (IRQ pin or IRQ status polling); PmicEventScript replays a fixed
+// timeline so the emergency path can run off-device.
+
+#define PMIC_EVT_LOW_WARN   (1u << 0)   // battery dropped below warning level 1
+#define PMIC_EVT_LOW_CRIT   (1u << 1)   // warning level 2 — cell is about to give out
+#define PMIC_EVT_PKEY_LONG  (1u << 2)   // power key held — PMIC hard-off follows
+#define PMIC_EVT_VBUS_IN    (1u << 3)
+#define PMIC_EVT_VBUS_OUT   (1u << 4)
+
+class PmicEventSource {
+public:
+    virtual ~PmicEventSource() {}
+
+    // Events raised since the previous call (PMIC_EVT_*), 0 if none.
+    virtual uint32_t take(unsigned long now) = 0;
+};
+
+struct PmicScriptStep {
+    unsigned long atMs;
+    uint32_t      events;
+};
+
+// Simulated PMIC: each step fires once when now >= atMs (steps sorted by time).
+class PmicEventScript : public PmicEventSource {
+public:
+    PmicEventScript(const PmicScriptStep *steps, size_t count) : _steps(steps), _count(count), _next(0) {}
+    uint32_t take(unsigned long now) override;
+    void rewind() { _next = 0; }
+
+private:
+    const PmicScriptStep *_steps;
+    size_t                _count;
+    size_t                _next;
+};
+
+// ============ Power guard ============
+//
+// Turns PMIC events into orchestrator actions:
+//   LOW_WARN              -> one early save per discharge
+//   LOW_CRIT / PKEY_LONG  -> emergency: bounded save, then display + radio off
+//   VBUS_IN               -> leave emergency, re-arm the warning
+// On USB power a critical level or long press only saves.
+
+// Time budget for the emergency save to reach flash.
+#define POWER_EMERGENCY_SAVE_MS  200
+
+enum PowerAction {
+    PWR_ACT_NONE,
+    PWR_ACT_SAVE,
+    PWR_ACT_EMERGENCY,
+    PWR_ACT_RESUME
+};
+
+struct PowerGuard {
+    bool emergency;
+    bool warned;
+};
+
+void powerGuardInit(PowerGuard &g);
+
+// usbPowered: VBUS present per the last battery poll.
+PowerAction powerGuardStep(PowerGuard &g, uint32_t events, bool usbPowered);
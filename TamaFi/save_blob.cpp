@@ -0,0 +1,126 @@
+#include "save_blob.h"
+#include <string.h>
+
+// Nibble table: 16 words instead of 256, fast enough for a few dozen bytes.
+static const uint32_t CRC_NIBBLE[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+uint32_t crc32Update(uint32_t crc, const void *data, size_t len) {
+    const uint8_t *p = (const uint8_t*)data;
+    crc = ~crc;
+    while (len--) {
+        crc ^= *p++;
+        crc = (crc >> 4) ^ CRC_NIBBLE[crc & 0x0F];
+        crc = (crc >> 4) ^ CRC_NIBBLE[crc & 0x0F];
+    }
+    return ~crc;
+}
+
+// ============ Version-independent header / trailer ============
+
+static const size_t HDR_LEN = 4;   // magic(2) version(1) size(1)
+static const size_t CRC_LEN = 4;
+
+void saveBlobSealAs(void *img, size_t len, uint8_t version) {
+    uint8_t *p = (uint8_t*)img;
+    p[0] = (uint8_t)(SAVE_BLOB_MAGIC & 0xFF);
+    p[1] = (uint8_t)(SAVE_BLOB_MAGIC >> 8);
+    p[2] = version;
+    p[3] = (uint8_t)len;
+
+    uint32_t crc = crc32Calc(p, len - CRC_LEN);
+    memcpy(p + len - CRC_LEN, &crc, CRC_LEN);
+}
+
+// Returns the image version, 0 if header or CRC is wrong.
+static uint8_t imageVersion(const uint8_t *p, size_t len) {
+    if (len < HDR_LEN + CRC_LEN || len > SAVE_IMAGE_MAX)                  return 0;
+    if (p[0] != (SAVE_BLOB_MAGIC & 0xFF) || p[1] != (SAVE_BLOB_MAGIC >> 8)) return 0;
+    if (p[3] != len)                                                      return 0;
+
+    uint32_t crc;
+    memcpy(&crc, p + len - CRC_LEN, CRC_LEN);
+    return crc == crc32Calc(p, len - CRC_LEN) ? p[2] : 0;
+}
+
+bool saveBlobValid(const SaveBlob &b, size_t len) {
+    return len == sizeof(SaveBlob) && imageVersion((const uint8_t*)&b, len) == SAVE_BLOB_VERSION;
+}
+
+// ============ v0 per-key layout ============
+
+size_t saveBlobFromLegacy(const SaveLegacyKeys &k, uint8_t *img) {
+    SaveBlob a;
+    memset(&a, 0, sizeof(a));
+    a.hunger             = (int16_t)k.hunger;
+    a.happiness          = (int16_t)k.happy;
+    a.health             = (int16_t)k.health;
+    a.ageTotalMin        = k.ageDay * 1440UL + k.ageHr * 60UL + k.ageMin;
+    a.stage              = k.stage;
+    a.hatched            = k.hatched ? 1 : 0;
+    a.soundVolume        = k.sndVol;
+    a.tftBrightnessIndex = k.tftBri;
+    a.petSkin            = k.petSkin;
+    a.wifiPassive        = k.passive;
+    a.traitCuriosity     = k.tCur;
+    a.traitActivity      = k.tAct;
+    a.traitStress        = k.tStr;
+    a.autoSleepMs        = k.sleepMs;
+    a.autoSaveSec        = k.saveMs;
+    saveBlobSealAs(&a, sizeof(a), 1);
+
+    memcpy(img, &a, sizeof(a));
+    return sizeof(a);
+}
+
+// ============ Migrations (N -> N+1) ============
+//
+// Each step reads a valid image of version `from` and writes a sealed image of
+// version from+1. Never edit a shipped step; add a new one and bump the version.
+
+typedef size_t (*SaveMigrateFn)(const uint8_t *in, size_t inLen, uint8_t *out);
+
+struct SaveMigration {
+    uint8_t       from;
+    size_t        inSize;
+    SaveMigrateFn fn;
+};
+
+// v1 is the only blob layout so far. The first change adds
+// { 1, sizeof(SaveBlobV1), migrate1to2 } here.
+static const SaveMigration MIGRATIONS[] = {
+    { 0, 0, nullptr },          // placeholder: no empty arrays in C++, skipped by findStep()
+};
+
+static const SaveMigration *findStep(uint8_t from) {
+    for (const SaveMigration &m : MIGRATIONS) {
+        if (m.fn && m.from == from) return &m;
+    }
+    return nullptr;
+}
+
+uint8_t saveBlobUpgrade(const void *img, size_t len, SaveBlob &out) {
+    uint8_t buf[SAVE_IMAGE_MAX];
+    uint8_t tmp[SAVE_IMAGE_MAX];
+
+    uint8_t stored = imageVersion((const uint8_t*)img, len);
+    if (stored == 0 || stored > SAVE_BLOB_VERSION) return 0;
+    memcpy(buf, img, len);
+
+    uint8_t ver = stored;
+    while (ver < SAVE_BLOB_VERSION) {
+        const SaveMigration *m = findStep(ver);
+        if (!m || len != m->inSize) return 0;
+
+        len = m->fn(buf, len, tmp);
+        if (imageVersion(tmp, len) != ver + 1) return 0;
+        memcpy(buf, tmp, len);
+        ver++;
+    }
+
+    if (len != sizeof(SaveBlob)) return 0;
+    memcpy(&out, buf, sizeof(out));
+    return stored;
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ============ Packed save format ============
+//
+// Whole pet state + user settings in one fixed-width little-endian struct,
+// written with a single putBytes(). Header carries magic/version/size, the
+// trailing CRC32 covers everything before it. Zero hardware deps, so save
+// images can be produced and checked on the host.
+//
+// Every layout ever shipped keeps the same 4-byte header and 4-byte CRC
+// trailer; only the fields in between change. Old data is brought up to
+// SAVE_BLOB_VERSION by a chain of N -> N+1 steps (see saveBlobUpgrade()):
+//   v0  per-key NVS layout (read by persistence.cpp, packed by saveBlobFromLegacy())
+//   v1  first blob (SaveBlob below)
+// When the layout changes: copy SaveBlob to a frozen SaveBlobV<N>, let
+// saveBlobFromLegacy() keep producing that, bump SAVE_BLOB_VERSION and add the
+// N -> N+1 step to the table in save_blob.cpp.
+
+#define SAVE_BLOB_MAGIC    0x4654      // "TF"
+#define SAVE_BLOB_VERSION  1
+
+// Largest image of any version (migration scratch buffers).
+#define SAVE_IMAGE_MAX     64
+
+// ---------- v0 (historical, read-only) ----------
+
+// Values of the per-key layout, NVS defaults already applied by the reader.
+struct SaveLegacyKeys {
+    int32_t  hunger, happy, health;
+    uint32_t ageMin, ageHr, ageDay;
+    uint8_t  stage;
+    bool     hatched;
+    uint8_t  sndVol, tftBri, petSkin, passive;
+    uint8_t  tCur, tAct, tStr;
+    uint32_t sleepMs;
+    uint16_t saveMs;             // despite the key name: seconds
+};
+
+// ---------- current (v1) ----------
+
+struct __attribute__((packed)) SaveBlob {
+    // --- Header ---
+    uint16_t magic;
+    uint8_t  version;
+    uint8_t  size;               // sizeof(SaveBlob) at write time
+
+    // --- Pet ---
+    int16_t  hunger;
+    int16_t  happiness;
+    int16_t  health;
+    uint32_t ageTotalMin;        // age in minutes since hatch
+    uint8_t  stage;
+    uint8_t  hatched;
+    uint8_t  traitCuriosity;
+    uint8_t  traitActivity;
+    uint8_t  traitStress;
+
+    // --- Settings ---
+    uint8_t  soundVolume;
+    uint8_t  tftBrightnessIndex;
+    uint8_t  petSkin;
+    uint8_t  wifiPassive;
+    uint32_t autoSleepMs;
+    uint16_t autoSaveSec;
+
+    // --- Trailer ---
+    uint32_t crc;                // CRC32 of all bytes above
+};
+
+static_assert(sizeof(SaveBlob) == 33, "SaveBlob layout changed — bump SAVE_BLOB_VERSION and add a migration");
+static_assert(sizeof(SaveBlob) <= SAVE_IMAGE_MAX, "raise SAVE_IMAGE_MAX");
+// Image is stored as-is; ESP32-S3 and every host we build on are little-endian.
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "SaveBlob is stored little-endian");
+
+// CRC-32 (IEEE 802.3, reflected, poly 0xEDB88320).
+uint32_t crc32Update(uint32_t crc, const void *data, size_t len);
+inline uint32_t crc32Calc(const void *data, size_t len) { return crc32Update(0, data, len); }
+
+// Fill header and CRC of an image of any version (len = struct size).
+void saveBlobSealAs(void *img, size_t len, uint8_t version);
+inline void saveBlobSeal(SaveBlob &b) { saveBlobSealAs(&b, sizeof(b), SAVE_BLOB_VERSION); }
+
+// Check header, size and CRC of a current-version image read back from flash.
+bool saveBlobValid(const SaveBlob &b, size_t len);
+
+// Pack v0 values as a sealed v1 image so they go through the same migration
+// chain as a stored blob. Returns the image size.
+size_t saveBlobFromLegacy(const SaveLegacyKeys &k, uint8_t *img);
+
+// Validate an image of any known version and migrate it step by step to the
+// current layout. Returns the version it was stored in (SAVE_BLOB_VERSION if
+// no step ran), or 0 if the image is corrupt or of an unknown version.
+uint8_t saveBlobUpgrade(const void *img, size_t len, SaveBlob &out);
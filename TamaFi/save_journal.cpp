@@ -0,0 +1,73 @@
+#include "save_journal.h"
+#include "save_blob.h"      // crc32Update
+#include <string.h>
+
+void journalInit(SaveJournal &j, SaveStore *store) {
+    j.store = store;
+    j.seq   = 0;
+    j.live  = -1;
+}
+
+static uint32_t imageCrc(const JournalHeader &h, const uint8_t *payload) {
+    uint32_t crc = crc32Update(0, &h, offsetof(JournalHeader, crc));
+    return crc32Update(crc, payload, h.len);
+}
+
+// Validate an image read from slot. Returns payload pointer or nullptr.
+static const uint8_t *checkImage(const uint8_t *img, size_t len, uint8_t slot, JournalHeader &h) {
+    if (len < sizeof(JournalHeader)) return nullptr;
+    memcpy(&h, img, sizeof(h));
+    if (h.magic != JOURNAL_MAGIC || h.slot != slot)  return nullptr;
+    if (h.len > JOURNAL_MAX_PAYLOAD)                 return nullptr;
+    if (len != sizeof(JournalHeader) + h.len)        return nullptr;
+
+    const uint8_t *payload = img + sizeof(JournalHeader);
+    return imageCrc(h, payload) == h.crc ? payload : nullptr;
+}
+
+size_t journalLoad(SaveJournal &j, void *buf, size_t cap) {
+    uint8_t       img[JOURNAL_IMAGE_MAX];
+    JournalHeader h;
+    size_t        best = 0;
+
+    j.live = -1;
+    j.seq  = 0;
+
+    for (uint8_t slot = 0; slot < JOURNAL_SLOTS; slot++) {
+        size_t len = j.store->read(slot, img, sizeof(img));
+        const uint8_t *payload = checkImage(img, len, slot, h);
+        if (!payload || h.len > cap) continue;
+
+        // Wrap-safe "newer than"
+        if (j.live < 0 || (int32_t)(h.seq - j.seq) > 0) {
+            memcpy(buf, payload, h.len);
+            best   = h.len;
+            j.live = (int8_t)slot;
+            j.seq  = h.seq;
+        }
+    }
+    return best;
+}
+
+bool journalWrite(SaveJournal &j, const void *payload, size_t len) {
+    if (len > JOURNAL_MAX_PAYLOAD) return false;
+
+    uint8_t target = (j.live == 0) ? 1 : 0;
+
+    uint8_t       img[JOURNAL_IMAGE_MAX];
+    JournalHeader h;
+    h.magic = JOURNAL_MAGIC;
+    h.slot  = target;
+    h.len   = (uint8_t)len;
+    h.seq   = j.seq + 1;
+    h.crc   = imageCrc(h, (const uint8_t*)payload);
+
+    memcpy(img, &h, sizeof(h));
+    memcpy(img + sizeof(h), payload, len);
+
+    if (!j.store->write(target, img, sizeof(h) + len)) return false;
+
+    j.live = (int8_t)target;
+    j.seq  = h.seq;
+    return true;
+}
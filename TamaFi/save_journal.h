@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ============ A/B save journal ============
+//
+// Two slots, each holding [header | payload]. A save always goes to the slot
+// that is NOT currently live, with seq = live seq + 1; the header CRC covers
+// the header and payload. Load takes the valid slot with the newest seq, so a
+// write torn at any byte leaves the previous save in the other slot intact.
+// Storage is behind SaveStore, so the journal runs on the host too.
+
+#define JOURNAL_MAGIC        0x4A53    // "SJ"
+#define JOURNAL_SLOTS        2
+#define JOURNAL_MAX_PAYLOAD  96
+
+struct __attribute__((packed)) JournalHeader {
+    uint16_t magic;
+    uint8_t  slot;       // 0 = A, 1 = B (guards against swapped keys)
+    uint8_t  len;        // payload bytes
+    uint32_t seq;
+    uint32_t crc;        // CRC32 of header up to here + payload
+};
+
+#define JOURNAL_IMAGE_MAX  (sizeof(JournalHeader) + JOURNAL_MAX_PAYLOAD)
+
+// Raw slot storage. write() may be torn by power loss; the journal copes.
+class SaveStore {
+public:
+    virtual ~SaveStore() {}
+
+    // Copy slot image into buf. Returns bytes read, 0 if the slot is empty.
+    virtual size_t read(uint8_t slot, void *buf, size_t cap) = 0;
+
+    virtual bool write(uint8_t slot, const void *buf, size_t len) = 0;
+};
+
+struct SaveJournal {
+    SaveStore *store;
+    uint32_t   seq;      // seq of the live slot (0 = nothing saved yet)
+    int8_t     live;     // live slot, -1 = none valid
+};
+
+void journalInit(SaveJournal &j, SaveStore *store);
+
+// Pick the newest valid slot and copy its payload into buf.
+// Returns payload length, 0 if neither slot is valid.
+size_t journalLoad(SaveJournal &j, void *buf, size_t cap);
+
+// Write payload to the inactive slot; it becomes live only if the write succeeded.
+bool journalWrite(SaveJournal &j, const void *payload, size_t len);
@@ -0,0 +1,9 @@
+#include "sfx.h"
+#include "sfx_assets.h"
+
+static_assert(sizeof(SFX_ASSET_TABLE) / sizeof(SFX_ASSET_TABLE[0]) == SFX_COUNT,
+              "sfx_assets.h out of step with SfxId: re-run tools/adpcm_encode.py");
+
+const AdpcmClip *sfxClip(uint8_t id) {
+    return id < SFX_COUNT ? &SFX_ASSET_TABLE[id] : nullptr;
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <stdint.h>
+#include "adpcm.h"
+
+// ============ Sampled sound effects ============
+//
+// IMA-ADPCM clips in flash (sfx_assets.h, generated by tools/adpcm_encode.py).
+// Order must match the encoder's argument order.
+
+enum SfxId : uint8_t {
+    SFX_CHIRP = 0,     // happy chirp (evolution)
+    SFX_GROWL,         // hungry growl (bad feed)
+    SFX_CRACK,         // egg shell cracking (hatch)
+    SFX_COUNT
+};
+
+// Clip of an effect; nullptr for an unknown id.
+const AdpcmClip *sfxClip(uint8_t id);
@@ -0,0 +1,659 @@
+#pragma once
+
+// Generated by tools/adpcm_encode.py -- do not edit.
+// IMA-ADPCM, 16000 Hz mono, 256-byte blocks. Order matches SfxId (sfx.h).
+
+#include "adpcm.h"
+
+// chirp.wav: 4000 samples (250 ms), 2028 bytes
+static const uint8_t SFX_CHIRP_ADPCM[2028] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x2A, 0x35, 0xB1, 0xCC, 0xAD, 0x75, 0x82, 0xAB, 0xDB,
+    0x69, 0x15, 0xB8, 0xB9, 0x0D, 0x55, 0x91, 0xAA, 0xBB, 0x70, 0x05, 0x99, 0xBA, 0x1A, 0x47, 0x90,
+    0xAA, 0xAB, 0x72, 0x04, 0xAA, 0xB9, 0x3A, 0x47, 0xA8, 0xA9, 0x9B, 0x64, 0x82, 0xAA, 0xBA, 0x69,
+    0x15, 0x99, 0xAA, 0x0B, 0x65, 0x80, 0x9A, 0xBA, 0x61, 0x13, 0xAA, 0xCA, 0x2A, 0x37, 0x98, 0xAA,
+    0xAB, 0x73, 0x84, 0x9A, 0xAA, 0x49, 0x16, 0xA8, 0xA9, 0x0B, 0x45, 0x91, 0xAA, 0xBA, 0x71, 0x04,
+    0x9A, 0xAA, 0x3A, 0x27, 0x98, 0xAA, 0x8B, 0x64, 0x92, 0x9A, 0xAB, 0x68, 0x14, 0x9A, 0xAA, 0x1A,
+    0x37, 0x98, 0xAA, 0x9B, 0x64, 0x92, 0x9A, 0xBA, 0x60, 0x04, 0xA9, 0xA9, 0x1A, 0x37, 0xA8, 0xA9,
+    0x9B, 0x55, 0x91, 0xA9, 0xAA, 0x60, 0x13, 0xAA, 0xBA, 0x4A, 0x26, 0xA8, 0xAA, 0x0B, 0x46, 0x90,
+    0x9A, 0x9B, 0x72, 0x93, 0x9A, 0xBA, 0x60, 0x04, 0xA9, 0xB9, 0x29, 0x27, 0xA8, 0xA9, 0x0B, 0x36,
+    0xA1, 0xAA, 0xAB, 0x55, 0x92, 0xAA, 0xBA, 0x72, 0x83, 0xAA, 0xB9, 0x58, 0x05, 0x99, 0xAA, 0x29,
+    0x27, 0x99, 0xAA, 0x1A, 0x27, 0x98, 0x9A, 0x0B, 0x45, 0x90, 0xAA, 0x9A, 0x54, 0x81, 0xAA, 0x9B,
+    0x72, 0x82, 0xAA, 0xAA, 0x71, 0x02, 0xAA, 0xAA, 0x70, 0x02, 0x9A, 0xAA, 0x68, 0x03, 0xAA, 0xAA,
+    0x58, 0x05, 0xA9, 0xB9, 0x48, 0x15, 0x9A, 0xAA, 0x49, 0x06, 0x99, 0xA9, 0x49, 0x14, 0x9A, 0xBA,
+    0x48, 0x06, 0x99, 0xAA, 0x48, 0x05, 0xA9, 0xA9, 0x48, 0x05, 0x9A, 0xAA, 0x50, 0x84, 0xA9, 0xAA,
+    0x61, 0x82, 0xA9, 0xAA, 0x72, 0x92, 0x9A, 0xAA, 0x54, 0xA1, 0xA9, 0x8A, 0x45, 0xA0, 0xA9, 0x1B,
+    0x26, 0xA8, 0xA9, 0x2A, 0x27, 0xA9, 0xB9, 0x48, 0x05, 0x9A, 0xAA, 0x61, 0x82, 0xAA, 0x9A, 0x73,
+    0xD0, 0x60, 0x57, 0x00, 0x99, 0xAA, 0x50, 0x83, 0xAA, 0xAA, 0x54, 0xA1, 0xA9, 0x1B, 0x26, 0xA8,
+    0xB9, 0x49, 0x15, 0xAA, 0xAA, 0x71, 0x92, 0x9A, 0x8A, 0x54, 0x98, 0xAA, 0x39, 0x06, 0x99, 0xAA,
+    0x61, 0x92, 0x9A, 0x0B, 0x35, 0xA8, 0xBA, 0x59, 0x05, 0x9A, 0xAA, 0x63, 0xA1, 0xA9, 0x1A, 0x17,
+    0xA9, 0xB9, 0x71, 0x81, 0xAA, 0x0A, 0x26, 0x99, 0xBA, 0x60, 0x82, 0xAA, 0x8A, 0x27, 0xA8, 0xBA,
+    0x60, 0x82, 0xAA, 0x8A, 0x27, 0xA8, 0xBA, 0x70, 0x92, 0xAA, 0x1A, 0x17, 0xA9, 0xAA, 0x72, 0xA1,
+    0xA9, 0x3A, 0x07, 0x9A, 0x9B, 0x45, 0xA8, 0xAA, 0x68, 0x82, 0xAA, 0x1B, 0x27, 0xAA, 0x9A, 0x72,
+    0xA0, 0xB9, 0x58, 0x83, 0xBA, 0x1B, 0x27, 0xA9, 0x9B, 0x54, 0xA8, 0xB9, 0x60, 0x92, 0xAA, 0x3A,
+    0x07, 0xAA, 0x0B, 0x26, 0xA9, 0xAA, 0x73, 0xA0, 0xAA, 0x78, 0xA2, 0xAA, 0x49, 0x85, 0xAA, 0x0A,
+    0x17, 0x9A, 0x9B, 0x27, 0xA9, 0xAA, 0x54, 0xA8, 0xAA, 0x71, 0xA1, 0xBA, 0x60, 0x92, 0xBA, 0x59,
+    0x83, 0xAB, 0x4B, 0x86, 0xAA, 0x2A, 0x07, 0xAA, 0x1B, 0x17, 0xAA, 0x0B, 0x17, 0xA9, 0x8B, 0x27,
+    0xAA, 0x9A, 0x27, 0xAA, 0x9A, 0x27, 0xAA, 0x9A, 0x27, 0x9A, 0x8B, 0x26, 0xAA, 0x8A, 0x26, 0xAA,
+    0x8A, 0x17, 0x9A, 0x0B, 0x17, 0xAA, 0x2B, 0x06, 0xAA, 0x3A, 0x86, 0xAA, 0x4A, 0x94, 0xB9, 0x58,
+    0x92, 0xBA, 0x70, 0x90, 0xBA, 0x72, 0xA8, 0x9A, 0x34, 0xB9, 0x9A, 0x27, 0xAA, 0x1A, 0x87, 0xAA,
+    0x49, 0x93, 0xBB, 0x70, 0xA1, 0xAA, 0x63, 0x99, 0x9A, 0x16, 0x9A, 0x3B, 0x85, 0xAA, 0x69, 0x91,
+    0xAA, 0x52, 0xA8, 0x8A, 0x15, 0xAA, 0x4A, 0x94, 0xAA, 0x60, 0xA0, 0x9A, 0x34, 0xAA, 0x2B, 0x87,
+    0xAA, 0x50, 0xA0, 0xA9, 0x15, 0xA9, 0x29, 0x94, 0xAA, 0x70, 0x98, 0x8A, 0x05, 0xA9, 0x49, 0xA2,
+    0x80, 0xE7, 0x54, 0x00, 0x3A, 0x94, 0xBA, 0x72, 0x99, 0x09, 0x84, 0xA9, 0x58, 0xA0, 0x99, 0x15,
+    0xAA, 0x59, 0xA1, 0xA9, 0x15, 0xA9, 0x4A, 0xA2, 0x9A, 0x34, 0xAB, 0x6B, 0xA2, 0xAA, 0x25, 0xAA,
+    0x5A, 0xA2, 0x9A, 0x15, 0xAA, 0x59, 0xA1, 0x8A, 0x05, 0xAA, 0x50, 0xA0, 0x0A, 0x85, 0xAA, 0x42,
+    0xA9, 0x3A, 0xA5, 0x9A, 0x24, 0xAB, 0x79, 0xA0, 0x09, 0x84, 0xAA, 0x42, 0xA9, 0x4A, 0xA2, 0x8B,
+    0x87, 0x99, 0x40, 0x99, 0x3A, 0xB3, 0x9B, 0x07, 0xA9, 0x41, 0xA9, 0x4A, 0xA2, 0x8B, 0x87, 0xA9,
+    0x32, 0xAA, 0x69, 0xA0, 0x1A, 0x94, 0x9A, 0x05, 0x9A, 0x50, 0xA9, 0x49, 0x90, 0x1A, 0x94, 0xAA,
+    0x06, 0x9A, 0x31, 0xAA, 0x79, 0x98, 0x3A, 0xA2, 0x0B, 0x96, 0x99, 0x13, 0xBA, 0x52, 0xAA, 0x68,
+    0xA8, 0x39, 0xA1, 0x2B, 0xA5, 0x8A, 0x86, 0x9A, 0x04, 0xAA, 0x23, 0xBA, 0x61, 0xA9, 0x59, 0xA8,
+    0x49, 0xA0, 0x29, 0xA2, 0x2B, 0xA5, 0x0A, 0x95, 0x9A, 0x86, 0x9A, 0x04, 0x9A, 0x03, 0xAA, 0x14,
+    0xBA, 0x33, 0xCB, 0x52, 0xAA, 0x50, 0xA9, 0x40, 0x9A, 0x58, 0xA9, 0x58, 0x99, 0x38, 0xA9, 0x58,
+    0x99, 0x48, 0x99, 0x59, 0x99, 0x38, 0xA9, 0x50, 0xA9, 0x30, 0xB9, 0x50, 0xA9, 0x40, 0xAA, 0x32,
+    0xBB, 0x43, 0xBB, 0x05, 0x9A, 0x04, 0xAA, 0x85, 0x8A, 0x94, 0x89, 0xA4, 0x19, 0xA2, 0x3A, 0xA1,
+    0x5B, 0xA0, 0x49, 0xA8, 0x48, 0xA9, 0x21, 0xA9, 0x03, 0xAA, 0x96, 0x09, 0x92, 0x19, 0x91, 0x3A,
+    0xA0, 0x38, 0xA9, 0x11, 0x99, 0x02, 0x89, 0x81, 0x08, 0x88, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x90, 0x1A, 0x43, 0xA0, 0xBB, 0x9F, 0x73, 0x82, 0xAB, 0xEB, 0x48, 0x16,
+    0xA8, 0xBA, 0x0D, 0x55, 0x91, 0xAA, 0xBB, 0x70, 0x15, 0x9A, 0xBA, 0x2B, 0x47, 0x90, 0xAA, 0xAB,
+    0x71, 0x85, 0x99, 0xAA, 0x29, 0x27, 0xA0, 0xAA, 0xAB, 0x74, 0x82, 0x9A, 0xBA, 0x49, 0x17, 0x98,
+    0xAA, 0x8A, 0x64, 0x81, 0xAA, 0xBA, 0x60, 0x14, 0xA9, 0xAA, 0x1B, 0x37, 0xA1, 0xAA, 0xAC, 0x72,
+    0x83, 0xA9, 0xBA, 0x3A, 0x37, 0xB0, 0xAA, 0x9B, 0x65, 0x81, 0x9A, 0xBA, 0x58, 0x15, 0x99, 0xAA,
+    0x0B, 0x37, 0x90, 0x9A, 0xBB, 0x72, 0x03, 0xAA, 0xBA, 0x3A, 0x47, 0x98, 0x9A, 0x9B, 0x64, 0x81,
+    0x9A, 0xAA, 0x58, 0x14, 0xA9, 0xAA, 0x1B, 0x37, 0xA1, 0xAA, 0xAB, 0x72, 0x84, 0xA9, 0xB9, 0x49,
+    0x16, 0xA8, 0xA9, 0x8A, 0x45, 0x91, 0xAA, 0xAA, 0x71, 0x83, 0xA9, 0xBA, 0x39, 0x37, 0xA8, 0xAA,
+    0x0C, 0x54, 0x80, 0xAA, 0xAA, 0x71, 0x02, 0xA9, 0xAA, 0x39, 0x27, 0xA8, 0xAA, 0x8A, 0x46, 0x90,
+    0xA9, 0xAA, 0x62, 0x83, 0xAA, 0xBA, 0x58, 0x25, 0xA9, 0xAA, 0x1B, 0x37, 0xA0, 0xAA, 0x9B, 0x64,
+    0x92, 0x9A, 0xAA, 0x68, 0x04, 0xA9, 0xA9, 0x3A, 0x17, 0x98, 0x9A, 0x0B, 0x45, 0x90, 0x9A, 0x9B,
+    0x73, 0x82, 0xAA, 0xAA, 0x60, 0x13, 0xAA, 0xCA, 0x39, 0x17, 0xA8, 0xA9, 0x1A, 0x45, 0xA0, 0xA9,
+    0x8B, 0x54, 0x91, 0xA9, 0xBA, 0x72, 0x83, 0xAA, 0xAA, 0x68, 0x13, 0xAA, 0xBA, 0x5A, 0x25, 0xA9,
+    0xAA, 0x1A, 0x37, 0xA8, 0xA9, 0x8B, 0x46, 0x90, 0x9A, 0x9B, 0x54, 0x91, 0xA9, 0xAA, 0x72, 0x82,
+    0xE8, 0x11, 0x4E, 0x00, 0xA9, 0x0A, 0x26, 0x90, 0xAA, 0x8A, 0x45, 0xA1, 0xAA, 0x9A, 0x64, 0x91,
+    0x9A, 0x9A, 0x72, 0x81, 0x9A, 0xAA, 0x62, 0x82, 0x9A, 0xBA, 0x71, 0x82, 0xA9, 0xB9, 0x60, 0x03,
+    0xAA, 0xBA, 0x60, 0x84, 0x99, 0xAA, 0x58, 0x04, 0x9A, 0xAA, 0x58, 0x04, 0x9A, 0xAA, 0x58, 0x04,
+    0xA9, 0xAA, 0x58, 0x04, 0xA9, 0xAA, 0x58, 0x04, 0xA9, 0xBA, 0x60, 0x03, 0xAA, 0xBA, 0x70, 0x83,
+    0x9A, 0xBA, 0x70, 0x83, 0xAA, 0xAA, 0x62, 0x93, 0xAA, 0xAA, 0x72, 0x82, 0xAA, 0xAA, 0x54, 0x91,
+    0x9A, 0x8B, 0x54, 0xA1, 0x9A, 0x0B, 0x36, 0xA8, 0xAA, 0x1A, 0x27, 0xA8, 0xB9, 0x39, 0x17, 0xA9,
+    0xA9, 0x48, 0x04, 0xA9, 0xBA, 0x71, 0x82, 0x9A, 0xAA, 0x73, 0x91, 0x9A, 0x8A, 0x44, 0xA0, 0xA9,
+    0x2B, 0x27, 0xA9, 0xA9, 0x49, 0x14, 0xAA, 0xAA, 0x70, 0x82, 0x9A, 0x9B, 0x54, 0x90, 0xA9, 0x0A,
+    0x26, 0xA8, 0xAA, 0x49, 0x05, 0xA9, 0xA9, 0x61, 0x92, 0x9A, 0x8B, 0x45, 0x98, 0xAA, 0x29, 0x16,
+    0xA9, 0xB9, 0x70, 0x82, 0xAA, 0x8A, 0x44, 0xA0, 0xB9, 0x3A, 0x17, 0xA9, 0xA9, 0x60, 0x92, 0xA9,
+    0x8A, 0x35, 0xA8, 0xBA, 0x49, 0x06, 0xA9, 0xA9, 0x62, 0x91, 0x9A, 0x1B, 0x17, 0xA8, 0xAA, 0x60,
+    0x82, 0xAA, 0x8A, 0x35, 0xA8, 0xBA, 0x69, 0x84, 0x9A, 0x9A, 0x54, 0x98, 0xAA, 0x49, 0x04, 0xAA,
+    0x9A, 0x54, 0xA0, 0xB9, 0x49, 0x05, 0xAA, 0x9A, 0x44, 0xA0, 0xB9, 0x49, 0x05, 0xAA, 0x8A, 0x44,
+    0xA0, 0xBA, 0x69, 0x83, 0xAA, 0x8A, 0x26, 0xA8, 0xAA, 0x60, 0x92, 0xAA, 0x1A, 0x17, 0xA9, 0x9A,
+    0x72, 0x90, 0xAA, 0x39, 0x07, 0xAA, 0x8B, 0x36, 0xA9, 0xAA, 0x70, 0x92, 0xBA, 0x3A, 0x17, 0xAA,
+    0x8B, 0x54, 0xA8, 0xAA, 0x60, 0x92, 0xAA, 0x2A, 0x07, 0xA9, 0x8B, 0x35, 0xB8, 0xBA, 0x71, 0x92,
+    0x32, 0xF8, 0x56, 0x00, 0x9A, 0x44, 0xA8, 0xAA, 0x70, 0x91, 0xAA, 0x4A, 0x05, 0xAA, 0x0B, 0x17,
+    0xA9, 0x9A, 0x73, 0xA8, 0xB9, 0x70, 0xA2, 0xAA, 0x49, 0x85, 0xAA, 0x2B, 0x07, 0x9A, 0x8B, 0x26,
+    0xA9, 0xAA, 0x54, 0xB0, 0xB9, 0x71, 0xA1, 0xBA, 0x78, 0x92, 0xBA, 0x49, 0x85, 0xAA, 0x2A, 0x07,
+    0xAA, 0x0B, 0x27, 0xAA, 0x8B, 0x26, 0xA9, 0xAA, 0x45, 0xA9, 0x9A, 0x63, 0xA8, 0xAA, 0x72, 0xA0,
+    0xBA, 0x71, 0xA1, 0xBA, 0x70, 0x91, 0xBA, 0x78, 0xA2, 0xBA, 0x78, 0xA2, 0xAA, 0x79, 0x92, 0xAB,
+    0x69, 0xA3, 0xAA, 0x69, 0x92, 0xBA, 0x68, 0x92, 0xBA, 0x68, 0xA2, 0xB9, 0x68, 0xA2, 0xAA, 0x78,
+    0xA1, 0xB9, 0x70, 0xA1, 0xBA, 0x71, 0xA0, 0xB9, 0x72, 0xA8, 0xAA, 0x44, 0xA8, 0xAA, 0x35, 0xA9,
+    0x8B, 0x26, 0xAA, 0x1B, 0x16, 0xAA, 0x2A, 0x86, 0xAA, 0x49, 0x93, 0xBA, 0x79, 0xA2, 0xAA, 0x61,
+    0xA0, 0xAA, 0x44, 0x99, 0x8B, 0x25, 0xAA, 0x1A, 0x06, 0xAA, 0x4A, 0x94, 0xAA, 0x68, 0xA1, 0xAA,
+    0x62, 0xA8, 0x8A, 0x34, 0xBA, 0x1A, 0x07, 0xAA, 0x49, 0xA3, 0xBA, 0x71, 0xA0, 0x9A, 0x34, 0xAA,
+    0x1B, 0x07, 0xAA, 0x59, 0xA2, 0xAA, 0x62, 0xA8, 0x8A, 0x15, 0xAA, 0x39, 0x94, 0xBA, 0x70, 0xA0,
+    0x99, 0x24, 0xAA, 0x2A, 0x86, 0xAA, 0x50, 0xA0, 0x9A, 0x25, 0xAA, 0x3A, 0x95, 0xAA, 0x61, 0x98,
+    0x8A, 0x14, 0xAA, 0x5A, 0x92, 0xBA, 0x63, 0x99, 0x0A, 0x85, 0xA9, 0x58, 0x90, 0x9A, 0x15, 0xAA,
+    0x49, 0xA2, 0xAA, 0x44, 0x9A, 0x3B, 0x95, 0xAA, 0x61, 0xA8, 0x1A, 0x85, 0x9A, 0x58, 0xA0, 0x0A,
+    0x04, 0xAA, 0x68, 0xA0, 0x89, 0x04, 0xA9, 0x69, 0xA0, 0x89, 0x04, 0xA9, 0x69, 0xA0, 0x89, 0x04,
+    0x9A, 0x58, 0xA0, 0x0A, 0x85, 0xA9, 0x50, 0xA8, 0x1A, 0x85, 0xAA, 0x51, 0x99, 0x2A, 0x94, 0xAA,
+    0x8E, 0x02, 0x50, 0x00, 0xA3, 0xAB, 0x26, 0xAB, 0x69, 0x90, 0x8A, 0x05, 0xAA, 0x41, 0xA8, 0x3B,
+    0xA5, 0xA9, 0x24, 0xBA, 0x79, 0xA0, 0x09, 0x84, 0xAA, 0x42, 0xA9, 0x5A, 0xA1, 0x8A, 0x86, 0xA9,
+    0x41, 0x99, 0x3A, 0xB3, 0x9B, 0x07, 0x9A, 0x41, 0xA9, 0x4A, 0xA2, 0x8B, 0x87, 0xA9, 0x32, 0xAA,
+    0x6A, 0x90, 0x0A, 0x95, 0xA9, 0x14, 0xAA, 0x50, 0xA8, 0x3A, 0xA3, 0x9B, 0x07, 0xAA, 0x42, 0xAA,
+    0x58, 0x98, 0x2A, 0xA3, 0x9B, 0x07, 0xAA, 0x33, 0xBB, 0x78, 0x98, 0x3A, 0xB2, 0x0A, 0x97, 0x99,
+    0x13, 0xBA, 0x52, 0xAA, 0x69, 0x98, 0x3A, 0xA2, 0x0B, 0x97, 0x99, 0x04, 0xAA, 0x32, 0xBA, 0x60,
+    0xA8, 0x5A, 0xA0, 0x29, 0xA2, 0x0B, 0x97, 0x99, 0x04, 0xAA, 0x23, 0xAB, 0x61, 0x9A, 0x58, 0x99,
+    0x49, 0x98, 0x3A, 0xB2, 0x2B, 0xA6, 0x0A, 0x95, 0x8A, 0x85, 0x9A, 0x04, 0xAA, 0x23, 0xBB, 0x53,
+    0xBA, 0x51, 0xAA, 0x50, 0xA9, 0x58, 0x99, 0x49, 0x98, 0x4A, 0xA0, 0x39, 0xA1, 0x4B, 0xB2, 0x3B,
+    0xB4, 0x3B, 0xB5, 0x1A, 0xA5, 0x0A, 0xA6, 0x09, 0xA4, 0x09, 0xA4, 0x89, 0x95, 0x0A, 0x93, 0x8A,
+    0x96, 0x0A, 0x93, 0x8A, 0x96, 0x0A, 0x93, 0x1B, 0xA5, 0x1A, 0xA4, 0x1A, 0xA4, 0x1A, 0xA3, 0x3C,
+    0xB2, 0x5B, 0xA1, 0x5B, 0xA0, 0x49, 0xA8, 0x59, 0xA8, 0x48, 0x99, 0x48, 0xA9, 0x40, 0xAA, 0x22,
+    0xAA, 0x13, 0xBB, 0x07, 0x9A, 0x84, 0x8A, 0x94, 0x1A, 0xB3, 0x3A, 0xB2, 0x6B, 0xA0, 0x49, 0x99,
+    0x30, 0xAA, 0x22, 0xAB, 0x05, 0xAA, 0x85, 0x0A, 0xA3, 0x2A, 0xB2, 0x49, 0xA8, 0x48, 0xA9, 0x21,
+    0x9A, 0x83, 0x99, 0x83, 0x1A, 0x91, 0x29, 0x98, 0x28, 0x09, 0x08, 0x08,
+};
+
+// growl.wav: 8800 samples (550 ms), 4463 bytes
+static const uint8_t SFX_GROWL_ADPCM[4463] = {
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x9E, 0x1B, 0xFA, 0x89, 0xD8, 0x81, 0xB2, 0xE1, 0xE0, 0x93, 0x38,
+    0x3F, 0x9C, 0x00, 0x92, 0xC4, 0xD4, 0xA1, 0x12, 0x00, 0xC9, 0x29, 0x2B, 0xA5, 0x82, 0x6D, 0xA8,
+    0x12, 0x2C, 0x6A, 0xA8, 0x5A, 0x80, 0x3B, 0x90, 0xB4, 0x20, 0xF3, 0x03, 0x5C, 0x88, 0x2B, 0x2B,
+    0xA4, 0x8B, 0x42, 0x90, 0x21, 0x09, 0x70, 0x92, 0x8F, 0x93, 0x40, 0x4A, 0x9B, 0x09, 0x26, 0x2E,
+    0x29, 0xC1, 0x12, 0x3C, 0x99, 0x90, 0x12, 0xA8, 0x34, 0x09, 0x87, 0x9B, 0x83, 0xC3, 0x71, 0x8A,
+    0x80, 0x98, 0x52, 0x91, 0x2A, 0xA8, 0x03, 0xFA, 0x04, 0xFF, 0x89, 0x00, 0x08, 0x88, 0x90, 0x82,
+    0x4A, 0x3A, 0x1C, 0x01, 0x88, 0x0A, 0x20, 0x30, 0x0D, 0x7B, 0x0A, 0x84, 0x09, 0xA0, 0x21, 0x0A,
+    0x5C, 0xF3, 0x00, 0x92, 0x59, 0xA9, 0x31, 0x3E, 0x4B, 0x89, 0x82, 0x4B, 0x3C, 0x89, 0x7A, 0x09,
+    0x29, 0xA8, 0x22, 0x3C, 0x49, 0x3D, 0x9A, 0x31, 0x28, 0xAA, 0x7B, 0x4A, 0x4B, 0x80, 0x3C, 0x81,
+    0x9A, 0xB6, 0xA3, 0x11, 0xB0, 0x84, 0x3E, 0xD2, 0x01, 0xB1, 0x02, 0x3A, 0xB2, 0x85, 0x8C, 0x14,
+    0xA9, 0x88, 0xB5, 0x18, 0x09, 0xB3, 0x22, 0x9C, 0x15, 0x4D, 0x98, 0x92, 0x79, 0x2A, 0xFB, 0x8E,
+    0x18, 0x08, 0x88, 0x80, 0x10, 0x8A, 0x01, 0xC2, 0x85, 0x09, 0x0A, 0x01, 0xA0, 0x38, 0xD5, 0x01,
+    0x2A, 0x92, 0x5A, 0xB1, 0x3C, 0x08, 0x88, 0x01, 0x79, 0xA8, 0x61, 0x0F, 0x11, 0x19, 0x3A, 0x2D,
+    0x98, 0x03, 0x89, 0xC5, 0x20, 0x3A, 0x00, 0x8B, 0xB8, 0xB7, 0x85, 0x39, 0xE0, 0x38, 0x98, 0x80,
+    0x23, 0x9A, 0x91, 0xD6, 0x11, 0x88, 0x19, 0x79, 0x1A, 0x6B, 0x88, 0x90, 0xB2, 0x22, 0x2C, 0x8A,
+    0x95, 0x10, 0x99, 0x92, 0x38, 0xCA, 0x06, 0xAA, 0xA5, 0x31, 0x09, 0x5B, 0x0A, 0x11, 0x2C, 0x8C,
+    0x60, 0x32, 0x40, 0x00, 0x5B, 0xC8, 0x94, 0x38, 0x1A, 0x0A, 0xA1, 0x93, 0x79, 0xE1, 0x81, 0x30,
+    0xFF, 0x89, 0x91, 0x80, 0x00, 0x90, 0x08, 0x12, 0x98, 0x80, 0x39, 0xB9, 0xB5, 0xC3, 0xB3, 0x15,
+    0x09, 0xC8, 0x96, 0x90, 0x90, 0x58, 0x5B, 0x89, 0x1A, 0x92, 0x03, 0x80, 0x81, 0xAC, 0xA1, 0x86,
+    0xA2, 0xD5, 0x83, 0x00, 0x18, 0x3D, 0x5B, 0x08, 0x8B, 0x21, 0x09, 0x04, 0xBB, 0x96, 0x2A, 0xA4,
+    0x6C, 0x3A, 0xD0, 0x30, 0x90, 0xA2, 0x48, 0x2E, 0x19, 0x4A, 0x99, 0x08, 0x91, 0x61, 0x3B, 0x1A,
+    0x2B, 0x09, 0x48, 0x93, 0x9B, 0xB7, 0x02, 0x59, 0x0B, 0x88, 0xA3, 0xB6, 0x82, 0xE4, 0x93, 0x89,
+    0x13, 0x3A, 0xC2, 0x99, 0x96, 0x29, 0xE2, 0x01, 0x93, 0xA1, 0x19, 0x58, 0x00, 0xED, 0x9F, 0x08,
+    0x88, 0x91, 0x88, 0x82, 0x1A, 0x59, 0x88, 0x98, 0x81, 0x11, 0x11, 0x1E, 0xC4, 0x02, 0x80, 0x8A,
+    0xA3, 0xA3, 0x19, 0xB7, 0x98, 0x87, 0x80, 0x81, 0x08, 0xD1, 0x32, 0x9A, 0x7A, 0x00, 0x1C, 0x19,
+    0x38, 0x3E, 0x09, 0xC4, 0x91, 0xB2, 0x92, 0x93, 0xA4, 0x3C, 0x31, 0x0E, 0xB2, 0x30, 0xC8, 0x82,
+    0x82, 0x00, 0x40, 0x8C, 0x34, 0x4D, 0x1A, 0xC8, 0x93, 0x81, 0x12, 0xF3, 0x82, 0x29, 0xC1, 0x29,
+    0x12, 0x0C, 0x96, 0x5B, 0x90, 0x20, 0x09, 0x2B, 0x02, 0xB0, 0x9A, 0xA7, 0x97, 0x08, 0x28, 0x8C,
+    0xA4, 0x08, 0x59, 0x88, 0xFF, 0x09, 0x18, 0x98, 0x00, 0x29, 0xA1, 0x80, 0xA2, 0x48, 0x1B, 0x81,
+    0xA8, 0x72, 0xD8, 0x21, 0x9A, 0x03, 0x88, 0x93, 0x3B, 0x10, 0x7C, 0x00, 0x29, 0x8E, 0x10, 0x93,
+    0x98, 0x95, 0x99, 0x28, 0xE3, 0xA5, 0x11, 0x2C, 0x28, 0x09, 0x19, 0x4B, 0x18, 0xB8, 0x21, 0xA7,
+    0x92, 0x82, 0xA0, 0x8A, 0xA2, 0x69, 0x1A, 0x35, 0x2F, 0x88, 0x89, 0x30, 0x5A, 0xD0, 0x94, 0x81,
+    0xAE, 0x19, 0x47, 0x00, 0x00, 0x7A, 0xA8, 0x92, 0x81, 0x39, 0xC1, 0x5A, 0x90, 0x3A, 0x80, 0x1B,
+    0x14, 0x30, 0x4E, 0x99, 0x28, 0x79, 0x99, 0x82, 0xA2, 0x31, 0x1F, 0x18, 0x11, 0xAC, 0x22, 0xF8,
+    0xCF, 0x88, 0x91, 0x18, 0x29, 0x91, 0x88, 0x11, 0xB8, 0xB5, 0x13, 0x88, 0x08, 0xA8, 0x79, 0xB8,
+    0x23, 0x19, 0x10, 0x8F, 0x92, 0x22, 0xC9, 0x01, 0x19, 0x18, 0x95, 0x58, 0xAA, 0xB3, 0x73, 0x1A,
+    0x88, 0xE2, 0xB3, 0x95, 0x19, 0x30, 0x8D, 0x30, 0x89, 0xD5, 0x11, 0x0A, 0x81, 0x38, 0xE1, 0x38,
+    0xA2, 0x89, 0x79, 0x18, 0x2A, 0xB8, 0x24, 0x0F, 0x10, 0x11, 0x2C, 0x3B, 0x6B, 0x18, 0xA9, 0xA2,
+    0x48, 0x0D, 0x81, 0x01, 0x81, 0x19, 0xA9, 0x17, 0x89, 0x3B, 0x2A, 0x21, 0x09, 0x52, 0x2F, 0x0B,
+    0xA6, 0xB2, 0xA3, 0xC3, 0x84, 0x08, 0x29, 0xAA, 0x32, 0x21, 0x8F, 0xB4, 0xA3, 0x29, 0x4A, 0x19,
+    0xF4, 0xCF, 0x09, 0x81, 0x19, 0xA1, 0x92, 0x80, 0x29, 0xD8, 0x95, 0x09, 0x48, 0x19, 0x3C, 0x2B,
+    0x1A, 0x95, 0x89, 0x94, 0xC1, 0x21, 0x99, 0x83, 0xE0, 0xA4, 0x83, 0xC1, 0x28, 0xF3, 0x82, 0x39,
+    0x18, 0xC8, 0xA2, 0x90, 0x97, 0x88, 0x10, 0x2A, 0x18, 0xC0, 0x60, 0x18, 0xA1, 0x4C, 0x8A, 0x12,
+    0x49, 0xD8, 0xA3, 0xE3, 0xA4, 0x30, 0xAA, 0xA2, 0x96, 0xC1, 0x12, 0x9A, 0x95, 0x91, 0x28, 0x1A,
+    0x82, 0xBA, 0x72, 0x4A, 0x1D, 0xA1, 0x03, 0x9A, 0x95, 0x08, 0xB0, 0x93, 0x79, 0x4B, 0x8A, 0xC4,
+    0x82, 0x01, 0x29, 0x1B, 0x9A, 0x07, 0x98, 0x81, 0xE2, 0x08, 0x80, 0xB2, 0x79, 0x09, 0xF9, 0x0C,
+    0x09, 0x28, 0x98, 0x01, 0x98, 0xB2, 0x21, 0x3B, 0x6B, 0x09, 0x88, 0x90, 0x12, 0xE1, 0x91, 0x00,
+    0x83, 0x24, 0xCB, 0x78, 0x0A, 0x10, 0x99, 0x03, 0x30, 0xB0, 0x1E, 0xA4, 0x92, 0xC1, 0x96, 0xA8,
+    0xA0, 0xF3, 0x44, 0x00, 0x19, 0x0C, 0xB5, 0x12, 0xA8, 0x19, 0x15, 0x0A, 0xF3, 0x92, 0x80, 0xB1,
+    0x96, 0x08, 0x94, 0xB0, 0x18, 0x86, 0x0A, 0x94, 0xA1, 0x02, 0x2F, 0x8A, 0xB4, 0x84, 0xA8, 0x01,
+    0x11, 0x2C, 0xA2, 0xD3, 0x93, 0x00, 0x2C, 0xC3, 0x21, 0xE3, 0x09, 0x83, 0x11, 0x2E, 0x49, 0x39,
+    0xBB, 0x05, 0xD1, 0x93, 0x3A, 0x2A, 0x88, 0x07, 0x9A, 0xFF, 0x09, 0x88, 0x01, 0x80, 0x89, 0x82,
+    0x39, 0xA8, 0x59, 0xA0, 0x11, 0x3C, 0x0B, 0x00, 0x60, 0x08, 0x98, 0x28, 0x3C, 0x3D, 0x4A, 0x80,
+    0x4A, 0x0B, 0x50, 0x3D, 0x2B, 0xA2, 0xA1, 0xB8, 0xA5, 0x28, 0x95, 0xB3, 0xA8, 0xA7, 0x88, 0x38,
+    0x20, 0x8D, 0xA7, 0x11, 0x89, 0x18, 0xA3, 0x40, 0x3F, 0x8A, 0x01, 0x98, 0x10, 0xF2, 0xA3, 0x04,
+    0x0B, 0x22, 0xF0, 0xA2, 0x12, 0x5B, 0x8B, 0x80, 0x13, 0x28, 0x0F, 0x02, 0x29, 0x8B, 0x83, 0x9A,
+    0x68, 0x29, 0xF1, 0x01, 0x00, 0x49, 0x2B, 0x99, 0x79, 0x0A, 0x49, 0x2A, 0x00, 0x1B, 0xC2, 0x95,
+    0x39, 0x4B, 0x1C, 0x88, 0x03, 0xFF, 0x8B, 0x00, 0x00, 0x89, 0x09, 0x03, 0xC8, 0x81, 0xB3, 0x58,
+    0x08, 0xC2, 0x40, 0x0A, 0x0D, 0x38, 0x0A, 0x98, 0x03, 0x31, 0x0F, 0x10, 0x38, 0x4F, 0x0A, 0x82,
+    0xA9, 0x71, 0x89, 0x59, 0x8A, 0x02, 0x2A, 0x00, 0x2E, 0x38, 0x2E, 0x90, 0x49, 0x90, 0xB1, 0x10,
+    0x18, 0x39, 0x1D, 0x81, 0x88, 0x32, 0xF9, 0x22, 0x2C, 0x08, 0xB4, 0x91, 0xD4, 0x10, 0x19, 0x11,
+    0x2F, 0x92, 0x4B, 0x1A, 0x59, 0x19, 0xC0, 0x21, 0x80, 0xBA, 0x50, 0xA0, 0x42, 0xBA, 0x31, 0x82,
+    0x4D, 0x3B, 0x58, 0xBB, 0xB4, 0x93, 0x31, 0xE1, 0x82, 0xC1, 0x86, 0x09, 0xA0, 0x89, 0x31, 0x96,
+    0xD1, 0x92, 0xA2, 0x93, 0x8B, 0xA2, 0x91, 0x97, 0xFF, 0x0A, 0x18, 0x88, 0x80, 0x18, 0xA0, 0x10,
+    0x75, 0xB9, 0x46, 0x00, 0x39, 0xA1, 0xB1, 0x10, 0xE3, 0x83, 0xD4, 0x68, 0x2A, 0x1B, 0xB2, 0x01,
+    0x98, 0x97, 0x29, 0xB8, 0x93, 0x03, 0x8B, 0x39, 0x00, 0x07, 0xAB, 0x10, 0x22, 0x7C, 0x98, 0x81,
+    0x0A, 0x81, 0x30, 0xF2, 0xA3, 0x80, 0xC4, 0x93, 0x04, 0x29, 0x9B, 0x20, 0x4E, 0x89, 0xA3, 0x30,
+    0x90, 0x92, 0x4E, 0x0C, 0x48, 0xA8, 0x01, 0xD1, 0x93, 0xA3, 0x93, 0x0A, 0x13, 0x11, 0x3F, 0xA1,
+    0x1D, 0x01, 0x95, 0xA9, 0x43, 0x0C, 0x50, 0x2D, 0x91, 0x0A, 0x21, 0x5C, 0x0B, 0xA3, 0x92, 0xB2,
+    0x82, 0x98, 0xF3, 0x21, 0x58, 0x0C, 0x38, 0x2A, 0xC0, 0xFF, 0x0A, 0x80, 0x18, 0x09, 0xA1, 0x18,
+    0x10, 0x4A, 0x8B, 0x18, 0xC4, 0x84, 0x09, 0x38, 0xA0, 0x3A, 0x19, 0x96, 0xB1, 0x42, 0x2D, 0x8F,
+    0xA2, 0xB2, 0x33, 0x2F, 0x98, 0xA2, 0x82, 0x79, 0x99, 0x22, 0x1E, 0x18, 0x29, 0x08, 0x38, 0x8C,
+    0x31, 0x3B, 0x88, 0x19, 0x7B, 0x0B, 0x68, 0x80, 0x8B, 0x86, 0x3B, 0x94, 0x8B, 0x40, 0x0A, 0x88,
+    0x43, 0x98, 0x8C, 0x12, 0xA0, 0x97, 0x0A, 0xB3, 0x23, 0x98, 0xB1, 0x2C, 0x70, 0x8A, 0x28, 0xD3,
+    0x08, 0x28, 0xB8, 0xA7, 0x68, 0x98, 0x28, 0x0A, 0x82, 0x1E, 0x31, 0xB8, 0xA3, 0xD6, 0x82, 0x80,
+    0x19, 0x08, 0xFF, 0x1B, 0x09, 0x28, 0x2A, 0x88, 0x28, 0xC0, 0x10, 0x08, 0x31, 0x1C, 0x2C, 0xA2,
+    0x4A, 0x1D, 0x11, 0x48, 0x0C, 0xB1, 0x93, 0x7B, 0x0A, 0x83, 0x4C, 0x19, 0xB1, 0xB1, 0x97, 0x18,
+    0x99, 0x13, 0x2C, 0x01, 0x1D, 0x83, 0x0C, 0x30, 0x02, 0x90, 0x1F, 0x48, 0x3B, 0x3C, 0x5A, 0x1A,
+    0x0A, 0x83, 0xC9, 0x60, 0xB0, 0x81, 0xB3, 0x41, 0xB2, 0x04, 0x1A, 0xF2, 0x80, 0xB5, 0x11, 0x1D,
+    0xC4, 0x28, 0x10, 0x99, 0x41, 0x4D, 0x1B, 0x88, 0xC3, 0xA5, 0xA1, 0x12, 0xB9, 0x01, 0x80, 0x79,
+    0xB0, 0x4E, 0x49, 0x00, 0x3A, 0x98, 0x88, 0x80, 0x1D, 0xC6, 0x82, 0xA2, 0x08, 0x29, 0x4A, 0xC1,
+    0x03, 0x5C, 0x8B, 0xA2, 0x18, 0xF9, 0xAF, 0x81, 0x08, 0x08, 0x80, 0x10, 0xB8, 0xA3, 0x80, 0xA6,
+    0x92, 0x2A, 0x08, 0x23, 0xD8, 0x80, 0x82, 0x69, 0xA8, 0x8B, 0x16, 0x8B, 0xB4, 0x38, 0x81, 0xF4,
+    0x80, 0x81, 0x90, 0xA4, 0x18, 0x20, 0xE0, 0x85, 0x3A, 0x09, 0xB1, 0x02, 0x9B, 0x97, 0x39, 0x88,
+    0x38, 0x08, 0xB0, 0x00, 0x15, 0xAB, 0xD1, 0x30, 0x28, 0x6A, 0x2E, 0x02, 0xC9, 0x03, 0x89, 0x48,
+    0x10, 0x2D, 0xE2, 0x30, 0x99, 0x32, 0x8E, 0x92, 0x41, 0x0D, 0x21, 0x2C, 0x88, 0x10, 0x2D, 0x81,
+    0x28, 0x2D, 0x14, 0xD8, 0xA4, 0x20, 0x08, 0x08, 0x3C, 0x30, 0x0B, 0xBA, 0x07, 0x0A, 0x61, 0x8C,
+    0x02, 0xC1, 0x58, 0xB0, 0xA2, 0x22, 0x1A, 0xE8, 0x14, 0x98, 0xFA, 0x9F, 0x88, 0x01, 0x98, 0x20,
+    0x99, 0x01, 0x3A, 0x4B, 0x08, 0x39, 0xA8, 0x7A, 0x80, 0x09, 0x28, 0xB9, 0xA5, 0x23, 0x1F, 0x01,
+    0x91, 0x38, 0x2F, 0x08, 0x18, 0x01, 0x0A, 0x5C, 0xB0, 0x21, 0x9A, 0x58, 0x6B, 0x2B, 0x89, 0x49,
+    0xA0, 0x11, 0x5A, 0x0C, 0xA2, 0x28, 0x12, 0x2C, 0xD3, 0x49, 0x92, 0xB2, 0x8A, 0x84, 0x81, 0x89,
+    0x03, 0xF3, 0xB2, 0x71, 0xB9, 0x80, 0x06, 0xD2, 0x80, 0x02, 0x08, 0x01, 0x19, 0x3B, 0x8C, 0x89,
+    0x17, 0x29, 0xC1, 0x7A, 0x90, 0x98, 0x11, 0x30, 0xF8, 0xB3, 0x00, 0x98, 0x06, 0x9A, 0x22, 0x1A,
+    0x8A, 0xB7, 0x38, 0x2A, 0x91, 0xD4, 0xF0, 0x8F, 0x08, 0x08, 0x80, 0x80, 0x80, 0x80, 0x82, 0x81,
+    0x3C, 0x20, 0x9A, 0x6A, 0xA9, 0xA2, 0x60, 0x19, 0x0C, 0x93, 0x20, 0x0A, 0x8B, 0x22, 0x58, 0x99,
+    0xC5, 0x92, 0xA4, 0x10, 0x8B, 0x71, 0xA8, 0x18, 0x89, 0x70, 0x29, 0xA8, 0x92, 0xB1, 0x95, 0xA9,
+    0x6D, 0x05, 0x40, 0x00, 0x8A, 0xA1, 0x89, 0x24, 0x05, 0xBA, 0xD7, 0x10, 0x01, 0x80, 0x18, 0x2C,
+    0x58, 0x0C, 0x81, 0x2A, 0xF3, 0x93, 0x93, 0x4A, 0x8B, 0x52, 0xC9, 0x01, 0xB2, 0x05, 0x0A, 0x11,
+    0xF0, 0x93, 0xA2, 0x10, 0x0A, 0x98, 0x07, 0x0D, 0x10, 0x81, 0x88, 0xA3, 0x92, 0x1E, 0x93, 0xB8,
+    0x40, 0x91, 0x91, 0xD1, 0x52, 0xAB, 0xFF, 0x99, 0x80, 0x91, 0x00, 0x91, 0x18, 0x1A, 0x91, 0x80,
+    0x86, 0xAA, 0x52, 0x1C, 0x5A, 0x09, 0x19, 0xB2, 0x09, 0x03, 0x3C, 0xA1, 0x6C, 0x80, 0x01, 0x91,
+    0x1A, 0x1A, 0xC4, 0x92, 0x2C, 0x93, 0x4B, 0x18, 0x4F, 0x08, 0x2A, 0xB3, 0x60, 0x9B, 0x12, 0xC2,
+    0x4A, 0xB8, 0x22, 0x1C, 0x20, 0x5D, 0x88, 0x80, 0xA2, 0x69, 0x1C, 0xD3, 0x21, 0x0A, 0x30, 0x2F,
+    0x4A, 0x0A, 0x91, 0x80, 0x03, 0x8A, 0x01, 0xB2, 0x94, 0x4A, 0x1A, 0xC1, 0x00, 0xB4, 0xC6, 0x40,
+    0x98, 0x00, 0x19, 0x11, 0x90, 0x0D, 0x94, 0xB2, 0xA3, 0x0E, 0x31, 0x3C, 0x00, 0x90, 0x98, 0xB8,
+    0x87, 0xC2, 0x18, 0xD3, 0x87, 0x88, 0x18, 0x29, 0x8A, 0xA2, 0x71, 0x2B, 0xFF, 0x0A, 0x18, 0x09,
+    0x18, 0x90, 0xA1, 0x11, 0x80, 0x1B, 0x3A, 0xC8, 0x93, 0x13, 0xF3, 0xA5, 0x88, 0x31, 0x4D, 0x0A,
+    0x80, 0xA3, 0x39, 0x3E, 0xC1, 0xC3, 0x03, 0x0B, 0x92, 0x85, 0xC1, 0x91, 0xA3, 0x94, 0x3A, 0x01,
+    0xAA, 0xC3, 0x3A, 0x83, 0x7B, 0x0A, 0x7B, 0x29, 0x1B, 0x01, 0x08, 0xA5, 0x1A, 0x94, 0x29, 0x39,
+    0x09, 0x9D, 0x27, 0x2C, 0x9B, 0x21, 0xE2, 0x93, 0x94, 0x08, 0xA1, 0x30, 0x2F, 0x2A, 0x19, 0x91,
+    0xB0, 0x14, 0xD4, 0x21, 0x3D, 0x29, 0x08, 0xAA, 0x96, 0x80, 0x59, 0xA0, 0xB2, 0x30, 0xF2, 0x93,
+    0x39, 0x1C, 0x0A, 0x83, 0x10, 0xA7, 0x50, 0x2B, 0x09, 0x00, 0xC1, 0xC3, 0x04, 0x2C, 0x49, 0x2D,
+    0x16, 0xA7, 0x49, 0x00, 0x48, 0x8B, 0x21, 0x90, 0x08, 0xE2, 0x20, 0x18, 0x6A, 0x0A, 0xA8, 0x95,
+    0x38, 0x1D, 0x83, 0x3C, 0xB8, 0xA6, 0x80, 0x28, 0x38, 0x2D, 0xC2, 0x80, 0xA3, 0x00, 0x92, 0x39,
+    0x0B, 0xB4, 0x32, 0x5A, 0xB2, 0x70, 0x2D, 0x1A, 0x98, 0xB4, 0x93, 0x82, 0xB2, 0x22, 0x98, 0x2D,
+    0x01, 0xCC, 0x14, 0x41, 0x2F, 0x90, 0x28, 0x1B, 0x48, 0xC0, 0x50, 0x3A, 0xB8, 0x28, 0x3A, 0x8A,
+    0x85, 0x08, 0xF2, 0x31, 0x20, 0xDA, 0x04, 0x3C, 0x0C, 0x90, 0x92, 0x10, 0x01, 0x2C, 0x00, 0xB9,
+    0xA7, 0x30, 0xA1, 0x3A, 0x4A, 0xE0, 0xA4, 0x20, 0x0C, 0x80, 0xB2, 0x34, 0xB8, 0x29, 0x7A, 0xF9,
+    0x8F, 0x08, 0x09, 0x00, 0x80, 0x88, 0x81, 0x91, 0xB1, 0x01, 0xB4, 0x79, 0x89, 0x08, 0x49, 0x09,
+    0x8B, 0x96, 0x8A, 0x09, 0xB2, 0xA4, 0xA7, 0xB2, 0x04, 0x8B, 0x32, 0x3F, 0xA0, 0x49, 0x90, 0xA2,
+    0x22, 0x1A, 0x8E, 0x50, 0xA8, 0x88, 0x95, 0xA2, 0x3A, 0x28, 0x00, 0x4E, 0x0A, 0x88, 0x84, 0x88,
+    0x12, 0x5B, 0x1D, 0x1A, 0x93, 0x03, 0x0A, 0xB9, 0x31, 0x7E, 0xB1, 0x89, 0x23, 0x3D, 0xC2, 0x08,
+    0x0A, 0x04, 0x5B, 0x3A, 0x09, 0xF3, 0x38, 0x08, 0x1A, 0x19, 0xD2, 0x86, 0x29, 0xB0, 0x99, 0x23,
+    0x99, 0xB7, 0xA1, 0x18, 0x93, 0x82, 0x6A, 0xC2, 0x01, 0x1B, 0x1C, 0x78, 0x88, 0xB2, 0x10, 0xB4,
+    0x2B, 0xFF, 0x8B, 0x08, 0x81, 0x80, 0x09, 0xB3, 0x90, 0x02, 0x29, 0xE4, 0x02, 0xA0, 0x30, 0x0E,
+    0x12, 0xA9, 0x28, 0x2A, 0x88, 0xD4, 0xA3, 0x21, 0xC3, 0x30, 0x4F, 0x28, 0x2D, 0x08, 0x2A, 0x49,
+    0xB8, 0xC3, 0xB4, 0xA2, 0xA5, 0x81, 0xA2, 0x82, 0x5D, 0xA8, 0x93, 0x3A, 0x3C, 0x90, 0x6C, 0x2A,
+    0x0B, 0x02, 0x2C, 0x02, 0xE2, 0x92, 0xE3, 0x03, 0x80, 0x1B, 0x5A, 0xC1, 0x01, 0x28, 0x3C, 0x9A,
+    0x42, 0x0A, 0x42, 0x00, 0x10, 0x5D, 0x08, 0x0B, 0x13, 0xAB, 0x79, 0x1A, 0xA1, 0x11, 0x80, 0x18,
+    0xB5, 0x83, 0x0F, 0x01, 0x48, 0xB9, 0x11, 0x00, 0x08, 0x0F, 0x14, 0x2D, 0x89, 0x10, 0x00, 0x19,
+    0xC2, 0x31, 0xBA, 0x52, 0xB8, 0x04, 0xC1, 0x85, 0x1D, 0x09, 0x04, 0x2D, 0x90, 0x82, 0xFF, 0x89,
+    0x18, 0xA1, 0x91, 0x80, 0xB3, 0x20, 0xA9, 0x14, 0x8B, 0x08, 0x22, 0x1F, 0x39, 0x0A, 0x33, 0xFB,
+    0x84, 0x4A, 0x88, 0x00, 0x00, 0x99, 0xA5, 0x4A, 0x3C, 0x0A, 0x38, 0x6B, 0x0B, 0xB3, 0xB2, 0x94,
+    0xC2, 0x22, 0xB0, 0x05, 0xB9, 0x70, 0xC8, 0x12, 0x3A, 0x1A, 0x4C, 0xA9, 0x85, 0x2A, 0x3B, 0x82,
+    0x10, 0xCB, 0xA1, 0x05, 0xE3, 0x93, 0x4A, 0x98, 0x20, 0x5B, 0x89, 0xC3, 0x18, 0x2A, 0x38, 0x81,
+    0xF2, 0x11, 0xA0, 0xC5, 0x92, 0xA2, 0x7A, 0x90, 0x82, 0x3C, 0x08, 0x99, 0x20, 0x0C, 0xA4, 0x00,
+    0x02, 0xD6, 0x01, 0xC2, 0xA1, 0x30, 0x29, 0x99, 0x78, 0x0C, 0x81, 0x98, 0x01, 0x12, 0x0E, 0xFF,
+    0x08, 0x08, 0x80, 0x80, 0x88, 0x91, 0x01, 0x81, 0x4C, 0x19, 0xA0, 0x88, 0x10, 0x32, 0x1A, 0x4F,
+    0x98, 0x92, 0x19, 0x0B, 0x06, 0xA9, 0x50, 0x1A, 0x90, 0x88, 0xA6, 0x29, 0x91, 0x82, 0x2A, 0x1A,
+    0x99, 0xB7, 0x13, 0x1E, 0xF2, 0x11, 0x69, 0x1B, 0x80, 0x18, 0x91, 0x0A, 0x09, 0x87, 0x1A, 0xA0,
+    0x61, 0xA8, 0x81, 0xB4, 0x84, 0x29, 0x8D, 0x01, 0xA4, 0x08, 0xD4, 0x21, 0x1C, 0x81, 0x82, 0x89,
+    0xB1, 0x70, 0xB8, 0xC5, 0x92, 0x38, 0x89, 0x49, 0x0A, 0x95, 0x99, 0x98, 0x38, 0x29, 0x82, 0x0B,
+    0x32, 0xAF, 0x51, 0x98, 0xB3, 0x31, 0x3F, 0x98, 0x92, 0x20, 0x2F, 0x80, 0x80, 0x89, 0xFF, 0x0B,
+    0x80, 0x91, 0x80, 0x18, 0xB1, 0x93, 0x59, 0xB8, 0x90, 0xB4, 0x51, 0x99, 0x01, 0xA1, 0xC3, 0x90,
+    0x7F, 0xDB, 0x3A, 0x00, 0x97, 0x5A, 0x1A, 0x99, 0x51, 0x0A, 0x5A, 0x8A, 0xA1, 0x22, 0xC0, 0xA4,
+    0x39, 0x19, 0xE4, 0x18, 0x80, 0x93, 0x38, 0x1B, 0x68, 0x8B, 0xC3, 0x21, 0x6B, 0xB8, 0x13, 0x0B,
+    0x7B, 0x99, 0x58, 0x1A, 0x49, 0x90, 0x0B, 0x22, 0xA0, 0x39, 0x1F, 0x28, 0xD1, 0x94, 0x08, 0x08,
+    0x86, 0x98, 0x81, 0x7B, 0xA8, 0x80, 0x02, 0xAA, 0x86, 0x29, 0x2A, 0xA2, 0xD4, 0x48, 0xA9, 0x40,
+    0xC1, 0x08, 0x83, 0x20, 0xB9, 0xF4, 0x01, 0x92, 0x2A, 0x10, 0xD1, 0x83, 0x21, 0x9C, 0x68, 0x89,
+    0x90, 0x39, 0x18, 0x1C, 0x68, 0x0B, 0x0A, 0x80, 0x79, 0x90, 0xA5, 0xFF, 0x08, 0x08, 0x90, 0xA1,
+    0x92, 0x92, 0x91, 0x81, 0x98, 0x90, 0xC5, 0xA4, 0x20, 0x81, 0x8B, 0x39, 0x01, 0x6B, 0x9A, 0x23,
+    0x8E, 0xB4, 0x80, 0x10, 0xB1, 0x28, 0xA1, 0x73, 0x1C, 0x39, 0x6C, 0x98, 0x11, 0x89, 0x09, 0x21,
+    0x49, 0x1F, 0x88, 0x00, 0xA1, 0x86, 0x09, 0x2A, 0x10, 0xA9, 0x95, 0x11, 0x8C, 0x48, 0x1A, 0x09,
+    0x40, 0xCA, 0x85, 0x99, 0x13, 0x68, 0x89, 0x59, 0xB9, 0x80, 0xB3, 0x53, 0x1F, 0x90, 0x30, 0x09,
+    0x4A, 0x0B, 0x91, 0x41, 0x0B, 0x6A, 0x5C, 0x09, 0x3A, 0x11, 0x1C, 0x1A, 0xC2, 0x48, 0xA8, 0x41,
+    0xB9, 0x82, 0x4A, 0x96, 0x5C, 0x0A, 0x09, 0xA2, 0x31, 0x3C, 0x5C, 0x98, 0x91, 0xA0, 0xC3, 0x04,
+    0x99, 0x10, 0x84, 0xFF, 0x8A, 0x00, 0x90, 0x81, 0x39, 0x3B, 0x89, 0xA2, 0x89, 0xA2, 0x58, 0x3D,
+    0x3B, 0x9A, 0x79, 0x5A, 0x0A, 0x6A, 0x99, 0x01, 0x10, 0xC0, 0x10, 0x18, 0x29, 0x29, 0x4E, 0x8B,
+    0x93, 0x92, 0x18, 0xF4, 0x81, 0x03, 0x0C, 0x84, 0x89, 0x98, 0x82, 0xB1, 0x96, 0x09, 0x21, 0xB8,
+    0x87, 0x90, 0x39, 0x91, 0xF2, 0x91, 0x01, 0x39, 0x18, 0x0C, 0x19, 0x33, 0x3D, 0x80, 0xD1, 0x92,
+    0x65, 0x16, 0x3C, 0x00, 0x9C, 0x83, 0x5A, 0x9A, 0x18, 0x92, 0x97, 0xA2, 0x94, 0x89, 0x93, 0x59,
+    0x08, 0x8B, 0x08, 0xC3, 0x6C, 0xA0, 0x28, 0x12, 0xE2, 0x31, 0x1F, 0x18, 0x82, 0x89, 0x5B, 0x18,
+    0x89, 0x3B, 0x84, 0xF0, 0x91, 0x01, 0xFF, 0x09, 0x88, 0x81, 0x81, 0x08, 0x99, 0x02, 0x10, 0x2C,
+    0x0A, 0x94, 0x20, 0x98, 0xF1, 0x92, 0x02, 0xE2, 0x11, 0x1B, 0x02, 0xE1, 0x81, 0x58, 0x89, 0x10,
+    0x3B, 0xB2, 0x2C, 0x84, 0x19, 0x2D, 0x21, 0xAB, 0x30, 0x5F, 0x99, 0x80, 0x68, 0x1A, 0x09, 0x1A,
+    0x81, 0x04, 0x2A, 0xE0, 0x28, 0x22, 0xD1, 0xA0, 0x12, 0xD3, 0x5A, 0x00, 0x1C, 0x89, 0x06, 0xA8,
+    0x59, 0x88, 0x29, 0x10, 0xC9, 0x00, 0x84, 0x10, 0x2B, 0xC4, 0x89, 0x97, 0x83, 0x8A, 0xD3, 0x81,
+    0x98, 0x00, 0xB0, 0x95, 0xB3, 0x48, 0xF0, 0x03, 0x00, 0x2C, 0x4A, 0x09, 0x18, 0x3A, 0x98, 0x21,
+    0xAD, 0x24, 0x8A, 0x29, 0xC5, 0x30, 0xA8, 0x01, 0x0F, 0xB4, 0x04, 0xB8, 0xF2, 0xAF, 0x00, 0x89,
+    0x81, 0x91, 0x28, 0xA8, 0x93, 0x49, 0x09, 0x01, 0x4E, 0x29, 0x88, 0xC1, 0x82, 0x91, 0xA8, 0x34,
+    0x2C, 0xD0, 0x40, 0x3A, 0xB8, 0xA0, 0xA6, 0xA1, 0x93, 0x00, 0x3A, 0x7B, 0x09, 0x10, 0x3A, 0x5C,
+    0xA8, 0x02, 0x2D, 0x28, 0x90, 0xD1, 0x11, 0x99, 0x84, 0x08, 0x59, 0xC0, 0x59, 0x2A, 0x18, 0x3B,
+    0xF4, 0x20, 0x28, 0xA8, 0x8A, 0x04, 0x6A, 0xBA, 0x01, 0x61, 0xD8, 0x20, 0x88, 0xA4, 0x92, 0x82,
+    0x8A, 0xD3, 0x40, 0x9A, 0xB2, 0x79, 0x02, 0xD8, 0xB3, 0x10, 0x48, 0xC8, 0xB4, 0x12, 0x90, 0xB8,
+    0x15, 0x3B, 0x8D, 0x93, 0x5A, 0x4A, 0x8A, 0x19, 0xA0, 0x81, 0x40, 0xA9, 0x90, 0xC4, 0x94, 0xA0,
+    0x69, 0x1A, 0x08, 0x88, 0xB5, 0x08, 0xC3, 0x05, 0x98, 0x90, 0xFF, 0x8A, 0x80, 0x91, 0x38, 0x2A,
+    0xFA, 0xD7, 0x41, 0x00, 0x94, 0x1A, 0x21, 0x3C, 0x89, 0x01, 0xC0, 0x32, 0x8A, 0x91, 0x09, 0x00,
+    0x84, 0xC1, 0x7A, 0xB8, 0x5E, 0x09, 0xB1, 0xC4, 0xA2, 0x81, 0x85, 0xB0, 0x08, 0xC5, 0x94, 0x10,
+    0x1C, 0x00, 0x98, 0x23, 0x3E, 0x09, 0x90, 0x00, 0xC8, 0x87, 0x1A, 0x01, 0xA8, 0x82, 0xF2, 0xA4,
+    0x91, 0x01, 0x99, 0x41, 0x28, 0xB8, 0xC5, 0x90, 0x91, 0x14, 0x99, 0x80, 0xA4, 0x0B, 0x72, 0xB8,
+    0x82, 0x08, 0x23, 0xF4, 0xB2, 0x93, 0x49, 0x98, 0x11, 0x2A, 0x3E, 0x99, 0x03, 0xD1, 0x13, 0x39,
+    0xAD, 0x04, 0xA1, 0xD5, 0x92, 0x01, 0xC2, 0x89, 0x85, 0x0A, 0x21, 0x0A, 0x50, 0x5B, 0x08, 0xAB,
+    0x95, 0xFF, 0x09, 0x08, 0x00, 0x08, 0x88, 0x81, 0x09, 0x18, 0xA0, 0x60, 0x98, 0x82, 0x81, 0xAA,
+    0xB5, 0xB3, 0x29, 0x81, 0x51, 0x3D, 0xA8, 0xB3, 0x39, 0x43, 0x1D, 0x3B, 0xF3, 0x03, 0x4C, 0xB0,
+    0x21, 0x9B, 0x24, 0x9B, 0x93, 0x7C, 0xC0, 0x81, 0x22, 0x1B, 0xA0, 0x82, 0x99, 0x97, 0x90, 0xB4,
+    0x82, 0x00, 0x0C, 0x92, 0x93, 0x0B, 0xA7, 0xB4, 0x38, 0x99, 0xB2, 0x96, 0x88, 0x81, 0x21, 0xF1,
+    0x93, 0xC0, 0x42, 0x3C, 0x2B, 0x8A, 0x12, 0x98, 0x7B, 0x98, 0x83, 0x8A, 0x14, 0xA9, 0xD2, 0x96,
+    0x0A, 0x82, 0x20, 0x1D, 0x29, 0x40, 0xD8, 0x20, 0xA1, 0xC1, 0x28, 0xB2, 0xB7, 0x00, 0x80, 0x08,
+    0x10, 0x1B, 0x70, 0x29, 0xE0, 0xCF, 0x98, 0x00, 0x08, 0x10, 0x3A, 0x99, 0x49, 0x2B, 0x4A, 0xA8,
+    0xA2, 0xB3, 0x86, 0x3A, 0x9B, 0xB4, 0x04, 0x4C, 0x98, 0x12, 0xCA, 0xF4, 0x80, 0xA3, 0x18, 0xA2,
+    0x0B, 0x51, 0x99, 0x94, 0x84, 0x8A, 0xC8, 0x07, 0x3A, 0x3C, 0x0A, 0x80, 0x00, 0x09, 0x12, 0xF1,
+    0xA3, 0x22, 0x8C, 0xC1, 0x31, 0xD0, 0x03, 0x99, 0x38, 0x7B, 0x09, 0xB0, 0x35, 0x2D, 0x08, 0xC2,
+    0xE2, 0xFF, 0x41, 0x00, 0xA3, 0x00, 0xAA, 0xA4, 0x71, 0x1C, 0x81, 0x90, 0x81, 0x99, 0x03, 0xD8,
+    0x23, 0xD1, 0x03, 0x89, 0xB2, 0x83, 0x83, 0x3F, 0x2E, 0xA2, 0x01, 0xB0, 0x01, 0xB0, 0x92, 0x70,
+    0x08, 0x7B, 0x99, 0xB3, 0xB5, 0x81, 0xA4, 0xB1, 0x21, 0xB2, 0xD5, 0x93, 0x28, 0x1B, 0x40, 0xAC,
+    0x92, 0x04, 0x8C, 0x22, 0x90, 0x28, 0x7A, 0x81, 0xAD, 0xFF, 0x08, 0x88, 0x00, 0x09, 0x39, 0x29,
+    0x99, 0x00, 0x99, 0xA5, 0x21, 0x4D, 0x99, 0xA3, 0x20, 0x89, 0x69, 0x80, 0x1C, 0x5A, 0xB8, 0xB3,
+    0x92, 0x82, 0x39, 0xD0, 0xA6, 0x92, 0x10, 0xA9, 0x05, 0x90, 0x89, 0x13, 0x1F, 0x01, 0x1B, 0xC2,
+    0x02, 0x92, 0x96, 0xA1, 0x84, 0x8A, 0x11, 0xA2, 0x5F, 0x19, 0x89, 0x11, 0x4D, 0x0B, 0xA3, 0x22,
+    0xC9, 0x79, 0x99, 0x92, 0x20, 0xB8, 0x49, 0x00, 0xF3, 0xA3, 0x11, 0xC0, 0xB5, 0x18, 0xA1, 0x80,
+    0x59, 0xA8, 0xA0, 0x41, 0x38, 0x1D, 0x09, 0x81, 0xB3, 0x95, 0xA8, 0x11, 0x02, 0xE1, 0x11, 0x2A,
+    0x79, 0xC0, 0x30, 0x8C, 0x11, 0x3B, 0xA0, 0x23, 0xF4, 0x91, 0x49, 0x1B, 0x31, 0x3D, 0xC0, 0x92,
+    0x01, 0xF8, 0xBF, 0x98, 0x00, 0x91, 0xD1, 0x01, 0x80, 0xA1, 0x91, 0x96, 0x81, 0xAA, 0x70, 0x9A,
+    0x40, 0x9A, 0x83, 0x49, 0x0B, 0x38, 0xC1, 0x18, 0x94, 0x91, 0x99, 0x06, 0x2C, 0xD2, 0x18, 0x80,
+    0x40, 0xA9, 0xB5, 0x30, 0x80, 0x6A, 0x88, 0x89, 0x01, 0x38, 0x0D, 0x10, 0x7A, 0xA8, 0x21, 0x0B,
+    0x7B, 0x2A, 0x28, 0x9A, 0x32, 0xC9, 0xE3, 0x02, 0x01, 0x08, 0x0A, 0x7B, 0xD1, 0x20, 0x89, 0x04,
+    0x09, 0x90, 0x09, 0xA6, 0x5B, 0x18, 0x9A, 0x01, 0x48, 0x90, 0x39, 0x99, 0x31, 0x12, 0xCF, 0x60,
+    0x08, 0x8A, 0x82, 0xA2, 0xE3, 0x32, 0x0D, 0x08, 0xA2, 0x69, 0x0A, 0x88, 0x39, 0xB0, 0x01, 0x87,
+    0x43, 0x15, 0x3B, 0x00, 0xB5, 0x30, 0x88, 0x98, 0x41, 0xFF, 0x0B, 0x80, 0x00, 0x88, 0x80, 0x49,
+    0x0A, 0x11, 0x99, 0x04, 0x0C, 0x18, 0x2A, 0x08, 0x19, 0x50, 0xA0, 0xD3, 0x12, 0x4D, 0xB0, 0x08,
+    0x88, 0xD2, 0x85, 0x3A, 0x3B, 0x3B, 0xF2, 0x09, 0x69, 0x1A, 0x5A, 0x89, 0xA4, 0x1A, 0xA5, 0x28,
+    0x09, 0xB0, 0x79, 0x0A, 0x28, 0x18, 0x0A, 0x5A, 0x11, 0x1C, 0x19, 0x79, 0x9A, 0x21, 0x4A, 0x8B,
+    0x28, 0x49, 0xA0, 0xA4, 0x10, 0x3D, 0xD1, 0x00, 0x1A, 0x15, 0x8B, 0x81, 0xA0, 0x60, 0xA8, 0xB6,
+    0x92, 0x08, 0x83, 0xE2, 0xB3, 0x28, 0x90, 0xA6, 0x29, 0x82, 0x1E, 0x4A, 0x99, 0x01, 0x23, 0xA0,
+    0x3D, 0x2A, 0x2B, 0x7D, 0x09, 0x28, 0x98, 0x3A, 0x39, 0x29, 0x9E, 0xB3, 0x84, 0xA1, 0x3A, 0x95,
+    0x6B, 0x89, 0x21, 0x1D, 0x90, 0x81, 0x1A, 0xC2, 0x80, 0xFF, 0x0D, 0x08, 0x80, 0x98, 0x28, 0x09,
+    0x49, 0x89, 0xD3, 0x92, 0x20, 0x0B, 0xA1, 0x82, 0x23, 0x0C, 0xB1, 0x07, 0xB0, 0x39, 0x13, 0x1F,
+    0x91, 0x2A, 0xF3, 0xA2, 0x40, 0x1B, 0x48, 0x1D, 0x48, 0x1A, 0x08, 0x01, 0x99, 0x58, 0xA9, 0x93,
+    0xA0, 0x24, 0x5B, 0x1D, 0x19, 0x00, 0x48, 0xA8, 0x21, 0x1F, 0xA1, 0x02, 0x80, 0xBA, 0x97, 0xC3,
+    0x92, 0x80, 0x80, 0x01, 0xD2, 0xD4, 0x04, 0xA9, 0x92, 0xB2, 0x85, 0x90, 0x6B, 0x1A, 0x29, 0xB0,
+    0x92, 0x18, 0xB2, 0x88, 0x07, 0xE2, 0x00, 0x10, 0xD4, 0x92, 0x49, 0x8A, 0x02, 0x98, 0xD2, 0x42,
+    0xBA, 0x04, 0x81, 0x4D, 0x98, 0xB3, 0xA2, 0x93, 0x11, 0xAC, 0x86, 0x2A, 0xAA, 0x72, 0xB8, 0x21,
+    0xA1, 0x00, 0x0B, 0x71, 0x0C, 0xA4, 0x49, 0xFB, 0x0F, 0x80, 0x08, 0x80, 0x08, 0x80, 0x10, 0x80,
+    0xA8, 0x31, 0x0B, 0x13, 0x9B, 0x2A, 0x48, 0xF4, 0x20, 0x10, 0x2E, 0xB1, 0xA3, 0x00, 0xB3, 0x7B,
+    0x58, 0xF5, 0x3D, 0x00, 0x80, 0x29, 0x99, 0xA4, 0x18, 0x1C, 0x68, 0x1A, 0x10, 0x3D, 0x2B, 0x00,
+    0x49, 0x4C, 0x0A, 0xB3, 0x28, 0xD9, 0x86, 0x89, 0x90, 0x03, 0x18, 0x6D, 0xB8, 0x32, 0x1C, 0xB0,
+    0x21, 0xAA, 0x05, 0x00, 0x7C, 0x19, 0x0B, 0x10, 0x5A, 0x09, 0x80, 0x1A, 0x2A, 0x38, 0xC2, 0xC7,
+    0x01, 0x90, 0x83, 0x0A, 0x4A, 0xA0, 0x30, 0x18, 0xA4, 0xE0, 0x03, 0x1C, 0xC4, 0xB1, 0x00, 0x92,
+    0x69, 0x1C, 0xA0, 0xA3, 0x70, 0x88, 0x08, 0xA1, 0x09, 0x18, 0x95, 0x19, 0xAA, 0xA6, 0x21, 0xB0,
+    0xF5, 0x9F, 0x88, 0x00, 0x90, 0x18, 0x20, 0x0C, 0x92, 0x81, 0x09, 0x38, 0x09, 0x59, 0xC0, 0x28,
+    0x20, 0xC0, 0xA5, 0xA2, 0xB8, 0x84, 0x4A, 0xB0, 0xB6, 0x10, 0x48, 0x8D, 0x21, 0xA0, 0x20, 0x6C,
+    0x88, 0x81, 0x0B, 0x49, 0x29, 0x09, 0x5A, 0x99, 0x38, 0x10, 0x3F, 0x01, 0x0A, 0x8C, 0x82, 0x94,
+    0x11, 0xA0, 0x1E, 0x68, 0x80, 0x90, 0xD1, 0xB4, 0x91, 0x02, 0x49, 0x0D, 0x32, 0x9B, 0xB4, 0xD4,
+    0x94, 0x80, 0x90, 0x39, 0x01, 0x0C, 0xC3, 0xB2, 0x96, 0x80, 0x81, 0x19, 0x7B, 0x8A, 0x81, 0x11,
+    0xA9, 0xA7, 0x90, 0xA3, 0x81, 0xC4, 0x00, 0xC4, 0xB2, 0x94, 0x01, 0xA8, 0x38, 0xC9, 0x40, 0xC2,
+    0x11, 0x0C, 0x38, 0xC1, 0x71, 0xA1, 0x28, 0x4D, 0x08, 0xB8, 0x82, 0x41, 0x8A, 0x01, 0xE1, 0xF1,
+    0x9F, 0x18, 0x09, 0x18, 0x80, 0x80, 0xA8, 0x81, 0xA4, 0x80, 0xA1, 0x01, 0x91, 0x93, 0x38, 0xF3,
+    0x90, 0x48, 0x4A, 0xD0, 0x83, 0x29, 0x01, 0x1C, 0x19, 0x7D, 0x1A, 0x00, 0x8B, 0x83, 0x58, 0x2F,
+    0x3A, 0x2B, 0xA0, 0xA2, 0x42, 0x99, 0x92, 0x5C, 0xC1, 0x92, 0x80, 0x09, 0x58, 0x38, 0x8E, 0x40,
+    0xB8, 0x48, 0x2A, 0xB1, 0xB2, 0x92, 0x97, 0x88, 0x02, 0x09, 0x18, 0x9A, 0x87, 0x1D, 0xB2, 0x13,
+    0x3B, 0x02, 0x38, 0x00, 0x10, 0x2C, 0xA0, 0xA6, 0x12, 0x29, 0x0F, 0x28, 0xC2, 0x91, 0x81, 0xB4,
+    0x94, 0x3A, 0x00, 0x3F, 0x3A, 0x0A, 0x08, 0x02, 0xB9, 0x18, 0xB0, 0x07, 0x20, 0xA1, 0xF1, 0x32,
+    0xD9, 0x68, 0x08, 0x0A, 0x39, 0x4C, 0x90, 0x49, 0x19, 0x1B, 0x08, 0xA2, 0x30, 0x4B, 0x4F, 0x4B,
+    0x08, 0xB0, 0x80, 0x30, 0x81, 0x0C, 0xFC, 0xBF, 0x10, 0x98, 0x08, 0x11, 0xC1, 0x02, 0x29, 0x2D,
+    0xA1, 0x20, 0xB0, 0x2A, 0x92, 0xA2, 0x31, 0x5F, 0x29, 0xB9, 0x14, 0x1D, 0x29, 0xA2, 0x88, 0x21,
+    0x0A, 0x7D, 0x89, 0x21, 0xC8, 0x21, 0x18, 0xC8, 0xC3, 0x20, 0x18, 0xD4, 0x81, 0x89, 0x13, 0x4A,
+    0xAA, 0xB5, 0x79, 0xB0, 0x12, 0x90, 0xA8, 0x86, 0x2A, 0xB8, 0x04, 0x9A, 0x20, 0xF3, 0x94, 0x01,
+    0xB0, 0x93, 0xB0, 0x83, 0x8B, 0xD5, 0x82, 0x05, 0xB8, 0x20, 0xC1, 0x20, 0x6A, 0x4C, 0x99, 0x20,
+    0x99, 0x10, 0x19, 0x11, 0xB8, 0x82, 0x87, 0x0B, 0xB4, 0xA0, 0x08, 0x27, 0x0D, 0x80, 0x18, 0x0A,
+    0x97, 0x98, 0xB4, 0x81, 0x82, 0x3A, 0xC4, 0xA3, 0xD1, 0x01, 0x80, 0x21, 0xAA, 0x41, 0xF2, 0xFF,
+    0x08, 0x08, 0x08, 0x90, 0x92, 0x91, 0x28, 0x1A, 0x98, 0x30, 0xA8, 0x2A, 0xA5, 0x2A, 0xA6, 0xD3,
+    0x93, 0x5A, 0x1A, 0x81, 0xA0, 0x40, 0x0D, 0x12, 0x9B, 0x13, 0xA8, 0x7A, 0xB8, 0xA4, 0x41, 0xA8,
+    0x93, 0xE2, 0x21, 0x88, 0x1A, 0x93, 0xA2, 0xDA, 0x10, 0x61, 0x4E, 0x08, 0x0A, 0x80, 0x28, 0x99,
+    0x97, 0x2A, 0x81, 0x19, 0xC0, 0x14, 0x1A, 0x90, 0x9A, 0xA6, 0xB5, 0x93, 0xC4, 0x02, 0x08, 0x0C,
+    0xA2, 0x81, 0xF3, 0x94, 0x82, 0x90, 0x18, 0xD8, 0xA2, 0x96, 0x09, 0x11, 0x80, 0x2C, 0x28, 0xA1,
+    0x4A, 0x3B, 0x8C, 0x13, 0xE8, 0x03, 0xC3, 0xB5, 0x18, 0xB1, 0xB5, 0x32, 0x2C, 0x0D, 0xA4, 0x18,
+    0xAA, 0x11, 0x36, 0x00, 0x8A, 0x02, 0x3D, 0xA1, 0xB2, 0x08, 0x91, 0x31, 0xF3, 0x91, 0xE5, 0x92,
+    0x10, 0xFF, 0x09, 0x80, 0x18, 0x09, 0x90, 0xA3, 0x4A, 0x89, 0x91, 0x94, 0x90, 0x93, 0x2C, 0x5B,
+    0x90, 0xB2, 0x30, 0x4A, 0x89, 0x81, 0x03, 0x3E, 0x2B, 0x6A, 0xA9, 0x90, 0x00, 0x50, 0x01, 0x28,
+    0xF8, 0x91, 0x48, 0xA8, 0x58, 0x2B, 0x91, 0xB3, 0x6A, 0x09, 0x38, 0x1B, 0xD8, 0x21, 0x08, 0x20,
+    0x8D, 0x95, 0x91, 0x00, 0xB0, 0x11, 0x22, 0xAC, 0x46, 0x1D, 0x39, 0x88, 0x00, 0xAB, 0x01, 0xC3,
+    0xA7, 0x93, 0xC4, 0x29, 0x83, 0x2D, 0x98, 0x90, 0x00, 0x42, 0x39, 0x4F, 0x99, 0x89, 0x91, 0x02,
+    0x04, 0x2E, 0xB1, 0x94, 0xA8, 0x20, 0x04, 0x2C, 0x98, 0xC5, 0x00, 0xB1, 0x23, 0xAC, 0x05, 0xB1,
+    0x80, 0x59, 0x08, 0x4D, 0x89, 0x39, 0x81, 0x1A, 0xC1, 0xA3, 0x80, 0xA4, 0x4B, 0xA0, 0x92, 0x54,
+    0xD1, 0xC1, 0x04, 0x29, 0xA8, 0x02, 0xA2, 0x8B, 0xF7, 0x9F, 0x88, 0x80, 0x81, 0x80, 0x19, 0x88,
+    0x01, 0x89, 0x22, 0xF2, 0xA3, 0x81, 0x08, 0x92, 0xF3, 0x38, 0x08, 0x29, 0xB0, 0x95, 0xB2, 0xB4,
+    0xB2, 0x97, 0x00, 0x09, 0x98, 0x10, 0xC3, 0x96, 0x29, 0x1A, 0x2A, 0x22, 0x3E, 0x3A, 0x1D, 0xA2,
+    0x19, 0x5A, 0x88, 0x38, 0x1C, 0x29, 0xB3, 0x31, 0xAE, 0x86, 0x98, 0x59, 0x99, 0x02, 0x3A, 0x0C,
+    0xA4, 0x01, 0x91, 0x86, 0x29, 0x8B, 0x70, 0xAB, 0xA5, 0x91, 0x00, 0x83, 0x81, 0xF1, 0x81, 0x88,
+    0x05, 0xD1, 0x92, 0x03, 0x89, 0x18, 0xF2, 0x03, 0x1B, 0xB0, 0xA7, 0x81, 0x08, 0x90, 0xB3, 0xC6,
+    0xA1, 0x13, 0x80, 0x3A, 0xAB, 0x78, 0xA9, 0x50, 0xA9, 0x05, 0x0B, 0x91, 0x05, 0x0A, 0xB2, 0x2A,
+    0x51, 0x9B, 0x48, 0xF1, 0xCF, 0x08, 0x18, 0x08, 0x98, 0x00, 0x82, 0x1A, 0xA2, 0x38, 0x6C, 0xA9,
+    0x2F, 0xFA, 0x31, 0x00, 0x09, 0x10, 0x9A, 0x10, 0x04, 0x90, 0x40, 0x99, 0x95, 0x0A, 0x81, 0xA4,
+    0x7A, 0x2C, 0x3A, 0xB0, 0x11, 0x02, 0x28, 0xF1, 0x91, 0x84, 0x08, 0x19, 0x18, 0xA9, 0x02, 0x13,
+    0xDA, 0xA5, 0x19, 0x93, 0x21, 0x4B, 0x1F, 0x93, 0x8A, 0x70, 0x8A, 0x18, 0x88, 0xD3, 0x93, 0xA0,
+    0x84, 0xB3, 0x1A, 0x04, 0xD0, 0x94, 0x99, 0xB3, 0x04, 0x08, 0xF2, 0x12, 0x8B, 0x96, 0x38, 0x8A,
+    0x1A, 0x50, 0x9A, 0xA3, 0x3B, 0xC7, 0x00, 0x91, 0x88, 0xB5, 0x01, 0x90, 0x95, 0xA8, 0x88, 0x40,
+    0x9A, 0x42, 0xBB, 0x12, 0x83, 0xA8, 0x59, 0x1A, 0x08, 0x2D, 0xF2, 0x92, 0x80, 0xA2, 0x81, 0x88,
+    0x4C, 0x1E, 0x92, 0xA0, 0x28, 0x0A, 0xB0, 0xFF, 0x0A, 0x80, 0x80, 0x01, 0x00, 0x01, 0x10,
+};
+
+// crack.wav: 7200 samples (450 ms), 3653 bytes
+static const uint8_t SFX_CRACK_ADPCM[3653] = {
+    0xBB, 0xF7, 0x00, 0x00, 0x77, 0xF7, 0x77, 0xE7, 0x9F, 0x37, 0x50, 0x9F, 0x00, 0x80, 0xE1, 0xB3,
+    0x01, 0x81, 0x14, 0x99, 0x09, 0x3C, 0x84, 0x8D, 0x03, 0x0D, 0x19, 0x19, 0xA0, 0x28, 0x71, 0xB8,
+    0x97, 0x80, 0x01, 0x99, 0xA0, 0x5A, 0x0A, 0x0C, 0x01, 0x09, 0x04, 0x30, 0x2D, 0xE3, 0x29, 0xE2,
+    0x00, 0x1A, 0x19, 0x92, 0x2C, 0x29, 0x81, 0x30, 0x40, 0x2D, 0x38, 0x0C, 0x1B, 0x0C, 0x39, 0xD3,
+    0x2A, 0x80, 0x20, 0xAB, 0x16, 0x5A, 0x89, 0xA2, 0xD1, 0x91, 0x98, 0xA0, 0x32, 0x5C, 0x2A, 0x9D,
+    0x84, 0x79, 0x09, 0x2A, 0x39, 0x0A, 0x88, 0x98, 0xAA, 0x86, 0x09, 0x91, 0x93, 0x9C, 0x16, 0x80,
+    0x82, 0xD8, 0x38, 0x81, 0x8C, 0x0B, 0x90, 0x80, 0x1E, 0x05, 0x10, 0x18, 0x91, 0x2B, 0x48, 0xE4,
+    0xB1, 0x80, 0xB0, 0x8B, 0x6A, 0x29, 0x5A, 0x19, 0x41, 0x8B, 0x22, 0x9A, 0x00, 0x5A, 0xEA, 0xC2,
+    0x88, 0x92, 0x08, 0x94, 0x59, 0x29, 0x01, 0x82, 0x81, 0x80, 0xEC, 0xD1, 0xA0, 0xB2, 0xB2, 0x82,
+    0x41, 0x58, 0xA1, 0x93, 0xB3, 0xC4, 0x10, 0xCA, 0xD3, 0x19, 0x88, 0x8B, 0x81, 0x84, 0x97, 0x81,
+    0x83, 0x10, 0x29, 0xEA, 0x91, 0xCB, 0x82, 0xC1, 0x48, 0x1B, 0x50, 0x00, 0x31, 0x88, 0x38, 0x9A,
+    0xA1, 0xF1, 0xAB, 0x2D, 0x89, 0xA8, 0x02, 0x14, 0x15, 0x33, 0x18, 0x99, 0x94, 0x9F, 0x8A, 0x1A,
+    0xD0, 0xA0, 0xB1, 0x32, 0x59, 0x96, 0x84, 0x00, 0x80, 0xB2, 0xC9, 0x1A, 0xC9, 0xC0, 0xB0, 0x00,
+    0x12, 0x25, 0x22, 0x14, 0x02, 0x3A, 0xAB, 0x1D, 0x9F, 0x98, 0xD9, 0x80, 0x80, 0x95, 0x32, 0x00,
+    0x12, 0x14, 0x29, 0xF0, 0x09, 0xB9, 0xAB, 0x0C, 0xC2, 0x90, 0x15, 0x32, 0x28, 0x85, 0x18, 0x82,
+    0xB8, 0xD9, 0x9C, 0xA1, 0x9B, 0x9D, 0x01, 0x12, 0x74, 0x00, 0x22, 0x38, 0x29, 0x99, 0x8E, 0xCB,
+    0x2B, 0xFD, 0x33, 0x00, 0x9C, 0x08, 0x20, 0x10, 0x85, 0x32, 0x30, 0x48, 0x13, 0x8C, 0xC9, 0xC8,
+    0xDA, 0x1B, 0x8A, 0xA1, 0x22, 0x34, 0x35, 0x33, 0x4A, 0x09, 0x99, 0xBC, 0xD0, 0xCB, 0x1A, 0xEA,
+    0x28, 0x20, 0x16, 0x12, 0x11, 0x21, 0x08, 0x9A, 0xBD, 0xAC, 0xA9, 0xBB, 0x3B, 0x3C, 0x63, 0x22,
+    0x24, 0x13, 0x04, 0x82, 0xBA, 0xBB, 0xBF, 0xAC, 0x8B, 0x09, 0xA1, 0x15, 0x16, 0x32, 0x11, 0x83,
+    0x01, 0x0C, 0xAE, 0xAA, 0xAC, 0x99, 0xB8, 0x41, 0x41, 0x62, 0x11, 0x33, 0x08, 0x11, 0xBB, 0x9F,
+    0xAC, 0xAA, 0xB8, 0xA1, 0x30, 0x43, 0x25, 0x34, 0x23, 0xA2, 0xC3, 0x8A, 0xAF, 0x9A, 0xBB, 0x9B,
+    0x09, 0x22, 0x54, 0x34, 0x33, 0x22, 0x31, 0x99, 0xAD, 0xBD, 0xAC, 0x8C, 0x9B, 0x19, 0x21, 0x54,
+    0x42, 0x31, 0x13, 0x81, 0xA0, 0xCA, 0xAE, 0x9C, 0x9B, 0xAA, 0x00, 0x32, 0x63, 0x25, 0x23, 0x20,
+    0x01, 0xA0, 0xDB, 0xBC, 0xAD, 0xAA, 0x99, 0x29, 0x31, 0x27, 0x42, 0x22, 0x13, 0x02, 0xC9, 0xCA,
+    0xAC, 0xBC, 0xAA, 0xA9, 0x10, 0x32, 0x27, 0x34, 0x32, 0x12, 0x01, 0xAA, 0xBD, 0xCD, 0x9A, 0xAB,
+    0x8A, 0x28, 0x41, 0x45, 0x22, 0x15, 0x11, 0x00, 0xB9, 0xCB, 0xEB, 0xAA, 0x9A, 0x99, 0x11, 0x42,
+    0x44, 0x33, 0x43, 0x21, 0x88, 0xB9, 0xDC, 0xBB, 0xBC, 0xBA, 0x89, 0x11, 0x44, 0x34, 0x34, 0x23,
+    0x22, 0xA0, 0xB9, 0xAF, 0xAD, 0xAB, 0xAB, 0x80, 0x20, 0x54, 0x32, 0x34, 0x33, 0x21, 0x89, 0xBB,
+    0xBF, 0xBC, 0xBB, 0xAA, 0x89, 0x22, 0x45, 0x34, 0x24, 0x23, 0x11, 0x98, 0xCB, 0xCC, 0xCB, 0xAB,
+    0x9B, 0x09, 0x31, 0x45, 0x43, 0x33, 0x33, 0xDF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x08, 0x08, 0x08, 0x88, 0x80, 0x80, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x77, 0x77, 0x7B, 0xE7,
+    0x21, 0xAB, 0xE4, 0x10, 0x4B, 0xA9, 0x11, 0xA1, 0x49, 0x82, 0x05, 0x0C, 0xF3, 0x80, 0x82, 0x39,
+    0x1D, 0x88, 0x1A, 0x03, 0x3B, 0x18, 0x9B, 0x87, 0xC1, 0xA8, 0x84, 0x90, 0x98, 0x30, 0x2F, 0x81,
+    0x8A, 0xB3, 0x14, 0x99, 0x68, 0x91, 0x1E, 0x39, 0x9C, 0x00, 0x91, 0x28, 0x80, 0x81, 0x72, 0x89,
+    0x84, 0x10, 0xAC, 0x88, 0x38, 0xAB, 0x9D, 0x86, 0x10, 0x2B, 0x81, 0x4B, 0xD5, 0x12, 0xB9, 0x20,
+    0x49, 0x09, 0xC9, 0xB0, 0x03, 0x10, 0x8B, 0x90, 0x87, 0x28, 0x83, 0x08, 0xA9, 0xD6, 0x80, 0xB2,
+    0xD0, 0xA4, 0x80, 0xC1, 0x84, 0x82, 0x22, 0x8B, 0x48, 0xE9, 0xB2, 0xA2, 0xB0, 0x09, 0xB0, 0x40,
+    0x69, 0x91, 0x29, 0x07, 0x98, 0x01, 0x8C, 0x90, 0xB1, 0xA1, 0xC0, 0xC1, 0x51, 0x00, 0xC1, 0x95,
+    0x01, 0x28, 0x9A, 0x7A, 0x9A, 0xB0, 0xA2, 0xA2, 0x11, 0x93, 0x2C, 0x31, 0x6C, 0x19, 0x4B, 0x09,
+    0xA8, 0x29, 0xB9, 0x08, 0xC4, 0x29, 0x89, 0x82, 0x54, 0x6A, 0x18, 0x0A, 0x81, 0x0A, 0xC5, 0x8A,
+    0x0C, 0x2A, 0x5A, 0xA0, 0x21, 0x70, 0x90, 0x00, 0x93, 0x88, 0x99, 0x9F, 0x10, 0x99, 0x1C, 0x21,
+    0x0A, 0x21, 0x35, 0xA9, 0x93, 0x68, 0xB0, 0x90, 0xAC, 0x93, 0x2F, 0x9B, 0x00, 0x19, 0x45, 0x98,
+    0x12, 0x48, 0x09, 0x08, 0xC9, 0xC8, 0x90, 0x2F, 0x9B, 0x21, 0x3A, 0x60, 0x30, 0x0A, 0x93, 0x93,
+    0xD7, 0x06, 0x2F, 0x00, 0xA8, 0x1B, 0xBF, 0x99, 0xB1, 0xD9, 0x04, 0x50, 0x19, 0x15, 0x90, 0x83,
+    0xA1, 0xB9, 0xAB, 0xF2, 0xB9, 0x2A, 0xA1, 0xB3, 0x87, 0x12, 0x21, 0x62, 0x19, 0x80, 0xCB, 0x89,
+    0x09, 0xEB, 0x2A, 0x2C, 0x10, 0x58, 0x01, 0x11, 0x42, 0x91, 0x01, 0xDB, 0x0A, 0xEC, 0x80, 0x89,
+    0x18, 0x29, 0x31, 0x44, 0x48, 0x30, 0xA1, 0xB8, 0xAA, 0xC9, 0xAD, 0x9A, 0x8B, 0xA8, 0x23, 0x24,
+    0x77, 0x00, 0x11, 0x88, 0x18, 0xC9, 0xCB, 0x99, 0xA0, 0xB8, 0x19, 0x16, 0x50, 0x11, 0x22, 0x30,
+    0xA1, 0xC1, 0xCC, 0xB0, 0xAB, 0x9B, 0x0E, 0x11, 0x23, 0x30, 0x16, 0x05, 0x12, 0xA0, 0xB8, 0x9A,
+    0xDC, 0xA9, 0x8D, 0xA8, 0x22, 0x11, 0x16, 0x32, 0x11, 0x40, 0x81, 0xA9, 0xAE, 0xAB, 0x9B, 0xD9,
+    0x0B, 0x30, 0x51, 0x42, 0x23, 0x04, 0x01, 0xA2, 0x8A, 0xCC, 0xAD, 0xA9, 0xBB, 0x1A, 0x02, 0x70,
+    0x15, 0x22, 0x12, 0x22, 0xA1, 0x9C, 0xCB, 0xBD, 0xAA, 0xAA, 0x8A, 0x33, 0x36, 0x51, 0x42, 0x01,
+    0x03, 0xA8, 0xC8, 0x8C, 0x9E, 0xB9, 0x98, 0x1A, 0x11, 0x62, 0x51, 0x21, 0x11, 0x02, 0x89, 0xBA,
+    0xBC, 0xEC, 0x9A, 0xA9, 0x00, 0x21, 0x53, 0x62, 0x31, 0x10, 0x82, 0x88, 0xBB, 0xAE, 0xBC, 0xAA,
+    0xA9, 0x18, 0x32, 0x54, 0x34, 0x33, 0x21, 0x03, 0xBB, 0xCB, 0xCD, 0xDB, 0x9A, 0x98, 0x18, 0x30,
+    0x73, 0x32, 0x33, 0x23, 0x18, 0xA9, 0xCD, 0xAC, 0xBB, 0xAD, 0x89, 0x10, 0x22, 0x54, 0x42, 0x22,
+    0x02, 0x93, 0xA8, 0xBD, 0xCC, 0xBA, 0xAB, 0x89, 0x00, 0x34, 0x35, 0x34, 0x43, 0x21, 0xA1, 0xA9,
+    0xBD, 0xDB, 0xDA, 0x99, 0x89, 0x10, 0x42, 0x33, 0x54, 0x21, 0x02, 0x91, 0x99, 0xCC, 0xAC, 0xAC,
+    0xA9, 0x89, 0x10, 0x44, 0x32, 0x34, 0x14, 0x12, 0x90, 0xB9, 0xBD, 0xBD, 0xBB, 0x9B, 0x98, 0x12,
+    0xE7, 0xFE, 0x14, 0x00, 0x27, 0x24, 0x33, 0x22, 0x82, 0xB9, 0xCC, 0xCC, 0xBB, 0xBA, 0x9A, 0x11,
+    0x43, 0x35, 0x44, 0x32, 0x21, 0x81, 0xA9, 0xCC, 0xAD, 0xBB, 0xAB, 0x9A, 0x10, 0x63, 0x53, 0x32,
+    0x43, 0xF1, 0x8A, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x88, 0x80, 0x80, 0x80, 0x00,
+    0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x77, 0x7F, 0x77, 0x37, 0x1F, 0x1D, 0xD4, 0x39, 0x1B, 0x88,
+    0x40, 0x90, 0x39, 0x1A, 0x95, 0xB9, 0x87, 0x2B, 0x91, 0x8A, 0x10, 0x09, 0x8E, 0x50, 0x88, 0x83,
+    0x0B, 0x32, 0xE1, 0x39, 0x9B, 0x28, 0x0C, 0x4A, 0x0D, 0x80, 0x30, 0x90, 0x21, 0xB0, 0x87, 0x02,
+    0x2A, 0xDA, 0xC5, 0x88, 0xB1, 0x40, 0xAA, 0x83, 0x5A, 0x28, 0x02, 0xD0, 0x82, 0x4C, 0x19, 0xA8,
+    0xC0, 0x28, 0xA0, 0xB1, 0xA9, 0x07, 0x92, 0x84, 0x49, 0x19, 0x09, 0xC8, 0x4C, 0x8A, 0x90, 0x29,
+    0x6D, 0x08, 0x0A, 0x83, 0x81, 0x4A, 0xA1, 0x98, 0xB2, 0xAA, 0x8F, 0x21, 0xBA, 0x07, 0x29, 0x01,
+    0x10, 0x01, 0x08, 0xD8, 0x89, 0x98, 0x30, 0xF9, 0x1A, 0x3B, 0xB8, 0x87, 0x85, 0x89, 0x83, 0x5A,
+    0x9A, 0x98, 0x03, 0x1D, 0x2A, 0x98, 0x2A, 0x99, 0x97, 0x19, 0x58, 0x10, 0x93, 0x2C, 0xC9, 0x28,
+    0x9F, 0x01, 0x08, 0x08, 0x23, 0x0A, 0x38, 0x20, 0xC4, 0x90, 0x20, 0x9F, 0xA1, 0xB0, 0xE0, 0x01,
+    0x19, 0x01, 0x04, 0x04, 0x1A, 0x32, 0x91, 0x00, 0xAF, 0xC3, 0xC8, 0x2A, 0x0B, 0x2A, 0x16, 0x1A,
+    0x51, 0x92, 0x1A, 0x95, 0x8A, 0xB8, 0xC0, 0x38, 0xDA, 0x89, 0xC6, 0x03, 0x10, 0x38, 0x32, 0x8D,
+    0xC3, 0x30, 0xBA, 0x88, 0x1F, 0xB8, 0x80, 0x10, 0x39, 0x73, 0x18, 0x01, 0x10, 0x2B, 0x1B, 0x1F,
+    0x0C, 0x99, 0x8B, 0x4A, 0x91, 0x41, 0x39, 0x58, 0x11, 0x80, 0xA4, 0xB9, 0x48, 0xAE, 0x90, 0x89,
+    0x08, 0x18, 0x82, 0x37, 0xA1, 0x24, 0x28, 0x1B, 0x89, 0x9F, 0x8C, 0x09, 0x9B, 0x20, 0x94, 0x1A,
+    0x27, 0x20, 0x10, 0x02, 0xD8, 0x00, 0xDB, 0x8A, 0x9A, 0xA1, 0xE2, 0x22, 0x01, 0x42, 0x05, 0x10,
+    0xFA, 0x07, 0x31, 0x00, 0xD2, 0x09, 0xC0, 0x9A, 0x89, 0xA8, 0xB9, 0x11, 0x41, 0x17, 0x82, 0x16,
+    0x88, 0x88, 0xB8, 0xB0, 0xCB, 0xCA, 0x1A, 0x18, 0x29, 0x52, 0x06, 0x22, 0x28, 0x93, 0x93, 0xC8,
+    0xE8, 0x9A, 0x9F, 0x08, 0x0A, 0x11, 0x68, 0x30, 0x28, 0x02, 0x41, 0xB8, 0xA9, 0x0B, 0xAF, 0x8A,
+    0x8B, 0x3A, 0x39, 0x73, 0x83, 0x33, 0x22, 0x23, 0x9C, 0xE9, 0x8A, 0xCC, 0x99, 0x9B, 0x88, 0x60,
+    0x20, 0x16, 0x02, 0x11, 0x28, 0x09, 0xAA, 0xBD, 0xDB, 0xAA, 0xA0, 0x3A, 0x32, 0x54, 0x32, 0x23,
+    0x42, 0xB3, 0xE1, 0x99, 0xAC, 0xBB, 0x9D, 0x1A, 0x90, 0x05, 0x32, 0x43, 0x33, 0x33, 0xA1, 0xC8,
+    0xE8, 0xCB, 0xB9, 0xAC, 0x98, 0x00, 0x12, 0x35, 0x54, 0x02, 0x13, 0x00, 0xA9, 0xAD, 0xBB, 0xBD,
+    0xA9, 0x9A, 0x20, 0x72, 0x31, 0x42, 0x23, 0x23, 0xA1, 0xD8, 0xDA, 0xC9, 0xBA, 0x9A, 0x9B, 0x02,
+    0x44, 0x52, 0x32, 0x23, 0x13, 0x80, 0xE8, 0x8C, 0xCC, 0x99, 0x9A, 0x09, 0x19, 0x34, 0x34, 0x43,
+    0x33, 0x02, 0xA2, 0x9C, 0xDC, 0xBB, 0xBB, 0xAC, 0x19, 0x20, 0x63, 0x43, 0x33, 0x43, 0x11, 0x88,
+    0xBB, 0xAE, 0xCC, 0xB9, 0x9A, 0x88, 0x20, 0x63, 0x73, 0xF7, 0x77, 0x0A, 0xF3, 0x49, 0x0A, 0xA0,
+    0xA3, 0x9A, 0xD2, 0xA2, 0x44, 0x0A, 0xA0, 0x12, 0x2B, 0x42, 0xF8, 0x19, 0x88, 0x2B, 0x19, 0xA6,
+    0xB8, 0x96, 0x08, 0x30, 0x18, 0xB2, 0x3B, 0x1B, 0x82, 0xAC, 0x41, 0x9F, 0x01, 0x80, 0x31, 0x2F,
+    0x09, 0x10, 0x91, 0x10, 0x98, 0x0B, 0xE4, 0x88, 0x82, 0x7A, 0x98, 0x39, 0x01, 0x09, 0x7A, 0xB9,
+    0x04, 0xA9, 0x18, 0x0D, 0xD2, 0x94, 0xB8, 0x32, 0xA1, 0x80, 0x32, 0xA1, 0x84, 0x8F, 0x59, 0x0A,
+    0x0B, 0x81, 0xA0, 0x0A, 0x93, 0xA7, 0x21, 0x90, 0xC3, 0x31, 0x3A, 0x8F, 0x12, 0x0D, 0x90, 0x00,
+    0x8A, 0xF3, 0x3F, 0x00, 0x58, 0x0A, 0x28, 0x15, 0x09, 0x81, 0x0C, 0x90, 0x98, 0xBC, 0xA5, 0x91,
+    0xB2, 0x31, 0x68, 0x2C, 0x81, 0x19, 0x20, 0x2C, 0xCB, 0x91, 0x00, 0x5A, 0x9D, 0x31, 0x99, 0x94,
+    0x03, 0xA4, 0x18, 0x60, 0x8C, 0xB2, 0x91, 0x3B, 0xD9, 0xA1, 0xC1, 0x00, 0x86, 0x91, 0x82, 0x82,
+    0x05, 0x2B, 0xCB, 0xA1, 0xAA, 0xF3, 0x93, 0x19, 0x19, 0x59, 0x12, 0x10, 0x38, 0xC1, 0x93, 0x0B,
+    0xFA, 0xC8, 0xC3, 0x08, 0x4B, 0x81, 0x58, 0x88, 0x85, 0x80, 0xB3, 0xA0, 0xD3, 0x0A, 0x09, 0xA9,
+    0x1A, 0x8B, 0x65, 0x39, 0x39, 0x38, 0x6A, 0xA1, 0xD2, 0x88, 0xBA, 0x10, 0xAB, 0xB0, 0xB1, 0x14,
+    0x17, 0x01, 0x23, 0xD3, 0x81, 0x0C, 0xA9, 0x9A, 0x3E, 0xB8, 0xA0, 0xA2, 0x15, 0x84, 0x14, 0xA0,
+    0x30, 0x14, 0xDB, 0x8A, 0xAB, 0x2C, 0xAB, 0x30, 0x1D, 0x28, 0x26, 0x22, 0x85, 0x00, 0x89, 0x1A,
+    0xEB, 0x0A, 0x9B, 0xC8, 0x4A, 0x92, 0x61, 0xA2, 0x41, 0x82, 0x10, 0xA1, 0xBC, 0x19, 0x0D, 0xAA,
+    0xB0, 0xA0, 0x69, 0x03, 0x22, 0x06, 0xA2, 0x00, 0x00, 0xC8, 0x9D, 0x9C, 0x19, 0xA9, 0x88, 0x84,
+    0x71, 0x22, 0x93, 0x32, 0xD3, 0xC1, 0xA0, 0x0B, 0x9E, 0x0B, 0xA0, 0x00, 0x19, 0x26, 0x04, 0x12,
+    0x01, 0x96, 0x08, 0xAB, 0xAA, 0xDA, 0x99, 0x8D, 0x01, 0x21, 0x14, 0x32, 0x17, 0x28, 0x29, 0xAA,
+    0xB8, 0xAF, 0xA8, 0x9A, 0x08, 0x19, 0x43, 0x31, 0x26, 0x02, 0x06, 0x19, 0xA8, 0xBB, 0xAA, 0xEB,
+    0xAB, 0x29, 0x28, 0x48, 0x44, 0x13, 0x25, 0x01, 0x88, 0xA2, 0xCE, 0xAA, 0xAA, 0xB8, 0xB1, 0x40,
+    0x61, 0x21, 0x24, 0x40, 0x00, 0x88, 0xAA, 0xE8, 0xC9, 0xB9, 0xAA, 0x09, 0x23, 0x23, 0x27, 0x34,
+    0x11, 0x11, 0x90, 0x9B, 0x9F, 0xBB, 0x9D, 0x8B, 0x08, 0x21, 0x72, 0x40, 0x21, 0x22, 0x00, 0xA1,
+    0xCD, 0x01, 0x1C, 0x00, 0xFA, 0xAA, 0xCA, 0x8A, 0x08, 0x19, 0x33, 0x34, 0x53, 0x14, 0x23, 0x1A,
+    0xA9, 0x9E, 0xBB, 0xBC, 0xAA, 0x8C, 0x22, 0x32, 0x53, 0x35, 0x22, 0x31, 0x88, 0xB8, 0xBE, 0xAD,
+    0xBA, 0xBA, 0x08, 0x18, 0x63, 0x34, 0x33, 0x42, 0x21, 0x80, 0xD9, 0xCB, 0xEA, 0x9A, 0xA9, 0x09,
+    0x30, 0x32, 0x27, 0x32, 0x23, 0x03, 0x08, 0xFA, 0xBA, 0xCB, 0xBB, 0x9A, 0x0B, 0x30, 0x45, 0x25,
+    0x13, 0x24, 0x01, 0x98, 0xAA, 0xBE, 0xBB, 0xBC, 0x9A, 0x08, 0x30, 0x36, 0x43, 0x43, 0x22, 0x02,
+    0xA0, 0xDB, 0xDB, 0xBA, 0xAC, 0x9A, 0x09, 0x42, 0x52, 0x43, 0x22, 0x23, 0x02, 0xA8, 0xDB, 0xDC,
+    0xAA, 0xBB, 0x99, 0x09, 0x33, 0x36, 0x44, 0x22, 0x13, 0x00, 0x98, 0xEA, 0xBC, 0xBB, 0xBB, 0x9A,
+    0x18, 0x52, 0x34, 0x35, 0x33, 0x14, 0x00, 0xA9, 0xCB, 0xBD, 0xAC, 0xAB, 0x8A, 0x18, 0x52, 0x53,
+    0x33, 0x24, 0x12, 0x00, 0xB8, 0xCC, 0xBC, 0xCB, 0xAB, 0x89, 0x18, 0x53, 0x53, 0x33, 0x24, 0xF2,
+    0x0B, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const AdpcmClip SFX_ASSET_TABLE[] = {
+    { SFX_CHIRP_ADPCM, 2028, 4000, 256, 16000 },
+    { SFX_GROWL_ADPCM, 4463, 8800, 256, 16000 },
+    { SFX_CRACK_ADPCM, 3653, 7200, 256, 16000 },
+};
@@ -1,7 +1,13 @@
 #include "sound.h"
 #include "sound_es8311.h"
+#include "sfx.h"
 #include "device_config.h"
-#include "navigation.h"          // for soundVolume extern
+
+#ifdef ARDUINO
+  #include "navigation.h"        // for soundVolume extern
+#else
+  extern uint8_t soundVolume;    // host: defined by the harness (tools/sound_render.cpp)
+#endif
 
 // ESP32 Arduino 3.x: ledcWriteTone(pin, freq); older: ledcWriteTone(channel, freq)
 #if defined(ESP_ARDUINO_VERSION) && ESP_ARDUINO_VERSION >= 0x030000
@@ -10,22 +16,62 @@
   #define BUZZER_LEDC_TARGET  BUZZER_CH
 #endif
 
+// ============ Output backend ============
+
+#ifdef ARDUINO
+// ES8311 render task (sound_es8311.h). Device-only: the host never links it.
+class SoundOutputEs8311 : public SoundOutput {
+public:
+    bool available() override             { return soundEs8311Available(); }
+    void send(const AudioMsg &m) override  { soundEs8311Send(m); }
+    void setHwVolume(int volume) override  { soundEs8311SetHwVolume(volume); }
+    bool playing() override                { return soundEs8311IsPlaying(); }
+};
+
+static SoundOutputEs8311 es8311Output;
+static SoundOutput *output = &es8311Output;
+#else
+static SoundOutput *output = nullptr;   // host: soundSetOutput() before use
+#endif
+
+static bool outAvailable() {
+    return output && output->available();
+}
+
+void soundSetOutput(SoundOutput *out) {
+    soundStopAll();                     // music state restarts on the new backend
+#ifdef ARDUINO
+    output = out ? out : &es8311Output;
+#else
+    output = out;
+#endif
+}
+
 // ============ PWM buzzer core ============
 
+// Host builds have no buzzer: tone writes vanish, time stands still.
+#ifdef ARDUINO
+static void buzzerTone(int freq)   { ledcWriteTone(BUZZER_LEDC_TARGET, freq); }
+static unsigned long buzzerNow()   { return millis(); }
+#else
+static void buzzerTone(int)        {}
+static unsigned long buzzerNow()   { return 0; }
+#endif
+
 static unsigned long buzzerEndTime = 0;
 
 void stopBuzzerIfNeeded() {
     if (buzzerEndTime == 0) return;
-    if (millis() > buzzerEndTime) {
-        ledcWriteTone(BUZZER_LEDC_TARGET, 0);
+    if (buzzerNow() > buzzerEndTime) {
+        buzzerTone(0);
         buzzerEndTime = 0;
     }
 }
 
 static void buzzerPlay(int freq, int durMs) {
     if (soundVolume == 0) return;
-    ledcWriteTone(BUZZER_LEDC_TARGET, freq);
-    buzzerEndTime = millis() + durMs;
+    buzzerTone(freq);
+    buzzerEndTime = buzzerNow() + durMs;
 }
 
 // ============ Ultra-Retro sequencer ============
@@ -38,6 +84,7 @@ struct RetroSound {
 
 static int  sndIndex = -1;
 static int  sndStep  = 0;
+static uint8_t sndPrio = MIX_PRIO_AMBIENT;   // buzzer has one voice: the more important sound keeps it
 static unsigned long sndNext = 0;
 
 // --- Tone tables ---
@@ -81,32 +128,54 @@ static const RetroSound* sndLookup(int idx) {
         case 4: return &SND_REST_START;
         case 5: return &SND_REST_END;
         case 6: return &SND_HATCH;
+        case 7: return &SND_DISC;      // evolution: buzzer has no chirp
         default: return nullptr;
     }
 }
 
+// --- Sampled effects (ES8311 only; the buzzer plays the tone table) ---
+
+struct SndClip {
+    int8_t sfx;          // SfxId, -1 = tones only
+    bool   withTones;    // clip plays under the tone sequence instead of replacing it
+};
+
+static SndClip sndClipFor(int idx) {
+    switch (idx) {
+        case 2: return { SFX_GROWL, false };   // bad feed
+        case 6: return { SFX_CRACK, true };    // hatch: shell cracks under the jingle
+        case 7: return { SFX_CHIRP, false };   // evolution
+        default: return { -1, false };
+    }
+}
+
 // ============ Public API ============
 
 bool soundInit() {
-    if (soundEs8311Init()) {
+#ifdef ARDUINO
+    if (output == &es8311Output) soundEs8311Init();
+#endif
+    if (outAvailable()) {
         return true;
     }
 
     // Fallback: PWM buzzer
-#if defined(ESP_ARDUINO_VERSION) && ESP_ARDUINO_VERSION >= 0x030000
+#ifdef ARDUINO
+  #if defined(ESP_ARDUINO_VERSION) && ESP_ARDUINO_VERSION >= 0x030000
     ledcAttach(BUZZER_PIN, 4000, 8);
-#else
+  #else
     ledcSetup(BUZZER_CH, 4000, 8);
     ledcAttachPin(BUZZER_PIN, BUZZER_CH);
+  #endif
 #endif
-    ledcWriteTone(BUZZER_LEDC_TARGET, 0);
+    buzzerTone(0);
     return false;
 }
 
 void sndUpdate() {
     if (soundVolume == 0) {
-        ledcWriteTone(BUZZER_LEDC_TARGET, 0);
-        soundEs8311Stop();
+        if (sndIndex >= 0 || buzzerEndTime != 0) buzzerTone(0);
+        if (output) output->send(audioMsgStop());
         sndIndex = -1;
         sndStep  = 0;
         return;
@@ -114,49 +183,48 @@ void sndUpdate() {
 
     if (sndIndex < 0) return;
 
-    // --- ES8311 (I2S) path ---
-    if (soundEs8311Available()) {
-        if (soundEs8311IsPlaying()) return;
-
-        const RetroSound *snd = sndLookup(sndIndex);
-        if (!snd) { sndIndex = -1; sndStep = 0; return; }
-
-        if (sndStep >= snd->length) {
-            soundEs8311Stop();
-            sndIndex = -1;
-            sndStep  = 0;
-            return;
-        }
-        soundEs8311SetTone(snd->freqs[sndStep], snd->times[sndStep]);
-        sndStep++;
-        return;
-    }
-
-    // --- PWM buzzer path ---
-    unsigned long now = millis();
+    // --- PWM buzzer path (ES8311 sequences run in the audio task) ---
+    unsigned long now = buzzerNow();
     if (now >= sndNext) {
         const RetroSound *snd = sndLookup(sndIndex);
         if (!snd) { sndIndex = -1; sndStep = 0; return; }
 
         if (sndStep >= snd->length) {
-            ledcWriteTone(BUZZER_LEDC_TARGET, 0);
+            buzzerTone(0);
             sndIndex = -1;
             sndStep  = 0;
             return;
         }
-        ledcWriteTone(BUZZER_LEDC_TARGET, snd->freqs[sndStep]);
+        buzzerTone(snd->freqs[sndStep]);
         sndNext = now + snd->times[sndStep];
         sndStep++;
     }
 }
 
-bool soundFeed() {
-    return soundEs8311Feed();
+// ============ Ambient music ============
+
+static uint8_t  musicTheme = MUSIC_NONE;
+static uint16_t musicTempo = 0;
+
+void sndMusic(uint8_t theme, uint16_t tempoPct) {
+    if (!outAvailable() || soundVolume == 0) theme = MUSIC_NONE;
+    if (theme == musicTheme && (theme == MUSIC_NONE || tempoPct == musicTempo)) return;
+
+    size_t len = 0;
+    const uint8_t *song = musicSong(theme, &len);
+    output->send(audioMsgMusic(song, len, tempoPct));
+    musicTheme = theme;
+    musicTempo = tempoPct;
+}
+
+bool soundIsActive() {
+    return (output && output->playing()) || buzzerEndTime != 0 || sndIndex >= 0;
 }
 
 void soundStopAll() {
-    ledcWriteTone(BUZZER_LEDC_TARGET, 0);
-    soundEs8311Stop();
+    buzzerTone(0);
+    if (output) output->send(audioMsgStop());
+    musicTheme = MUSIC_NONE;
     buzzerEndTime = 0;
     sndIndex = -1;
     sndStep  = 0;
@@ -165,45 +233,58 @@ void soundStopAll() {
 void soundSetVolume(uint8_t level) {
     // ES8311 hardware volume + tone amplitude mapping
     // 1 = тихий (бывший «3»), 2 = средний, 3 = громкий
+    if (!output) return;
+    int hw, amp;
     switch (level) {
-        case 3:  soundEs8311SetHwVolume(100); soundEs8311SetAmplitude(8000); break;
-        case 2:  soundEs8311SetHwVolume(88);  soundEs8311SetAmplitude(5000); break;
-        case 1:  soundEs8311SetHwVolume(72);  soundEs8311SetAmplitude(2500); break;
-        default: soundEs8311SetHwVolume(0);   soundEs8311SetAmplitude(0);    break;
+        case 3:  hw = 100; amp = 8000; break;
+        case 2:  hw = 88;  amp = 5000; break;
+        case 1:  hw = 72;  amp = 2500; break;
+        default: hw = 0;   amp = 0;    break;
     }
+    output->setHwVolume(hw);
+    output->send(audioMsgAmplitude(amp));
 }
 
 // --- Start sequence helpers ---
 
-static void sndStart(int idx) {
+// ES8311: every sound gets its own mixer voice. Buzzer: a lower-priority
+// sound never cuts off a higher-priority sequence that is still running.
+static void sndStart(int idx, uint8_t prio) {
     if (soundVolume == 0) return;
+    if (outAvailable()) {
+        SndClip clip = sndClipFor(idx);
+        if (clip.sfx >= 0) output->send(audioMsgClip(sfxClip((uint8_t)clip.sfx), prio));
+        if (clip.sfx >= 0 && !clip.withTones) return;
+        const RetroSound *snd = sndLookup(idx);
+        if (snd) output->send(audioMsgSequence(snd->freqs, snd->times, snd->length, prio));
+        return;
+    }
+    if (sndIndex >= 0 && prio < sndPrio) return;
     sndNext  = 0;
     sndIndex = idx;
     sndStep  = 0;
+    sndPrio  = prio;
 }
 
-void sndClick()     { sndStart(0); }
-void sndGoodFeed()  { sndStart(1); }
-void sndBadFeed()   { sndStart(2); }
-void sndDiscover()  { sndStart(3); }
-void sndRestStart() { sndStart(4); }
-void sndRestEnd()   { sndStart(5); }
-void sndHatch()     { sndStart(6); }
-
-void sndBeep() {
+static void sndBeepTone(int freq) {
     if (soundVolume == 0) return;
-    if (soundEs8311Available()) {
-        soundEs8311SetTone(800, 100);
-    } else {
-        buzzerPlay(800, 100);
+    if (outAvailable()) {
+        output->send(audioMsgTone(freq, 100, MIX_PRIO_UI));
+        return;
     }
+    if (sndIndex >= 0 && sndPrio > MIX_PRIO_UI) return;
+    sndIndex = -1;                 // beep replaces a UI-level sequence
+    buzzerPlay(freq, 100);
 }
 
-void sndBeepOk() {
-    if (soundVolume == 0) return;
-    if (soundEs8311Available()) {
-        soundEs8311SetTone(1000, 100);
-    } else {
-        buzzerPlay(1000, 100);
-    }
-}
+void sndClick()     { sndStart(0, MIX_PRIO_UI); }
+void sndGoodFeed()  { sndStart(1, MIX_PRIO_EVENT); }
+void sndBadFeed()   { sndStart(2, MIX_PRIO_EVENT); }
+void sndDiscover()  { sndStart(3, MIX_PRIO_EVENT); }
+void sndRestStart() { sndStart(4, MIX_PRIO_EVENT); }
+void sndRestEnd()   { sndStart(5, MIX_PRIO_EVENT); }
+void sndHatch()     { sndStart(6, MIX_PRIO_ALERT); }
+void sndEvolve()    { sndStart(7, MIX_PRIO_ALERT); }
+
+void sndBeep()   { sndBeepTone(800); }
+void sndBeepOk() { sndBeepTone(1000); }
@@ -1,20 +1,28 @@
 #pragma once
 
-#include <Arduino.h>
+#include <stdint.h>
+#include "music.h"          // MusicTheme
+#include "sound_output.h"   // SoundOutput
 
 // Initialize sound system: ES8311 (I2S) + PWM buzzer fallback.
 // Returns true if ES8311 is available.
 bool soundInit();
 
-// Sequencer step — call every loop() to advance multi-tone sequences.
-void sndUpdate();
+// Route effects to another backend (e.g. SoundOutputOffline on the host);
+// nullptr = ES8311 on device, no output (buzzer path only) on the host.
+// Stops whatever the previous backend was playing. Call before soundInit().
+void soundSetOutput(SoundOutput *out);
 
-// Feed I2S buffer — call every loop(), multiple times. Returns true while playing.
-bool soundFeed();
+// Sequencer step for the PWM buzzer fallback — call every loop().
+// On ES8311 sequences and tones are rendered by the audio task (sound_es8311.h).
+void sndUpdate();
 
 // Stop PWM buzzer if tone duration expired.
 void stopBuzzerIfNeeded();
 
+// True while anything is audible (ES8311 tone, buzzer or sequence).
+bool soundIsActive();
+
 // Stop all sound output immediately (buzzer + ES8311).
 void soundStopAll();
 
@@ -30,6 +38,14 @@ void sndDiscover();
 void sndRestStart();
 void sndRestEnd();
 void sndHatch();
+void sndEvolve();
+
+// ---------- Ambient music (ES8311 only) ----------
+
+// Play theme in a loop under the effects; MUSIC_NONE stops it. Cheap to call
+// every loop(): only a change of theme / tempo reaches the audio task.
+// Silent on the PWM fallback and at volume 0. soundStopAll() stops it too.
+void sndMusic(uint8_t theme, uint16_t tempoPct);
 
 // ---------- Simple beeps (button feedback) ----------
 
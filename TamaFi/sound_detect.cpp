@@ -0,0 +1,172 @@
+#include "sound_detect.h"
+
+#include <string.h>
+
+// ============ Compile-time tables ============
+
+namespace {
+
+constexpr double PI = 3.14159265358979323846;
+
+// Taylor series on [-pi, pi]
+constexpr double ctCos(double x) {
+    while (x > PI)  x -= 2 * PI;
+    while (x < -PI) x += 2 * PI;
+    double term = 1, sum = 1;
+    for (int k = 1; k < 14; k++) {
+        term *= -x * x / ((2.0 * k - 1) * (2.0 * k));
+        sum += term;
+    }
+    return sum;
+}
+
+struct Tables {
+    int16_t hann[DETECT_FRAME];       // Q15
+    int32_t coeff[DETECT_BINS];       // 2 cos(w), Q14
+
+    constexpr Tables() : hann(), coeff() {
+        for (int n = 0; n < DETECT_FRAME; n++)
+            hann[n] = (int16_t)((0.5 - 0.5 * ctCos(2 * PI * n / DETECT_FRAME)) * 32767.0 + 0.5);
+        for (int k = 0; k < DETECT_BINS; k++) {
+            double w = 2 * PI * (DETECT_BIN_LO + k) / DETECT_FRAME;
+            double c = 2 * ctCos(w) * 16384.0;
+            coeff[k] = (int32_t)(c + (c >= 0 ? 0.5 : -0.5));
+        }
+    }
+};
+
+constexpr Tables T;
+
+static_assert(T.hann[DETECT_FRAME / 2] == 32767, "hann peak");
+static_assert(DETECT_BIN_LO + DETECT_BINS <= DETECT_FRAME / 2, "whistle band above Nyquist");
+
+uint32_t isqrt64(uint64_t v) {
+    uint64_t r = 0, bit = 1ULL << 62;
+    while (bit > v) bit >>= 2;
+    while (bit) {
+        if (v >= r + bit) { v -= r + bit; r = (r >> 1) + bit; }
+        else              { r >>= 1; }
+        bit >>= 2;
+    }
+    return (uint32_t)r;
+}
+
+} // namespace
+
+// ============ Detector ============
+
+void detectInit(SoundDetector &d) {
+    memset(&d, 0, sizeof(d));
+    d.floor   = -1;           // set from the first frame
+    d.peakBin = -1;
+}
+
+void detectHold(SoundDetector &d) {
+    d.clapPeak   = 0;
+    d.whistleRun = 0;
+    d.loudRun    = 0;
+    d.prevEnergy = 0;
+}
+
+static bool fire(SoundDetector &d, int kind) {
+    if (d.cooldown[kind]) return false;
+    d.cooldown[kind] = DETECT_COOLDOWN_FRAMES;
+    return true;
+}
+
+uint8_t detectFrame(SoundDetector &d, const int16_t *x) {
+    // Energy, raw and windowed
+    int16_t xw[DETECT_FRAME];
+    int64_t e = 0, ew = 0;
+    for (int n = 0; n < DETECT_FRAME; n++) {
+        int32_t s = x[n];
+        e += s * s;
+        int32_t w = (s * T.hann[n]) >> 15;
+        xw[n] = (int16_t)w;
+        ew += w * w;
+    }
+
+    // Goertzel bank over the whistle band
+    int64_t best = 0;
+    int8_t  bestBin = -1;
+    for (int k = 0; k < DETECT_BINS; k++) {
+        int64_t c = T.coeff[k];
+        int32_t s1 = 0, s2 = 0;
+        for (int n = 0; n < DETECT_FRAME; n++) {
+            int32_t s0 = xw[n] + (int32_t)((c * s1) >> 14) - s2;
+            s2 = s1;
+            s1 = s0;
+        }
+        int64_t p = (int64_t)s1 * s1 + (int64_t)s2 * s2 - ((c * s1 >> 14) * s2);
+        if (p > best) { best = p; bestBin = (int8_t)k; }
+    }
+
+    // 256 = pure sine on a bin: |X|^2 = (A N / 4)^2, windowed energy = 3 A^2 N / 16
+    uint32_t tonal = ew > 0 ? (uint32_t)(best * 768 / (ew * DETECT_FRAME)) : 0;
+
+    d.rms     = (uint16_t)isqrt64((uint64_t)(e / DETECT_FRAME));
+    d.tonal   = (uint16_t)(tonal > 65535 ? 65535 : tonal);
+    d.peakBin = bestBin;
+    if (d.floor < 0) d.floor = e;
+
+    for (int i = 0; i < 3; i++) if (d.cooldown[i]) d.cooldown[i]--;
+
+    uint8_t evt    = SOUND_EVT_NONE;
+    bool    audible = d.rms >= DETECT_MIN_RMS;
+
+    // Clap: sharp broadband onset, gone within a few frames
+    if (d.clapPeak > 0) {
+        d.clapAge++;
+        if (e > d.clapPeak) d.clapPeak = e;
+        if (e * 8 < d.clapPeak) {
+            if (fire(d, 0)) evt |= SOUND_EVT_CLAP;
+            d.clapPeak = 0;
+        } else if (d.clapAge >= DETECT_CLAP_FRAMES) {
+            d.clapPeak = 0;                     // too long for a clap
+        }
+    } else if (audible && e > d.prevEnergy * DETECT_ONSET_RISE && e > d.floor * DETECT_ONSET_FLOOR &&
+               tonal < DETECT_CLAP_TONAL_MAX) {
+        d.clapPeak = e;
+        d.clapAge  = 0;
+    }
+
+    // Whistle: tonal, steady-ish pitch, held
+    if (audible && tonal >= DETECT_TONAL_MIN && e > d.floor * 4) {
+        int drift = bestBin - d.whistleBin;
+        if (d.whistleRun && (drift > DETECT_WHISTLE_DRIFT || drift < -DETECT_WHISTLE_DRIFT)) d.whistleRun = 0;
+        d.whistleBin = bestBin;
+        if (d.whistleRun < 255) d.whistleRun++;
+        if (d.whistleRun == DETECT_WHISTLE_FRAMES && fire(d, 1)) evt |= SOUND_EVT_WHISTLE;
+    } else {
+        d.whistleRun = 0;
+    }
+
+    // Loud: sustained level
+    if (d.rms >= DETECT_LOUD_RMS) {
+        if (d.loudRun < 255) d.loudRun++;
+        if (d.loudRun == DETECT_LOUD_FRAMES && fire(d, 2)) evt |= SOUND_EVT_LOUD;
+    } else {
+        d.loudRun = 0;
+    }
+
+    // Noise floor: quick to fall, slow to rise, frozen during events
+    if (d.clapPeak == 0 && d.whistleRun == 0 && d.loudRun == 0) {
+        if (e < d.floor) d.floor += (e - d.floor) / 16;
+        else             d.floor += (e - d.floor) / 256;
+    }
+    d.prevEnergy = e;
+    return evt;
+}
+
+uint16_t detectFloorRms(const SoundDetector &d) {
+    return d.floor > 0 ? (uint16_t)isqrt64((uint64_t)(d.floor / DETECT_FRAME)) : 0;
+}
+
+const char *detectEventName(uint8_t evt) {
+    switch (evt) {
+        case SOUND_EVT_CLAP:    return "clap";
+        case SOUND_EVT_WHISTLE: return "whistle";
+        case SOUND_EVT_LOUD:    return "loud";
+        default:                return "?";
+    }
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <stdint.h>
+
+// ============ Sound event detection ============
+//
+// Cheap classifier for microphone frames: claps, whistles and loud noise.
+// Per frame of DETECT_FRAME samples:
+//   - energy (sum of squares) against a slowly tracked noise floor
+//   - a Goertzel filter on every DFT bin of the whistle band, Hann-windowed
+//     frame; "tonality" = strongest bin vs. frame energy, 256 = pure sine
+// Clap  = sudden broadband onset that dies out within DETECT_CLAP_FRAMES.
+// Whistle = tonal frames in the band for DETECT_WHISTLE_FRAMES in a row.
+// Loud  = level above DETECT_LOUD_RMS for DETECT_LOUD_FRAMES in a row.
+// Fixed point throughout (int32 filters, int64 power). Pure logic, runs on
+// the host (tools/sound_detect_run.cpp).
+
+#define DETECT_RATE            16000
+#define DETECT_FRAME           256       // 16 ms
+#define DETECT_BIN_LO          16        // whistle band in DFT bins of 62.5 Hz: 1000 Hz ..
+#define DETECT_BINS            33        // .. 3000 Hz, one filter per bin (Hann: <= 1.4 dB scallop)
+
+#define DETECT_TONAL_MIN       90        // tonality for a whistle frame (256 = pure sine)
+#define DETECT_WHISTLE_FRAMES  10        // 160 ms
+#define DETECT_WHISTLE_DRIFT   2         // max bins the pitch may move per frame
+#define DETECT_ONSET_RISE      8         // clap: energy x8 (+9 dB) over the previous frame
+#define DETECT_ONSET_FLOOR     32        // ... and x32 (+15 dB) over the noise floor
+#define DETECT_CLAP_FRAMES     4         // ... and back under peak/8 within 64 ms
+#define DETECT_CLAP_TONAL_MAX  60
+#define DETECT_LOUD_RMS        5000      // about -16 dBFS
+#define DETECT_LOUD_FRAMES     20        // 320 ms
+#define DETECT_COOLDOWN_FRAMES 60        // one event per kind per ~1 s
+#define DETECT_MIN_RMS         200       // quieter frames never trigger anything
+
+enum SoundEvent : uint8_t {
+    SOUND_EVT_NONE    = 0,
+    SOUND_EVT_CLAP    = 1 << 0,
+    SOUND_EVT_WHISTLE = 1 << 1,
+    SOUND_EVT_LOUD    = 1 << 2,
+};
+
+struct SoundDetector {
+    int64_t  floor;           // noise floor, frame energy units
+    int64_t  prevEnergy;
+    int64_t  clapPeak;        // > 0 while a clap candidate is open
+    uint8_t  clapAge;
+    uint8_t  whistleRun;
+    int8_t   whistleBin;
+    uint8_t  loudRun;
+    uint8_t  cooldown[3];     // per event kind
+
+    // Last frame, for diagnostics
+    uint16_t rms;
+    uint16_t tonal;           // 0..~256
+    int8_t   peakBin;         // -1 = none
+};
+
+void detectInit(SoundDetector &d);
+
+// Classify one frame of DETECT_FRAME mono samples. Returns a SoundEvent mask.
+uint8_t detectFrame(SoundDetector &d, const int16_t *frame);
+
+// Forget candidates, e.g. while the speaker plays (own sound is not an event).
+void detectHold(SoundDetector &d);
+
+// Noise floor as RMS
+uint16_t detectFloorRms(const SoundDetector &d);
+
+const char *detectEventName(uint8_t evt);
@@ -5,27 +5,163 @@
 #include "sound_es8311.h"
 #include "device_config.h"
 #include "es8311.h"
+#include "i2c_bus.h"
+#include "audio_engine.h"
+#include "audio_ring.h"
 #include <Wire.h>
-#include <math.h>
+#include <atomic>
+#include <string.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
 
 // ESP_I2S.h — из пакета платы (WAVESHARE_ESP32_S3_1.8_AMOLED / MiiBestOD)
 #include "ESP_I2S.h"
 
 #define I2S_SAMPLE_RATE  16000
 #define I2S_NUM_CH       2
-#define TONE_BUF_SAMPLES 1024    // больше буфер — меньше прерываний при занятом loop()
-static int toneAmplitude = 2500; // программная амплитуда (управляется через soundSetVolume)
+
+// Рендер опережает I2S на AUDIO_RING_SAMPLES (32 мс), пишется в I2S кусками по WRITE_CHUNK (8 мс)
+#define AUDIO_RING_SAMPLES  512
+#define RENDER_BLOCK        128
+#define WRITE_CHUNK         128
+#define SILENCE_CHUNKS      32     // после конца звука: 256 мс нулей через DMA (как раньше), потом спать
+#define MSG_QUEUE_LEN       8
 
 static I2SClass i2s;
 static void* es8311_handle = nullptr;
 static bool inited = false;
 
-// Неблокирующий тон: частота, конец по времени, сколько сэмплов уже выведено, всего нужно.
-static int toneFreqHz = 0;
-static unsigned long toneEndMs = 0;
-static uint32_t toneSamplesWritten = 0;
-static uint32_t toneSamplesTotal = 0;
-static float tonePhase = 0.f;
+// ============ Control messages (loop -> audio task) ============
+
+// AudioMsg и синтез — audio_engine.h (тот же движок рендерит на хосте)
+
+static QueueHandle_t msgQueue   = nullptr;
+static TaskHandle_t  renderTask = nullptr;
+static TaskHandle_t  writerTask = nullptr;
+
+static int toneAmplitude = 2500;   // программная амплитуда (управляется через soundSetVolume)
+
+// ============ Shared state (render task <-> writer task) ============
+
+static int16_t   ringStorage[AUDIO_RING_SAMPLES];
+static AudioRing ring;
+
+static std::atomic<bool>     playing(false);     // голос звучит или кольцо ещё не доиграно
+static std::atomic<bool>     voiceActive(false); // у микшера ещё есть что синтезировать
+static std::atomic<bool>     flushReq(false);    // render просит writer выбросить кольцо
+static std::atomic<uint32_t> underruns(0);
+static std::atomic<uint32_t> minFill(AUDIO_RING_SAMPLES);
+static std::atomic<uint32_t> droppedMsgs(0);
+static std::atomic<uint32_t> activeVoices(0);    // публикует render task: голосов звучит
+static std::atomic<uint32_t> mixSteals(0);       // копии engine.mix.steals / drops (растут)
+static std::atomic<uint32_t> mixDrops(0);
+
+// ============ Writer task: ring -> I2S DMA ============
+
+static void writerTaskFn(void*) {
+  int16_t mono[WRITE_CHUNK];
+  int16_t stereo[WRITE_CHUNK * I2S_NUM_CH];
+  int silent = SILENCE_CHUNKS;
+
+  for (;;) {
+    if (flushReq.load()) {
+      audioRingDiscard(ring);
+      flushReq.store(false);
+    }
+
+    bool streaming = voiceActive.load();
+    uint32_t fill = audioRingFill(ring);
+    if (streaming && fill < minFill.load()) minFill.store(fill);
+
+    uint32_t n = audioRingRead(ring, mono, WRITE_CHUNK);
+    if (n == 0) {
+      if (streaming) {
+        underruns++;                       // render не успел: DMA получит тишину
+      } else if (silent >= SILENCE_CHUNKS) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        continue;
+      }
+      memset(mono, 0, sizeof(mono));
+      n = WRITE_CHUNK;
+      silent++;
+    } else {
+      silent = 0;
+    }
+
+    for (uint32_t i = 0; i < n; i++) {
+      stereo[i * 2] = mono[i];
+      stereo[i * 2 + 1] = mono[i];
+    }
+    i2s.write((const uint8_t*)stereo, n * I2S_NUM_CH * sizeof(int16_t));   // ждёт места в DMA
+    if (renderTask) xTaskNotifyGive(renderTask);
+  }
+}
+
+// ============ Render task: messages + synthesis -> ring ============
+
+// Выбросить уже отрендеренное (стоп должен звучать сразу)
+static void flushRing() {
+  flushReq.store(true);
+  xTaskNotifyGive(writerTask);
+  while (flushReq.load()) vTaskDelay(1);
+}
+
+static AudioEngine engine;   // только render task; наружу — через activeVoices / mixSteals / mixDrops
+
+static void renderTaskFn(void*) {
+  alignas(16) int16_t block[RENDER_BLOCK];
+
+  for (;;) {
+    // Пока звучит — просыпаемся по освобождению места в кольце; в тишине ждём только сообщения
+    TickType_t wait = playing.load() ? 0 : portMAX_DELAY;
+    AudioMsg m;
+    while (xQueueReceive(msgQueue, &m, wait) == pdTRUE) {
+      wait = 0;
+      // новые звуки накладываются на звучащие (задержка <= кольцо, 32 мс),
+      // новая песня сменяет старую без сброса кольца (стык <= 32 мс)
+      audioEngineApply(engine, m);
+      if (m.type == AUDIO_MSG_STOP) {
+        voiceActive.store(false);
+        flushRing();
+      }
+    }
+
+    while (audioEngineActive(engine) && audioRingFree(ring) >= RENDER_BLOCK) {
+      int n = audioEngineRender(engine, block, RENDER_BLOCK);
+      audioRingWrite(ring, block, (uint32_t)n);
+      xTaskNotifyGive(writerTask);
+    }
+    voiceActive.store(audioEngineActive(engine));
+    activeVoices.store((uint32_t)mixerActiveVoices(engine.mix));
+    mixSteals.store(engine.mix.steals);
+    mixDrops.store(engine.mix.drops);
+    playing.store(audioEngineActive(engine) || audioRingFill(ring) > 0 || uxQueueMessagesWaiting(msgQueue) > 0);
+
+    if (playing.load()) {
+      ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(10));    // writer забрал кусок (или дозвучивание)
+    }
+  }
+}
+
+static bool audioTasksStart() {
+  audioEngineInit(engine, I2S_SAMPLE_RATE, (int16_t)toneAmplitude);
+  audioRingInit(ring, ringStorage, AUDIO_RING_SAMPLES);
+  msgQueue = xQueueCreate(MSG_QUEUE_LEN, sizeof(AudioMsg));
+  if (!msgQueue) return false;
+  if (xTaskCreatePinnedToCore(writerTaskFn, "i2s_out", 3072, nullptr, SOUND_WRITER_PRIO, &writerTask, 0) != pdPASS)
+    return false;
+  if (xTaskCreatePinnedToCore(renderTaskFn, "audio", 3072, nullptr, SOUND_RENDER_PRIO, &renderTask, 0) != pdPASS)
+    return false;
+  return true;
+}
+
+static void post(const AudioMsg& m) {
+  if (!inited) return;
+  if (xQueueSend(msgQueue, &m, 0) != pdTRUE) droppedMsgs++;
+}
+
+// ============ Public API ============
 
 bool soundEs8311Init(void) {
   if (inited) return true;
@@ -64,74 +200,70 @@ bool soundEs8311Init(void) {
     es8311_handle = nullptr;
     return false;
   }
+  es8311_microphone_gain_set(es8311_handle, (es8311_mic_gain_t)MIC_GAIN);   // АЦП для mic.cpp
+
   // Громкость умеренная (чтобы не «орало» и не клипило)
   es8311_voice_volume_set(es8311_handle, 72, nullptr);
   es8311_voice_mute(es8311_handle, false);
 
+  if (!audioTasksStart()) return false;
+
   inited = true;
   return true;
 }
 
-void soundEs8311Stop(void) {
-  toneEndMs = 0;
-  toneSamplesTotal = 0;
-  toneSamplesWritten = 0;
-  if (inited) {
-    static int16_t silence[TONE_BUF_SAMPLES * 2];
-    for (int i = 0; i < TONE_BUF_SAMPLES * 2; i++) silence[i] = 0;
-    for (int k = 0; k < 4; k++)
-      i2s.write((const uint8_t*)silence, sizeof(silence));
+void soundEs8311Send(const AudioMsg& m) {
+  if (m.type == AUDIO_MSG_AMPLITUDE) toneAmplitude = m.amplitude;   // и до init: начальная амплитуда движка
+  if (!inited) return;
+  switch (m.type) {
+    case AUDIO_MSG_STOP:
+      if (!playing.load()) return;
+      playing.store(false);
+      break;
+    case AUDIO_MSG_PLAY:
+      if (m.freqHz == 0 || m.durationMs == 0) return;
+      playing.store(true);                // видно сразу, до того как task возьмёт сообщение
+      break;
+    case AUDIO_MSG_SEQUENCE:
+      if (!m.freqs || !m.times || m.length <= 0) return;
+      playing.store(true);
+      break;
+    case AUDIO_MSG_CLIP:
+      if (!m.clip) return;
+      playing.store(true);
+      break;
+    case AUDIO_MSG_MUSIC:
+      if (m.song) playing.store(true);
+      break;
+    case AUDIO_MSG_AMPLITUDE:
+      break;
   }
+  post(m);
+}
+
+void soundEs8311Stop(void) {
+  soundEs8311Send(audioMsgStop());
 }
 
-void soundEs8311SetTone(int freqHz, int durationMs) {
+void soundEs8311SetTone(int freqHz, int durationMs, uint8_t prio) {
   if (freqHz <= 0 || durationMs <= 0) return;
-  toneFreqHz = freqHz;
-  toneEndMs = millis() + (unsigned long)durationMs;
-  toneSamplesTotal = (uint32_t)((long)I2S_SAMPLE_RATE * durationMs / 1000) * I2S_NUM_CH;
-  toneSamplesWritten = 0;
-  tonePhase = 0.f;
+  soundEs8311Send(audioMsgTone(freqHz, durationMs, prio));
 }
 
-bool soundEs8311Feed(void) {
-  if (!inited || toneEndMs == 0 || toneSamplesWritten >= toneSamplesTotal) {
-    return false;
-  }
-  if (millis() >= toneEndMs) {
-    toneEndMs = 0;
-    return false;
-  }
+void soundEs8311PlaySequence(const int* freqs, const int* times, int length, uint8_t prio) {
+  soundEs8311Send(audioMsgSequence(freqs, times, length, prio));
+}
 
-  const float omega = 6.28318530718f * (float)toneFreqHz / (float)I2S_SAMPLE_RATE;
-  int16_t buf[TONE_BUF_SAMPLES * 2];
-  int toGen = (int)(toneSamplesTotal - toneSamplesWritten);
-  if (toGen > TONE_BUF_SAMPLES * I2S_NUM_CH)
-    toGen = TONE_BUF_SAMPLES * I2S_NUM_CH;
-  const int numStereoSamples = toGen / 2;
-
-  // Лёгкое сглаживание в начале/конце тона (убирает щелчки и резкость)
-  const int fadeLen = (numStereoSamples < 64) ? (numStereoSamples / 2) : 32;
-  for (int i = 0; i < numStereoSamples; i++) {
-    float gain = 1.0f;
-    if (i < fadeLen)
-      gain = (float)i / (float)fadeLen;
-    else if (i >= numStereoSamples - fadeLen)
-      gain = (float)(numStereoSamples - 1 - i) / (float)fadeLen;
-    int16_t s = (int16_t)(toneAmplitude * gain * sinf(tonePhase));
-    tonePhase += omega;
-    buf[i * 2] = s;
-    buf[i * 2 + 1] = s;
-  }
-  size_t wrote = i2s.write((const uint8_t*)buf, (size_t)toGen * 2);
-  if (wrote > 0)
-    toneSamplesWritten += (uint32_t)(wrote / 2);
-  if (toneSamplesWritten >= toneSamplesTotal || millis() >= toneEndMs)
-    toneEndMs = 0;
-  return (toneEndMs != 0);
+void soundEs8311PlayMusic(const uint8_t* song, size_t len, uint16_t tempoPct) {
+  soundEs8311Send(audioMsgMusic(song, len, tempoPct));
+}
+
+void soundEs8311PlayClip(const AdpcmClip* clip, uint8_t prio) {
+  soundEs8311Send(audioMsgClip(clip, prio));
 }
 
 bool soundEs8311IsPlaying(void) {
-  return (toneEndMs != 0);
+  return playing.load();
 }
 
 bool soundEs8311Available(void) {
@@ -140,10 +272,35 @@ bool soundEs8311Available(void) {
 
 void soundEs8311SetHwVolume(int volume) {
   if (inited && es8311_handle) {
+    i2cLock(I2C_DEV_AUDIO);
     es8311_voice_volume_set(es8311_handle, volume, nullptr);
+    i2cUnlock(I2C_DEV_AUDIO);
   }
 }
 
 void soundEs8311SetAmplitude(int amplitude) {
-  toneAmplitude = amplitude;
+  soundEs8311Send(audioMsgAmplitude(amplitude));
+}
+
+size_t soundEs8311MicRead(int16_t* stereo, size_t frames) {
+  if (!inited) return 0;
+  size_t got = i2s.readBytes((char*)stereo, frames * I2S_NUM_CH * sizeof(int16_t));
+  return got / (I2S_NUM_CH * sizeof(int16_t));
+}
+
+void soundEs8311TakeStats(SoundStats& out) {
+  out.underruns = underruns.exchange(0);
+  out.minFill   = minFill.exchange(AUDIO_RING_SAMPLES);
+  out.fill      = inited ? audioRingFill(ring) : 0;
+  out.capacity  = AUDIO_RING_SAMPLES;
+  out.dropped   = droppedMsgs.exchange(0);
+
+  // Счётчики микшера публикует render task, здесь только разность с прошлым вызовом
+  static uint32_t lastSteals = 0, lastDrops = 0;
+  uint32_t steals = mixSteals.load(), drops = mixDrops.load();
+  out.voices      = activeVoices.load();
+  out.steals      = steals - lastSteals;
+  out.voiceDrops  = drops - lastDrops;
+  lastSteals = steals;
+  lastDrops  = drops;
 }
@@ -2,20 +2,37 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include "audio_engine.h"   // AudioMsg, MixPrio
 
 // Инициализация ES8311 + I2S (PA pin, I2S pins, кодек). Вызывать после Wire.begin().
 // Возвращает true при успехе.
 bool soundEs8311Init(void);
 
-// Остановить вывод тона (тишина).
+// Звук рендерит отдельная задача "audio" в кольцо, задача "i2s_out" (выше приоритетом)
+// перекладывает его в I2S DMA. Функции ниже только отправляют сообщения и не блокируют.
+#define SOUND_RENDER_PRIO  5
+#define SOUND_WRITER_PRIO  6
+
+// Отправить сообщение движку (audio_engine.h). Функции ниже — обёртки над ним.
+void soundEs8311Send(const AudioMsg& m);
+
+// Остановить вывод тона (тишина). Не ждёт: нули в DMA проталкивает задача.
 void soundEs8311Stop(void);
 
-// Задать тон для неблокирующего воспроизведения: частота Hz, длительность ms.
-// Реальное воспроизведение идёт в soundEs8311Feed(), вызываемом из loop().
-void soundEs8311SetTone(int freqHz, int durationMs);
+// Тон: частота Hz, длительность ms. Звучит поверх остальных (MIX_VOICES голосов),
+// при нехватке голосов вытесняет менее приоритетный.
+void soundEs8311SetTone(int freqHz, int durationMs, uint8_t prio = MIX_PRIO_UI);
+
+// Последовательность тонов без пауз между шагами (таблицы должны жить всё время работы).
+void soundEs8311PlaySequence(const int* freqs, const int* times, int length, uint8_t prio);
 
-// Подать порцию данных в I2S (вызывать из loop). Возвращает true, пока идёт воспроизведение.
-bool soundEs8311Feed(void);
+// Сэмпл ADPCM (sfx.h) поверх остальных звуков, как тон. Клип живёт во flash.
+void soundEs8311PlayClip(const AdpcmClip* clip, uint8_t prio);
+
+// Фоновая музыка: блоб трекера (tracker.h), играет по кругу под эффектами.
+// tempoPct — темп в % от записанного. song = nullptr — выключить. soundEs8311Stop() тоже выключает.
+void soundEs8311PlayMusic(const uint8_t* song, size_t len, uint16_t tempoPct);
 
 // Идёт ли сейчас воспроизведение тона (нужно для пошаговых звуков).
 bool soundEs8311IsPlaying(void);
@@ -28,3 +45,20 @@ void soundEs8311SetHwVolume(int volume);
 
 // Установить амплитуду тона (программная громкость генератора).
 void soundEs8311SetAmplitude(int amplitude);
+
+// Микрофон (АЦП ES8311, I2S RX): прочитать до frames стерео-кадров, ждёт DMA.
+// Только для задачи захвата (mic.cpp). Возвращает число кадров.
+size_t soundEs8311MicRead(int16_t* stereo, size_t frames);
+
+// Метрики аудио-конвейера с прошлого вызова.
+struct SoundStats {
+  uint32_t underruns;   // кусков тишины, отданных в DMA посреди звука
+  uint32_t fill;        // сэмплов в кольце сейчас
+  uint32_t minFill;     // минимум заполнения во время звука
+  uint32_t capacity;
+  uint32_t dropped;     // сообщений, не влезших в очередь
+  uint32_t voices;      // голосов звучит сейчас
+  uint32_t steals;      // голосов вытеснено
+  uint32_t voiceDrops;  // звуков отброшено (все голоса заняты более важными)
+};
+void soundEs8311TakeStats(SoundStats& out);
@@ -0,0 +1,67 @@
+#include "sound_offline.h"
+
+#ifndef ARDUINO
+
+#include <stdio.h>
+
+SoundOutputOffline::SoundOutputOffline(uint32_t rate, int16_t amp) : _rate(rate) {
+    audioEngineInit(_engine, rate, amp);
+}
+
+void SoundOutputOffline::send(const AudioMsg &m) {
+    audioEngineApply(_engine, m);
+}
+
+bool SoundOutputOffline::playing() {
+    return audioEngineActive(_engine);
+}
+
+size_t SoundOutputOffline::render(size_t n) {
+    alignas(16) int16_t block[MIX_BLOCK_MAX];
+    size_t left = n;
+    while (left > 0) {
+        int want = left < MIX_BLOCK_MAX ? (int)left : MIX_BLOCK_MAX;
+        int got  = audioEngineRender(_engine, block, want);
+        if (got == 0) _pcm.insert(_pcm.end(), (size_t)want, (int16_t)0);
+        else          _pcm.insert(_pcm.end(), block, block + got);
+        left -= (size_t)want;
+    }
+    return n;
+}
+
+size_t SoundOutputOffline::renderUntilIdle(size_t maxSamples) {
+    alignas(16) int16_t block[MIX_BLOCK_MAX];
+    size_t done = 0;
+    while (done < maxSamples && audioEngineActive(_engine)) {
+        size_t left = maxSamples - done;
+        int want = left < MIX_BLOCK_MAX ? (int)left : MIX_BLOCK_MAX;
+        int got  = audioEngineRender(_engine, block, want);
+        if (got == 0) break;
+        _pcm.insert(_pcm.end(), block, block + got);
+        done += (size_t)got;
+    }
+    return done;
+}
+
+// ============ WAV ============
+
+static void putLe(FILE *f, uint32_t v, int bytes) {
+    for (int i = 0; i < bytes; i++) fputc((int)((v >> (8 * i)) & 0xFF), f);
+}
+
+bool SoundOutputOffline::writeWav(const char *path) const {
+    FILE *f = fopen(path, "wb");
+    if (!f) return false;
+    uint32_t data = (uint32_t)(_pcm.size() * sizeof(int16_t));
+    fwrite("RIFF", 1, 4, f); putLe(f, 36 + data, 4);
+    fwrite("WAVEfmt ", 1, 8, f);
+    putLe(f, 16, 4); putLe(f, 1, 2); putLe(f, 1, 2);          // PCM, mono
+    putLe(f, _rate, 4); putLe(f, _rate * 2, 4);
+    putLe(f, 2, 2); putLe(f, 16, 2);
+    fwrite("data", 1, 4, f); putLe(f, data, 4);
+    for (int16_t s : _pcm) putLe(f, (uint16_t)s, 2);
+    bool ok = !ferror(f);
+    return fclose(f) == 0 && ok;
+}
+
+#endif  // !ARDUINO
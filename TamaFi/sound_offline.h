@@ -0,0 +1,58 @@
+#pragma once
+
+// ============ Offline sound output (host only) ============
+//
+// SoundOutput that renders into memory with the same AudioEngine the ES8311
+// render task uses, as fast as the CPU allows. Messages apply immediately;
+// the caller advances time by pulling samples. Mono int16 at the device rate.
+//
+//   SoundOutputOffline out;
+//   soundSetOutput(&out); soundInit(); soundSetVolume(3);
+//   sndHatch();
+//   out.renderUntilIdle(out.rate() * 5);
+//   out.writeWav("hatch.wav");
+
+#ifndef ARDUINO
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+#include "sound_output.h"
+
+#define SOUND_OFFLINE_RATE  16000   // I2S_SAMPLE_RATE in sound_es8311.cpp
+
+class SoundOutputOffline : public SoundOutput {
+public:
+    explicit SoundOutputOffline(uint32_t rate = SOUND_OFFLINE_RATE, int16_t amp = 2500);
+
+    bool available() override { return true; }
+    void send(const AudioMsg &m) override;
+    void setHwVolume(int volume) override { _hwVolume = volume; }
+    bool playing() override;
+
+    // Append n samples (silence once idle). Returns n.
+    size_t render(size_t n);
+
+    // Render while the engine is active, at most maxSamples. Returns samples added.
+    // Looping music never goes idle: stop it or use render().
+    size_t renderUntilIdle(size_t maxSamples);
+
+    // Drop the rendered PCM (engine state is kept).
+    void clear() { _pcm.clear(); }
+
+    const std::vector<int16_t> &pcm() const { return _pcm; }
+    uint32_t rate() const      { return _rate; }
+    int      hwVolume() const  { return _hwVolume; }
+    const AudioEngine &engine() const { return _engine; }
+
+    // 16-bit mono PCM WAV. Returns false if the file cannot be written.
+    bool writeWav(const char *path) const;
+
+private:
+    AudioEngine          _engine;
+    std::vector<int16_t> _pcm;
+    uint32_t             _rate;
+    int                  _hwVolume = 72;
+};
+
+#endif  // !ARDUINO
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdint.h>
+#include "audio_engine.h"   // AudioMsg
+
+// ============ Sound output abstraction ============
+//
+// sound.cpp hands every effect, clip and music change to a SoundOutput as an
+// AudioMsg instead of calling the codec directly, so the snd*() layer runs
+// off-device. Backends:
+//   - SoundOutputEs8311 (sound.cpp)       — I2S + ES8311 render task
+//   - SoundOutputOffline (sound_offline.h) — host: renders to a PCM buffer / WAV
+// The PWM buzzer fallback stays inside sound.cpp (it is used when no output is
+// available) and has no offline backend.
+
+class SoundOutput {
+public:
+    virtual ~SoundOutput() {}
+
+    // Output can play (codec initialised). When false sound.cpp uses the buzzer.
+    virtual bool available() = 0;
+
+    // Queue one control message. Never blocks; tables and clips must outlive playback.
+    virtual void send(const AudioMsg &m) = 0;
+
+    // Hardware volume 0-100 (no-op without a volume register).
+    virtual void setHwVolume(int volume) { (void)volume; }
+
+    // Anything still audible or queued.
+    virtual bool playing() = 0;
+};
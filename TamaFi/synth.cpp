@@ -0,0 +1,94 @@
+#include "synth.h"
+
+// ============ Compile-time wavetables ============
+
+namespace {
+
+constexpr double PI = 3.14159265358979323846;
+
+// Taylor series, good to ~1e-12 on [-pi, pi]
+constexpr double ctSin(double x) {
+    double term = x, sum = x;
+    for (int k = 1; k < 14; k++) {
+        term *= -x * x / ((2.0 * k) * (2.0 * k + 1.0));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr int16_t toQ15(double s) {
+    return (int16_t)(s * 32767.0 + (s >= 0 ? 0.5 : -0.5));
+}
+
+struct WaveTable {
+    // One guard entry (== entry 0) so interpolation never wraps
+    int16_t v[SYNTH_TABLE_SIZE + 1];
+
+    constexpr WaveTable(uint8_t wave) : v() {
+        for (int i = 0; i <= SYNTH_TABLE_SIZE; i++) {
+            int    k = i % SYNTH_TABLE_SIZE;
+            double t = (double)k / SYNTH_TABLE_SIZE;          // 0..1 of a period
+            double s = 0;
+            switch (wave) {
+                case SYNTH_SINE:     s = ctSin(t < 0.5 ? 2 * PI * t : 2 * PI * t - 2 * PI); break;
+                case SYNTH_SQUARE:   s = t < 0.5 ? 1.0 : -1.0; break;
+                case SYNTH_TRIANGLE: s = t < 0.25 ? 4 * t : t < 0.75 ? 2 - 4 * t : 4 * t - 4; break;
+            }
+            v[i] = toQ15(s);
+        }
+    }
+};
+
+constexpr WaveTable TABLES[SYNTH_WAVES] = {
+    WaveTable(SYNTH_SINE), WaveTable(SYNTH_SQUARE), WaveTable(SYNTH_TRIANGLE)
+};
+
+static_assert(TABLES[SYNTH_SINE].v[SYNTH_TABLE_SIZE / 4] == 32767, "sine peak");
+static_assert(TABLES[SYNTH_SINE].v[0] == 0, "sine zero");
+static_assert(TABLES[SYNTH_TRIANGLE].v[SYNTH_TABLE_SIZE / 2] == 0, "triangle zero");
+
+} // namespace
+
+// ============ Voice ============
+
+#define FRAC_BITS  (32 - SYNTH_TABLE_BITS)
+
+int16_t synthSample(uint8_t wave, uint32_t phase) {
+    const int16_t *t = TABLES[wave < SYNTH_WAVES ? wave : 0].v;
+    uint32_t idx  = phase >> FRAC_BITS;
+    int32_t  frac = (int32_t)((phase >> (FRAC_BITS - 15)) & 0x7FFF);    // Q15
+    int32_t  a = t[idx], b = t[idx + 1];
+    return (int16_t)(a + (((b - a) * frac) >> 15));
+}
+
+void synthStart(SynthVoice &v, uint8_t wave, uint32_t freqHz, uint32_t samples,
+                int16_t amp, uint32_t sampleRate) {
+    v.phase = 0;
+    v.inc   = (uint32_t)(((uint64_t)freqHz << 32) / sampleRate);
+    v.pos   = 0;
+    v.total = samples;
+    v.fade  = samples < 2 * SYNTH_FADE_MAX ? (uint16_t)(samples / 2) : SYNTH_FADE_MAX;
+    v.amp   = amp < 0 ? 0 : amp;
+    v.wave  = wave;
+}
+
+int synthRender(SynthVoice &v, int16_t *out, int n) {
+    uint32_t left = v.total - v.pos;
+    if (v.pos >= v.total) return 0;
+    if ((uint32_t)n > left) n = (int)left;
+
+    for (int i = 0; i < n; i++) {
+        uint32_t p = v.pos + i;
+
+        // Q15 envelope: linear ramp over `fade` samples at both ends
+        int32_t env = 32767;
+        if (p < v.fade)                 env = (int32_t)((p << 15) / v.fade);
+        else if (v.total - 1 - p < v.fade) env = (int32_t)(((v.total - 1 - p) << 15) / v.fade);
+
+        int32_t g = (v.amp * env) >> 15;
+        out[i] = (int16_t)((synthSample(v.wave, v.phase) * g) >> 15);
+        v.phase += v.inc;
+    }
+    v.pos += n;
+    return n;
+}
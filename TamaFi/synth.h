@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stdint.h>
+
+// ============ Fixed-point tone synthesis ============
+//
+// One voice = 32-bit phase accumulator walking a 256-entry Q15 wavetable
+// (built at compile time), linear interpolation between entries, Q15 gain
+// envelope. No float and no libm per sample. Pure logic, runs on the host.
+
+enum SynthWave : uint8_t {
+    SYNTH_SINE = 0,
+    SYNTH_SQUARE,
+    SYNTH_TRIANGLE,
+    SYNTH_WAVES
+};
+
+#define SYNTH_TABLE_BITS  8
+#define SYNTH_TABLE_SIZE  (1 << SYNTH_TABLE_BITS)
+#define SYNTH_FADE_MAX    32      // click-free ramp at tone start / end, samples
+
+struct SynthVoice {
+    uint32_t phase;
+    uint32_t inc;          // phase step per sample: freq * 2^32 / rate
+    uint32_t pos;          // samples rendered
+    uint32_t total;        // tone length, samples
+    uint16_t fade;         // ramp length, samples
+    int16_t  amp;          // peak amplitude, 0..32767
+    uint8_t  wave;         // SynthWave
+};
+
+// Start a tone of `samples` length. Pitch is exact to 2^-32 of the sample rate.
+void synthStart(SynthVoice &v, uint8_t wave, uint32_t freqHz, uint32_t samples,
+                int16_t amp, uint32_t sampleRate);
+
+// Render up to n mono samples; returns how many (0 once the tone is over).
+int synthRender(SynthVoice &v, int16_t *out, int n);
+
+inline bool synthActive(const SynthVoice &v) { return v.pos < v.total; }
+inline void synthStop(SynthVoice &v)         { v.total = v.pos; }
+
+// Q15 table lookup at a 32-bit phase (interpolated).
+int16_t synthSample(uint8_t wave, uint32_t phase);
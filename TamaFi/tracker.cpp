@@ -0,0 +1,199 @@
+#include "tracker.h"
+
+#include <string.h>
+
+// ============ Note table ============
+
+namespace {
+
+// Note 1..96 (C0..B7) -> frequency in Hz, Q16. Equal temperament from C0.
+struct NoteTable {
+    uint32_t hzQ16[97];
+
+    constexpr NoteTable() : hzQ16() {
+        double f = 16.351597831287414;            // C0
+        for (int n = 1; n <= 96; n++) {
+            hzQ16[n] = (uint32_t)(f * 65536.0 + 0.5);
+            f *= 1.0594630943592953;               // 2^(1/12)
+        }
+    }
+};
+
+constexpr NoteTable NOTES;
+
+static_assert(NOTES.hzQ16[58] / 65536u == 440u, "A4 = 440 Hz");
+
+uint32_t noteInc(int note, uint32_t rate) {
+    if (note < 1) note = 1;
+    if (note > 96) note = 96;
+    return (uint32_t)(((uint64_t)NOTES.hzQ16[note] << 16) / rate);
+}
+
+// One vibrato depth step = 1/16 semitone = 2^(1/192) - 1 ~ 236 / 65536
+#define VIB_STEP_Q16  236
+
+} // namespace
+
+// ============ Blob access ============
+
+static uint8_t hdrChannels(const Tracker &t) { return t.blob[3]; }
+static uint8_t hdrOrderLen(const Tracker &t) { return t.blob[8]; }
+static uint8_t hdrLoopTo(const Tracker &t)   { return t.blob[9]; }
+
+static const uint8_t *instOf(const Tracker &t, uint8_t inst) {
+    return t.blob + TRK_HEADER_SIZE + (size_t)inst * TRK_INST_SIZE;
+}
+
+static uint8_t patternAt(const Tracker &t, uint8_t orderPos) {
+    return t.blob[t.orderOffset + orderPos];
+}
+
+static uint8_t patternRows(const Tracker &t, uint8_t pat) {
+    return t.blob[t.patOffset[pat] - 1];
+}
+
+// ============ Sequencer ============
+
+// Row start: new notes, note offs
+static void playRow(Tracker &t) {
+    uint8_t        chans = hdrChannels(t);
+    const uint8_t *cell  = t.blob + t.patOffset[patternAt(t, t.orderPos)] + (size_t)t.row * chans * 2;
+
+    for (uint8_t c = 0; c < chans; c++, cell += 2) {
+        TrkChannel &ch = t.ch[c];
+        if (cell[0] == 0) continue;
+        if (cell[0] == TRK_NOTE_OFF) {
+            ch.note = 0;
+            ch.vol  = 0;
+            continue;
+        }
+        ch.note     = cell[0];
+        ch.inst     = cell[1];
+        ch.vol      = (uint8_t)(instOf(t, ch.inst)[1] * 16);
+        ch.vibPhase = 0;            // phase keeps running: no click on legato notes
+    }
+}
+
+// Every tick: envelope, arpeggio, vibrato
+static void tickChannels(Tracker &t) {
+    uint8_t chans = hdrChannels(t);
+    for (uint8_t c = 0; c < chans; c++) {
+        TrkChannel &ch = t.ch[c];
+        if (ch.note == 0 || ch.vol == 0) continue;
+        const uint8_t *in = instOf(t, ch.inst);
+
+        if (t.tick) ch.vol = ch.vol > in[2] ? (uint8_t)(ch.vol - in[2]) : 0;
+
+        int note = ch.note;
+        if (in[3]) {
+            uint8_t step = t.tick % 3;
+            if (step == 1) note += in[3] >> 4;
+            if (step == 2) note += in[3] & 0x0F;
+        }
+        uint32_t inc = noteInc(note, t.rate);
+
+        if (in[4]) {
+            int32_t s = synthSample(SYNTH_SINE, ch.vibPhase);                // Q15
+            int64_t d = (int64_t)inc * in[4] * VIB_STEP_Q16 * s >> 31;
+            inc = (uint32_t)((int64_t)inc + d);
+            ch.vibPhase += (uint32_t)in[5] << 26;                            // speed/64 cycle per tick
+        }
+        ch.inc = inc;
+    }
+}
+
+static void advance(Tracker &t) {
+    if (++t.tick < TRK_TICKS_PER_ROW) {
+        tickChannels(t);
+        return;
+    }
+    t.tick = 0;
+    if (++t.row >= patternRows(t, patternAt(t, t.orderPos))) {
+        t.row = 0;
+        if (++t.orderPos >= hdrOrderLen(t)) t.orderPos = hdrLoopTo(t);
+    }
+    playRow(t);
+    tickChannels(t);
+}
+
+bool trackerPlay(Tracker &t, const uint8_t *blob, size_t len, uint32_t sampleRate, uint16_t tempoPct) {
+    memset(&t, 0, sizeof(t));
+    if (!blob || len < TRK_HEADER_SIZE || blob[0] != 'T' || blob[1] != 'K' || blob[2] != TRK_VERSION)
+        return false;
+
+    uint8_t chans = blob[3], bpm = blob[4], rpb = blob[5], nInst = blob[6], nPat = blob[7];
+    uint8_t orderLen = blob[8], loopTo = blob[9];
+    if (chans == 0 || chans > TRK_MAX_CH || nInst > TRK_MAX_INST || nPat > TRK_MAX_PAT ||
+        orderLen == 0 || loopTo >= orderLen || bpm == 0 || rpb == 0 || sampleRate == 0)
+        return false;
+
+    // Pattern offsets (compiled blobs are trusted, only bounds are checked)
+    size_t off = TRK_HEADER_SIZE + (size_t)nInst * TRK_INST_SIZE;
+    for (uint8_t p = 0; p < nPat; p++) {
+        if (off >= len) return false;
+        uint8_t rows = blob[off++];
+        t.patOffset[p] = (uint16_t)off;
+        off += (size_t)rows * chans * 2;
+    }
+    if (off + orderLen != len) return false;
+    t.orderOffset = (uint16_t)off;
+    for (uint8_t i = 0; i < orderLen; i++) {
+        if (blob[off + i] >= nPat || blob[t.patOffset[blob[off + i]] - 1] == 0) return false;
+    }
+
+    t.blob = blob;
+    t.rate = sampleRate;
+    if (tempoPct == 0) tempoPct = 100;
+    // samples per tick = rate * 60 / (bpm * rpb * ticks), tempo scaled, Q16
+    t.samplesPerTickQ16 = (uint32_t)(((uint64_t)sampleRate * 60 * 100 << 16) /
+                                     ((uint64_t)bpm * tempoPct * rpb * TRK_TICKS_PER_ROW));
+    if (t.samplesPerTickQ16 < 65536) t.samplesPerTickQ16 = 65536;
+    t.tickLeftQ16 = (int32_t)t.samplesPerTickQ16;
+    t.playing = true;
+
+    playRow(t);
+    tickChannels(t);
+    return true;
+}
+
+void trackerStop(Tracker &t) {
+    t.playing = false;
+}
+
+int trackerRender(Tracker &t, int16_t *out, int n, int16_t amp) {
+    if (!t.playing) return 0;
+    uint8_t chans = hdrChannels(t);
+    int     done  = 0;
+
+    while (done < n) {
+        // Samples up to the next tick boundary (exact, fractional part carried)
+        int run = (t.tickLeftQ16 + 65535) >> 16;
+        if (run > n - done) run = n - done;
+
+        int32_t gain[TRK_MAX_CH];
+        uint8_t wave[TRK_MAX_CH];
+        for (uint8_t c = 0; c < chans; c++) {
+            gain[c] = t.ch[c].note ? (int32_t)amp * t.ch[c].vol / TRK_VOL_MAX : 0;
+            wave[c] = instOf(t, t.ch[c].inst)[0];
+        }
+
+        for (int i = 0; i < run; i++) {
+            int32_t acc = 0;
+            for (uint8_t c = 0; c < chans; c++) {
+                TrkChannel &ch = t.ch[c];
+                if (!gain[c]) continue;
+                ch.phase += ch.inc;
+                acc += (synthSample(wave[c], ch.phase) * gain[c]) >> 15;
+            }
+            out[done + i] = (int16_t)(acc > 32767 ? 32767 : acc < -32768 ? -32768 : acc);
+        }
+        done += run;
+
+        t.tickLeftQ16 -= run << 16;
+        if (t.tickLeftQ16 <= 0) {
+            t.tickLeftQ16 += (int32_t)t.samplesPerTickQ16;
+            advance(t);
+        }
+    }
+    return n;
+}
@@ -0,0 +1,288 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "synth.h"
+
+// ============ Chiptune tracker ============
+//
+// Songs are written as text and compiled to a compact blob by the compiler
+// in this header at build time (constexpr, see TRACKER_SONG). A syntax error
+// stops the build at trkSyntaxError(). The sequencer in tracker.cpp plays
+// the blob sample-accurately inside the audio task.
+//
+// Song text, one statement per line, '#' starts a comment:
+//
+//   tempo 110 4                 bpm, rows per beat
+//   channels 2                  1..TRK_MAX_CH
+//   inst 0 tri 12 3             id, wave (sin|sq|tri), volume 0..15, decay 0..15
+//   inst 1 sq 7 1 arp 47        ... optional arpeggio: semitones of steps 2 and 3 (hex)
+//   inst 2 sin 10 0 vib 6 4     ... optional vibrato: depth (1/16 semitone), speed
+//   pat 0                       following lines are rows of pattern 0
+//   C-4:0 E-3:1                 one cell per channel: note[:inst]
+//   ...   ...                   "..." keeps the channel as it is
+//   ===   G#3                   "===" note off; inst may be omitted (last one)
+//   order 0 0 1 loop 1          pattern order; optional loop position
+//
+// Tick rate is TRK_TICKS_PER_ROW per row; decay is in 1/16 volume step per
+// tick, arpeggio steps every tick.
+
+#define TRK_MAX_CH          3
+#define TRK_MAX_INST        8
+#define TRK_MAX_PAT         8
+#define TRK_MAX_ROWS        32
+#define TRK_MAX_ORDER       32
+#define TRK_TICKS_PER_ROW   6
+#define TRK_NOTE_OFF        0xFF
+#define TRK_VOL_MAX         (15 * 16)
+
+// Blob layout (all bytes):
+//   'T' 'K' version channels bpm rowsPerBeat nInst nPat orderLen loopTo
+//   nInst x { wave(SynthWave) vol decay arp vibDepth vibSpeed }
+//   nPat  x { rows, rows x channels x { note inst } }     note 0 = empty, 1..96 = C0..B7
+//   orderLen x pattern
+#define TRK_VERSION      1
+#define TRK_HEADER_SIZE  10
+#define TRK_INST_SIZE    6
+
+// ============ Compile-time song compiler ============
+
+void trkSyntaxError(const char *what);     // never defined: reaching it at compile time is the error
+
+struct TrkSong {
+    uint8_t bpm = 120, rpb = 4, channels = 1, nInst = 0, nPat = 0, orderLen = 0, loopTo = 0;
+    uint8_t inst[TRK_MAX_INST][TRK_INST_SIZE] = {};
+    uint8_t rows[TRK_MAX_PAT] = {};
+    uint8_t cells[TRK_MAX_PAT][TRK_MAX_ROWS][TRK_MAX_CH][2] = {};
+    uint8_t order[TRK_MAX_ORDER] = {};
+};
+
+template <size_t N>
+struct TrkBlob {
+    uint8_t data[N] = {};
+    size_t  size = 0;
+};
+
+namespace trk {
+
+struct Lexer {
+    const char *s;
+    size_t      n, i;
+
+    constexpr bool eol() const { return i >= n || s[i] == '\n' || s[i] == '#'; }
+    constexpr void skipSpace() { while (i < n && (s[i] == ' ' || s[i] == '\t' || s[i] == '\r')) i++; }
+    constexpr void nextLine() {
+        while (i < n && s[i] != '\n') i++;
+        if (i < n) i++;
+    }
+    // Token boundaries [b, e)
+    constexpr bool token(size_t &b, size_t &e) {
+        skipSpace();
+        if (eol()) return false;
+        b = i;
+        while (i < n && s[i] != ' ' && s[i] != '\t' && s[i] != '\r' && s[i] != '\n') i++;
+        e = i;
+        return true;
+    }
+    constexpr bool is(size_t b, size_t e, const char *w) const {
+        size_t k = 0;
+        for (; b + k < e; k++) if (!w[k] || w[k] != s[b + k]) return false;
+        return w[k] == 0;
+    }
+    constexpr int number(int base = 10) {
+        size_t b = 0, e = 0;
+        if (!token(b, e)) trkSyntaxError("number expected");
+        int v = 0;
+        for (size_t k = b; k < e; k++) {
+            char c = s[k];
+            int  d = c >= '0' && c <= '9' ? c - '0'
+                   : c >= 'a' && c <= 'f' ? c - 'a' + 10
+                   : c >= 'A' && c <= 'F' ? c - 'A' + 10 : 99;
+            if (d >= base) trkSyntaxError("bad digit");
+            v = v * base + d;
+        }
+        return v;
+    }
+};
+
+constexpr int range(int v, int lo, int hi) {
+    if (v < lo || v > hi) trkSyntaxError("value out of range");
+    return v;
+}
+
+// "C-4", "G#3" -> 1..96
+constexpr uint8_t parseNote(const char *s, size_t b, size_t e) {
+    if (e - b < 3) trkSyntaxError("bad note");
+    const int base[7] = { 9, 11, 0, 2, 4, 5, 7 };     // A..G
+    char l = s[b];
+    if (l < 'A' || l > 'G') trkSyntaxError("bad note letter");
+    int semi = base[l - 'A'];
+    if (s[b + 1] == '#') semi++;
+    else if (s[b + 1] != '-') trkSyntaxError("note needs - or #");
+    int oct = s[b + 2] - '0';
+    if (oct < 0 || oct > 7) trkSyntaxError("bad octave");
+    return (uint8_t)(oct * 12 + semi + 1);
+}
+
+constexpr void parseCell(const Lexer &lx, size_t b, size_t e, uint8_t *cell, uint8_t &lastInst) {
+    if (lx.is(b, e, "...") || lx.is(b, e, ".")) { cell[0] = 0; return; }
+    if (lx.is(b, e, "===")) { cell[0] = TRK_NOTE_OFF; return; }
+    cell[0] = parseNote(lx.s, b, e < b + 3 ? e : b + 3);
+    if (e > b + 3) {
+        if (lx.s[b + 3] != ':' || e != b + 5) trkSyntaxError("cell is note[:inst]");
+        lastInst = (uint8_t)range(lx.s[b + 4] - '0', 0, TRK_MAX_INST - 1);
+    }
+    cell[1] = lastInst;
+}
+
+constexpr TrkSong parse(const char *src, size_t len) {
+    TrkSong song;
+    Lexer   lx{ src, len, 0 };
+    int     pat = -1;
+    uint8_t lastInst[TRK_MAX_CH] = {};
+
+    while (lx.i < lx.n) {
+        size_t b = 0, e = 0;
+        if (!lx.token(b, e)) { lx.nextLine(); continue; }
+
+        if (lx.is(b, e, "tempo")) {
+            song.bpm = (uint8_t)range(lx.number(), 30, 255);
+            song.rpb = (uint8_t)range(lx.number(), 1, 16);
+            pat = -1;
+        } else if (lx.is(b, e, "channels")) {
+            song.channels = (uint8_t)range(lx.number(), 1, TRK_MAX_CH);
+            pat = -1;
+        } else if (lx.is(b, e, "inst")) {
+            int id = range(lx.number(), 0, TRK_MAX_INST - 1);
+            if (id != song.nInst) trkSyntaxError("instruments must be numbered in order");
+            uint8_t *in = song.inst[id];
+            if (!lx.token(b, e)) trkSyntaxError("wave expected");
+            if (lx.is(b, e, "sin"))      in[0] = SYNTH_SINE;
+            else if (lx.is(b, e, "sq"))  in[0] = SYNTH_SQUARE;
+            else if (lx.is(b, e, "tri")) in[0] = SYNTH_TRIANGLE;
+            else trkSyntaxError("unknown wave");
+            in[1] = (uint8_t)range(lx.number(), 0, 15);
+            in[2] = (uint8_t)range(lx.number(), 0, 15);
+            while (lx.token(b, e)) {
+                if (lx.is(b, e, "arp"))      in[3] = (uint8_t)range(lx.number(16), 0, 0xFF);
+                else if (lx.is(b, e, "vib")) { in[4] = (uint8_t)range(lx.number(), 0, 15);
+                                               in[5] = (uint8_t)range(lx.number(), 0, 15); }
+                else trkSyntaxError("unknown instrument option");
+            }
+            song.nInst++;
+            pat = -1;
+        } else if (lx.is(b, e, "pat")) {
+            pat = range(lx.number(), 0, TRK_MAX_PAT - 1);
+            if (pat != song.nPat) trkSyntaxError("patterns must be numbered in order");
+            song.nPat++;
+        } else if (lx.is(b, e, "order")) {
+            while (lx.token(b, e)) {
+                if (lx.is(b, e, "loop")) { song.loopTo = (uint8_t)lx.number(); continue; }
+                if (song.orderLen >= TRK_MAX_ORDER) trkSyntaxError("order too long");
+                lx.i = b;
+                song.order[song.orderLen++] = (uint8_t)range(lx.number(), 0, TRK_MAX_PAT - 1);
+            }
+            pat = -1;
+        } else if (pat >= 0) {
+            // Row of the current pattern
+            uint8_t r = song.rows[pat];
+            if (r >= TRK_MAX_ROWS) trkSyntaxError("pattern too long");
+            int ch = 0;
+            do {
+                if (ch >= song.channels) trkSyntaxError("more cells than channels");
+                parseCell(lx, b, e, song.cells[pat][r][ch], lastInst[ch]);
+                ch++;
+            } while (lx.token(b, e));
+            if (ch != song.channels) trkSyntaxError("fewer cells than channels");
+            song.rows[pat]++;
+        } else {
+            trkSyntaxError("unknown statement");
+        }
+        lx.nextLine();
+    }
+
+    if (song.orderLen == 0) trkSyntaxError("song has no order");
+    if (song.loopTo >= song.orderLen) trkSyntaxError("loop outside order");
+    for (int k = 0; k < song.orderLen; k++) {
+        if (song.order[k] >= song.nPat || song.rows[song.order[k]] == 0) trkSyntaxError("order names an empty pattern");
+    }
+    for (int p = 0; p < song.nPat; p++) {
+        for (int r = 0; r < song.rows[p]; r++)
+            for (int c = 0; c < song.channels; c++) {
+                uint8_t note = song.cells[p][r][c][0];
+                if (note && note != TRK_NOTE_OFF && song.cells[p][r][c][1] >= song.nInst)
+                    trkSyntaxError("cell uses an undefined instrument");
+            }
+    }
+    return song;
+}
+
+constexpr size_t blobSize(const TrkSong &s) {
+    size_t n = TRK_HEADER_SIZE + (size_t)s.nInst * TRK_INST_SIZE + s.orderLen;
+    for (int p = 0; p < s.nPat; p++) n += 1 + (size_t)s.rows[p] * s.channels * 2;
+    return n;
+}
+
+template <size_t N>
+constexpr TrkBlob<N> serialize(const TrkSong &s) {
+    TrkBlob<N> out;
+    size_t k = 0;
+    const uint8_t hdr[TRK_HEADER_SIZE] = { 'T', 'K', TRK_VERSION, s.channels, s.bpm, s.rpb,
+                                           s.nInst, s.nPat, s.orderLen, s.loopTo };
+    for (size_t i = 0; i < TRK_HEADER_SIZE; i++) out.data[k++] = hdr[i];
+    for (int i = 0; i < s.nInst; i++)
+        for (int j = 0; j < TRK_INST_SIZE; j++) out.data[k++] = s.inst[i][j];
+    for (int p = 0; p < s.nPat; p++) {
+        out.data[k++] = s.rows[p];
+        for (int r = 0; r < s.rows[p]; r++)
+            for (int c = 0; c < s.channels; c++) {
+                out.data[k++] = s.cells[p][r][c][0];
+                out.data[k++] = s.cells[p][r][c][1];
+            }
+    }
+    for (int i = 0; i < s.orderLen; i++) out.data[k++] = s.order[i];
+    out.size = k;
+    return out;
+}
+
+} // namespace trk
+
+// Compile song text into `static constexpr` blob NAME (NAME.data, NAME.size).
+#define TRACKER_SONG(NAME, TEXT) \
+    static constexpr TrkBlob<trk::blobSize(trk::parse(TEXT, sizeof(TEXT) - 1))> NAME = \
+        trk::serialize<trk::blobSize(trk::parse(TEXT, sizeof(TEXT) - 1))>(trk::parse(TEXT, sizeof(TEXT) - 1))
+
+// ============ Sequencer ============
+
+struct TrkChannel {
+    uint32_t phase;
+    uint32_t inc;            // phase step: note + arpeggio + vibrato, set per tick
+    uint32_t vibPhase;
+    uint8_t  vol;            // 1/16 volume steps, 0..TRK_VOL_MAX
+    uint8_t  note;           // 0 = silent
+    uint8_t  inst;
+};
+
+struct Tracker {
+    const uint8_t *blob;
+    uint32_t       rate;
+    uint16_t       patOffset[TRK_MAX_PAT];   // blob offsets of each pattern's rows
+    uint16_t       orderOffset;
+    uint32_t       samplesPerTickQ16;
+    int32_t        tickLeftQ16;     // samples until the next tick, Q16
+    uint8_t        orderPos, row, tick;
+    bool           playing;
+    TrkChannel     ch[TRK_MAX_CH];
+};
+
+// Start a compiled song. tempoPct scales the song's bpm (100 = as written).
+// Returns false if the blob is malformed.
+bool trackerPlay(Tracker &t, const uint8_t *blob, size_t len, uint32_t sampleRate, uint16_t tempoPct);
+
+void trackerStop(Tracker &t);
+
+inline bool trackerPlaying(const Tracker &t) { return t.playing; }
+
+// Render n mono samples (loops forever), each channel peaking at amp.
+// Returns n, or 0 when stopped.
+int trackerRender(Tracker &t, int16_t *out, int n, int16_t amp);
@@ -3,8 +3,10 @@
 #include "ui.h"
 #include "ui_anim.h"
 #include "sound.h"              // sndHatch (hatch animation)
-#include "wifi_service.h"       // wifiStats, wifiList, wifiScanInProgress
+#include "wifi_service.h"       // wifiStats, wifiList, wifiRadioState
+#include "wifi_sniffer.h"       // wifiSnifferAgg (passive sensing stats)
 #include "battery.h"            // batteryGetInfo
+#include "persistence.h"        // persistStats
 // Полное определение Arduino_GFX нужно для вызовов getContentCanvas()->...
 #include <Arduino_GFX_Library.h>
 
@@ -123,6 +125,26 @@ static const char* stageTextLocal(Stage s) {
     return "?";
 }
 
+static const char* radioTextLocal(WifiRadioState r) {
+    switch (r) {
+        case RADIO_OFF:      return "OFF";
+        case RADIO_SCANNING: return "SCAN";
+        case RADIO_GRACE:    return "ON";
+        case RADIO_LISTEN:   return "LISTEN";
+    }
+    return "?";
+}
+
+static const char* placeTextLocal(PlaceKind p) {
+    switch (p) {
+        case PLACE_UNKNOWN: return "?";
+        case PLACE_NEW:     return "NEW";
+        case PLACE_KNOWN:   return "KNOWN";
+        case PLACE_HOME:    return "HOME";
+    }
+    return "?";
+}
+
 static const char* activityTextLocal(Activity a) {
     switch (a) {
         case ACT_HUNT:     return "HUNTING WIFI...";
@@ -499,6 +521,11 @@ static void screenPetStatus() {
 // ---------------------------------------------------------------------------
 // SYSTEM INFO
 // ---------------------------------------------------------------------------
+static void printLatencyMs(uint16_t ms) {
+    if (ms == UINT16_MAX) getContentCanvas()->printf(">%u", LAT_BUCKET_MS[LAT_BUCKETS - 2]);
+    else                  getContentCanvas()->print(ms);
+}
+
 static void screenSysInfo() {
     getContentCanvas()->fillScreen(TFT_BLACK);
     drawHeader("System Info");
@@ -509,7 +536,8 @@ static void screenSysInfo() {
     getContentCanvas()->print("Firmware: 2.0");
 
     getContentCanvas()->setCursor(10, 42);
-    getContentCanvas()->print("MCU:      ESP32");
+    getContentCanvas()->print("MCU:      ESP32-S3 @ ");
+    getContentCanvas()->print(getCpuFrequencyMhz()); getContentCanvas()->print(" MHz");
 
     getContentCanvas()->setCursor(10, 54);
     getContentCanvas()->print("Heap Free: ");
@@ -524,9 +552,32 @@ static void screenSysInfo() {
     getContentCanvas()->print("Uptime: ");
     getContentCanvas()->printf("%02lu:%02lu:%02lu", h, m, s);
 
+    // Input -> panel latency, median / 95th percentile (bucket edges)
+    getContentCanvas()->setCursor(130, 72);
+    getContentCanvas()->print("Lag: ");
+    if (inputLatency.count == 0) {
+        getContentCanvas()->print("--");
+    } else {
+        printLatencyMs(latencyPercentileMs(inputLatency, 50));
+        getContentCanvas()->print("/");
+        printLatencyMs(latencyPercentileMs(inputLatency, 95));
+        getContentCanvas()->print("ms");
+    }
+
     getContentCanvas()->setCursor(10, 90);
-    getContentCanvas()->print("WiFi Scan: ");
-    getContentCanvas()->print(wifiScanInProgress ? "Running" : "Idle");
+    getContentCanvas()->print("WiFi Radio: ");
+    getContentCanvas()->print(radioTextLocal(wifiRadioState()));
+    getContentCanvas()->print(" (");
+    getContentCanvas()->print(wifiRadioOnMsPerHour() / 1000);
+    getContentCanvas()->print("s/h)");
+
+    if (wifiRadioState() == RADIO_LISTEN) {
+        const BeaconAggStats &bs = wifiSnifferAgg().stats;
+        getContentCanvas()->setCursor(10, 100);
+        getContentCanvas()->print("Beacons: "); getContentCanvas()->print((int)bs.apCount);
+        getContentCanvas()->print(" APs, "); getContentCanvas()->print((int)bs.avgRSSI);
+        getContentCanvas()->print(" dBm");
+    }
 
     // --- Battery ---
     const BatteryInfo &bat = batteryGetInfo();
@@ -551,9 +602,21 @@ static void screenSysInfo() {
         getContentCanvas()->print("Charging: ");
         getContentCanvas()->print(bat.charging ? "YES" : "NO");
 
+        getContentCanvas()->setCursor(130, 138);
+        getContentCanvas()->print("I2C: "); getContentCanvas()->print(batteryI2cPerMinute());
+        getContentCanvas()->print("/min");
+
         getContentCanvas()->setCursor(10, 150);
         getContentCanvas()->print("USB:      ");
         getContentCanvas()->print(bat.usbConnected ? "Connected" : "---");
+
+        // Projected runtime from the energy model (calibrated against the gauge)
+        int32_t left = (bat.batteryConnected && !bat.usbConnected)
+                     ? energyProjectedMin(energyModel, bat.percent) : -1;
+        getContentCanvas()->setCursor(130, 150);
+        getContentCanvas()->print("Left: ");
+        if (left < 0) getContentCanvas()->print("--");
+        else          getContentCanvas()->printf("%ldh%02ldm", (long)(left / 60), (long)(left % 60));
     } else {
         getContentCanvas()->setCursor(10, 112);
         getContentCanvas()->setTextColor(TFT_DARKGREY);
@@ -587,6 +650,18 @@ static void screenSysInfo() {
     getContentCanvas()->setCursor(120, wifiY + 38);
     getContentCanvas()->print("RSSI: "); getContentCanvas()->print(wifiStats.avgRSSI);
 
+    getContentCanvas()->setCursor(10, wifiY + 50);
+    getContentCanvas()->print("Place:   "); getContentCanvas()->print(placeTextLocal(wifiPlace.kind));
+    getContentCanvas()->print(" ("); getContentCanvas()->print((int)wifiPlaces.count); getContentCanvas()->print(" known)");
+
+    // --- Storage ---
+    const PersistStats &ps = persistStats();
+    getContentCanvas()->setCursor(10, wifiY + 62);
+    getContentCanvas()->print("Flash:   "); getContentCanvas()->print(ps.flashWrites);
+    getContentCanvas()->print(" wr, "); getContentCanvas()->print(ps.skipped);
+    getContentCanvas()->print(" skip, stall "); getContentCanvas()->print(ps.maxStallUs);
+    getContentCanvas()->print("us");
+
     flushContentAndDrawControlBar();
 }
 
@@ -618,6 +693,7 @@ static void screenSettings(int settingsMenuIndex) {
         "Pet",
         "Auto Sleep",
         "Auto Save",
+        "WiFi Sense",
         "Reset Pet",
         "Reset All",
         "Back"
@@ -628,7 +704,7 @@ static void screenSettings(int settingsMenuIndex) {
     int baseY = 30;
     int step  = 18;
 
-    for (int i = 0; i < 8; i++) {
+    for (int i = 0; i < 9; i++) {
         int y = baseY + i * step;
 
         drawBubble(14, y, i == settingsMenuIndex);
@@ -646,6 +722,7 @@ static void screenSettings(int settingsMenuIndex) {
             case 2: getContentCanvas()->print(petSkinText(petSkin)); break;
             case 3: getContentCanvas()->print(autoSleepMs==0?"Off":autoSleepMs==30000?"30s":autoSleepMs==60000?"60s":"120s"); break;
             case 4: getContentCanvas()->print(autoSaveMs/1000); getContentCanvas()->print("s"); break;
+            case 5: getContentCanvas()->print(wifiPassive ? "Listen" : "Scan"); break;
         }
     }
 
@@ -4,6 +4,8 @@
 #include "pet_logic.h"         // Pet, Stage, Mood, Activity, RestPhase, PetState, WifiStats
 #include "navigation.h"        // Screen, currentScreen, settings externs
 #include "display_amoled.h"
+#include "energy.h"            // EnergyModel
+#include "input_latency.h"     // InputLatency
 
 // ============ UI API ============
 
@@ -22,3 +24,5 @@ extern int petPosY;
 // ============ Externs for pet state (defined in TamaFi.ino) ============
 
 extern PetState petState;
+extern EnergyModel energyModel;
+extern InputLatency inputLatency;
@@ -0,0 +1,122 @@
+#include "wifi_env.h"
+#include <string.h>
+
+// ============ Tuning ============
+
+static const float   EWMA_ALPHA       = 0.25f;   // weight of the newest scan
+static const int16_t TREND_THRESH_Q4  = 16;      // |slope| >= 1 dB/scan counts as moving
+static const uint8_t TRACK_MAX_MISSED = 3;       // forget BSSID after this many missed scans
+
+// ============ Internal helpers ============
+
+static uint32_t bssidSlot(const uint8_t b[6]) {
+    // OUI (first 3 bytes) is shared by many APs — hash the NIC-specific tail
+    uint32_t h = ((uint32_t)b[2] << 24) | ((uint32_t)b[3] << 16) | ((uint32_t)b[4] << 8) | b[5];
+    h ^= (uint32_t)b[0] << 8 | b[1];
+    h *= 2654435761u;
+    return h >> (32 - WIFI_ENV_TRACK_BITS);
+}
+
+// Find BSSID or an empty slot for it (linear probing). Returns nullptr if table full.
+static WifiBssidTrend* trackLookup(WifiEnvModel &m, const uint8_t bssid[6], bool &found) {
+    uint32_t idx = bssidSlot(bssid);
+    for (int probe = 0; probe < WIFI_ENV_TRACK_MAX; probe++) {
+        WifiBssidTrend &t = m.track[(idx + probe) & (WIFI_ENV_TRACK_MAX - 1)];
+        if (!t.used) { found = false; return &t; }
+        if (memcmp(t.bssid, bssid, 6) == 0) { found = true; return &t; }
+    }
+    found = false;
+    return nullptr;
+}
+
+static float ewma(float prev, float sample, bool seed) {
+    return seed ? sample : prev + EWMA_ALPHA * (sample - prev);
+}
+
+// ============ Public API ============
+
+void wifiEnvInit(WifiEnvModel &m) {
+    m.smooth    = WifiEnvSmoothed();
+    m.scanCount = 0;
+    memset(m.track, 0, sizeof(m.track));
+    wifiEnvBeginScan(m);
+}
+
+void wifiEnvBeginScan(WifiEnvModel &m) {
+    m.scanNets    = 0;
+    m.scanOpen    = 0;
+    m.scanHidden  = 0;
+    m.scanRssiSum = 0;
+
+    // Everything is "missed" until seen again in this scan
+    for (int i = 0; i < WIFI_ENV_TRACK_MAX; i++) {
+        if (m.track[i].used && m.track[i].missed < 255) m.track[i].missed++;
+    }
+}
+
+void wifiEnvAddNetwork(WifiEnvModel &m, const uint8_t bssid[6], int rssi, bool isOpen, bool isHidden) {
+    m.scanNets++;
+    m.scanRssiSum += rssi;
+    if (isOpen)   m.scanOpen++;
+    if (isHidden) m.scanHidden++;
+
+    bool found;
+    WifiBssidTrend *t = trackLookup(m, bssid, found);
+    if (!t) return;                            // table full — aggregates still counted
+
+    int16_t rssiQ4 = (int16_t)(rssi * 16);
+    if (!found) {
+        memcpy(t->bssid, bssid, 6);
+        t->used    = true;
+        t->rssiQ4  = rssiQ4;
+        t->slopeQ4 = 0;
+    } else {
+        int16_t delta = rssiQ4 - t->rssiQ4;
+        t->slopeQ4 += (delta - t->slopeQ4) / 4;
+        t->rssiQ4  += delta / 2;
+    }
+    t->missed = 0;
+}
+
+void wifiEnvEndScan(WifiEnvModel &m) {
+    bool seed = !m.smooth.valid;
+    int  n    = m.scanNets;
+
+    float avgRssi = (n > 0) ? (float)m.scanRssiSum / n : -100.f;
+    float open    = (n > 0) ? (float)m.scanOpen   / n : 0.f;
+    float hidden  = (n > 0) ? (float)m.scanHidden / n : 0.f;
+
+    m.smooth.netCount    = ewma(m.smooth.netCount,    (float)n, seed);
+    m.smooth.avgRSSI     = ewma(m.smooth.avgRSSI,     avgRssi,  seed);
+    m.smooth.openRatio   = ewma(m.smooth.openRatio,   open,     seed);
+    m.smooth.hiddenRatio = ewma(m.smooth.hiddenRatio, hidden,   seed);
+    m.smooth.valid       = true;
+    m.scanCount++;
+
+    // Trend counts + age-out. Removing from an open-addressed table breaks probe
+    // chains, so survivors are re-inserted when anything was dropped.
+    uint8_t approaching = 0, leaving = 0;
+    bool    dropped = false;
+    for (int i = 0; i < WIFI_ENV_TRACK_MAX; i++) {
+        WifiBssidTrend &t = m.track[i];
+        if (!t.used) continue;
+        if (t.missed > TRACK_MAX_MISSED) { t.used = false; dropped = true; continue; }
+        if (t.missed > 0) continue;
+        if (t.slopeQ4 >=  TREND_THRESH_Q4) approaching++;
+        if (t.slopeQ4 <= -TREND_THRESH_Q4) leaving++;
+    }
+    m.smooth.approaching = approaching;
+    m.smooth.leaving     = leaving;
+
+    if (dropped) {
+        WifiBssidTrend old[WIFI_ENV_TRACK_MAX];
+        memcpy(old, m.track, sizeof(old));
+        memset(m.track, 0, sizeof(m.track));
+        for (int i = 0; i < WIFI_ENV_TRACK_MAX; i++) {
+            if (!old[i].used) continue;
+            bool found;
+            WifiBssidTrend *t = trackLookup(m, old[i].bssid, found);
+            if (t) *t = old[i];
+        }
+    }
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <stdint.h>
+
+// ============ Streaming WiFi environment model ============
+//
+// Exponentially weighted averages of per-scan aggregates plus a fixed-size
+// per-BSSID table of RSSI trends (approaching / leaving). Updated once per
+// scan in O(n) with no allocation; zero hardware deps.
+
+#define WIFI_ENV_TRACK_BITS  6
+#define WIFI_ENV_TRACK_MAX   (1 << WIFI_ENV_TRACK_BITS)   // tracked BSSIDs (open addressing)
+
+// Smoothed view for pet logic (plain fields, cheap to copy and query).
+struct WifiEnvSmoothed {
+    float   netCount    = 0;       // EWMA of networks per scan
+    float   avgRSSI     = -100;    // EWMA of mean RSSI, dBm
+    float   openRatio   = 0;       // EWMA of open / total
+    float   hiddenRatio = 0;       // EWMA of hidden / total
+    uint8_t approaching = 0;       // BSSIDs with rising RSSI trend
+    uint8_t leaving     = 0;       // BSSIDs with falling RSSI trend
+    bool    valid       = false;   // at least one scan folded in
+};
+
+struct WifiBssidTrend {
+    uint8_t bssid[6];
+    bool    used;
+    uint8_t missed;     // consecutive scans without this BSSID
+    int16_t rssiQ4;     // EWMA RSSI, dBm * 16
+    int16_t slopeQ4;    // EWMA of per-scan RSSI delta, dB * 16
+};
+
+struct WifiEnvModel {
+    WifiEnvSmoothed smooth;
+    WifiBssidTrend  track[WIFI_ENV_TRACK_MAX];
+    uint32_t        scanCount;
+
+    // Per-scan accumulators (between wifiEnvBeginScan / wifiEnvEndScan)
+    int  scanNets;
+    int  scanOpen;
+    int  scanHidden;
+    long scanRssiSum;
+};
+
+// Reset model to "nothing seen yet".
+void wifiEnvInit(WifiEnvModel &m);
+
+// Start folding a new scan.
+void wifiEnvBeginScan(WifiEnvModel &m);
+
+// Add one network of the current scan.
+void wifiEnvAddNetwork(WifiEnvModel &m, const uint8_t bssid[6], int rssi, bool isOpen, bool isHidden);
+
+// Finish the scan: update EWMAs, trend counts, age out BSSIDs not seen for a while.
+void wifiEnvEndScan(WifiEnvModel &m);
@@ -0,0 +1,51 @@
+#include "wifi_ingest.h"
+#include <string.h>
+
+void wifiIngestScan(WifiScanSource &src, int n, WifiScanSink &sink) {
+    wifiEnvBeginScan(sink.env);
+
+    PlaceSignature sig;
+    placeSigBegin(sig);
+
+    WifiStats s;
+    s.netCount    = n;
+    s.strongCount = 0;
+    s.hiddenCount = 0;
+    s.openCount   = 0;
+    s.wpaCount    = 0;
+    int totalRSSI = 0;
+
+    sink.listCount = 0;
+
+    for (int i = 0; i < n; i++) {
+        WifiScanRecord rec;
+        if (!src.get(i, rec)) continue;
+
+        int rssi = rec.rssi;
+        totalRSSI += rssi;
+        if (rssi > -60) s.strongCount++;
+
+        bool isHidden = (rec.ssid[0] == '\0');
+        if (isHidden) s.hiddenCount++;
+
+        bool isOpen = rec.isOpen;
+        if (isOpen) s.openCount++;
+        else        s.wpaCount++;
+
+        wifiEnvAddNetwork(sink.env, rec.bssid, rssi, isOpen, isHidden);
+        placeSigAdd(sig, rec.bssid);
+
+        if (sink.listCount < MAX_WIFI_LIST) {
+            WifiNetworkInfo &info = sink.list[sink.listCount++];
+            strncpy(info.ssid, isHidden ? "(hidden)" : rec.ssid, sizeof(info.ssid) - 1);
+            info.ssid[sizeof(info.ssid) - 1] = '\0';
+            info.rssi   = rssi;
+            info.isOpen = isOpen;
+        }
+    }
+
+    s.avgRSSI  = (n > 0) ? (totalRSSI / n) : -100;
+    sink.stats = s;
+    wifiEnvEndScan(sink.env);
+    sink.place = placeDbObserve(sink.places, sig);
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stdint.h>
+#include "wifi_env.h"          // WifiEnvModel
+#include "wifi_places.h"       // PlaceDb, PlaceMatch
+#include "wifi_scan_source.h"  // WifiScanSource, WifiScanRecord
+
+// ============ WiFi data types (used by pet logic and wifi_service) ============
+
+struct WifiStats {
+    int netCount    = 0;
+    int strongCount = 0;
+    int hiddenCount = 0;
+    int avgRSSI     = -100;
+    int openCount   = 0;
+    int wpaCount    = 0;
+};
+
+const int MAX_WIFI_LIST = 12;
+
+struct WifiNetworkInfo {
+    char ssid[33];     // "(hidden)" for hidden networks
+    int  rssi;
+    bool isOpen;
+};
+
+// ============ Scan ingestion ============
+//
+// Turns one completed scan of a WifiScanSource into the pet's WifiStats, the
+// UI network list, an environment-model update and a place observation.
+// Zero hardware deps: wifi_service runs it on the device, tools/wifi_trace_run
+// runs the same code over recorded traces on the host.
+
+// Everything one scan updates.
+struct WifiScanSink {
+    WifiEnvModel    &env;
+    PlaceDb         &places;
+    WifiStats       &stats;
+    PlaceMatch      &place;
+    WifiNetworkInfo *list;       // MAX_WIFI_LIST entries
+    int             &listCount;
+};
+
+// Fold records 0..n-1 of a completed scan (n = poll() result, >= 0) into sink.
+// A real empty scan (n == 0) is an observation too; failed scans must not get
+// here. Does not release the source.
+void wifiIngestScan(WifiScanSource &src, int n, WifiScanSink &sink);
@@ -0,0 +1,269 @@
+#include "wifi_places.h"
+#include <string.h>
+
+// ============ Tuning ============
+
+static const uint8_t  PLACE_MATCH_MIN_SLOTS = 6;     // ~0.38 estimated Jaccard
+static const uint16_t PLACE_HOME_MIN_SCANS  = 20;    // before a place can be "home"
+static const uint8_t  PLACE_BLOB_VERSION    = 1;
+static const int      PLACE_SIG_REFRESH     = 4;     // visits a signature slot remembers
+
+static_assert(PLACE_MAX <= 16, "bucket bit set is uint16_t");
+
+static const int ROWS_PER_BAND = PLACE_SIG_LEN / PLACE_LSH_BANDS;
+
+// Single-row bands make the candidate set exact at the threshold (see header).
+static_assert(ROWS_PER_BAND == 1, "wider bands can miss places above PLACE_MATCH_MIN_SLOTS");
+static_assert(PLACE_MATCH_MIN_SLOTS >= 1 && PLACE_MATCH_MIN_SLOTS <= 7, "band votes are 3-bit counters");
+
+// ============ Hashing ============
+
+// Murmur3 finalizer — cheap, well-mixed 32-bit hash.
+static uint32_t mix32(uint32_t x) {
+    x ^= x >> 16; x *= 0x85ebca6bu;
+    x ^= x >> 13; x *= 0xc2b2ae35u;
+    x ^= x >> 16;
+    return x;
+}
+
+static uint32_t bandBucket(const PlaceSignature &sig, int band) {
+    uint32_t h = (uint32_t)band * 0x9e3779b9u;
+    for (int r = 0; r < ROWS_PER_BAND; r++) {
+        h = mix32(h ^ sig.slot[band * ROWS_PER_BAND + r]);
+    }
+    return h & (PLACE_LSH_BUCKETS - 1);
+}
+
+static uint8_t sigSimilarity(const PlaceSignature &a, const PlaceSignature &b) {
+    uint8_t same = 0;
+    for (int k = 0; k < PLACE_SIG_LEN; k++) {
+        if (a.slot[k] == b.slot[k]) same++;
+    }
+    return same;
+}
+
+static void indexInsert(PlaceDb &db, int id) {
+    for (int b = 0; b < PLACE_LSH_BANDS; b++) {
+        db.index[b][bandBucket(db.places[id].sig, b)] |= (uint16_t)(1u << id);
+    }
+}
+
+static void indexRemove(PlaceDb &db, int id) {
+    for (int b = 0; b < PLACE_LSH_BANDS; b++) {
+        db.index[b][bandBucket(db.places[id].sig, b)] &= (uint16_t)~(1u << id);
+    }
+}
+
+static void indexRebuild(PlaceDb &db) {
+    memset(db.index, 0, sizeof(db.index));
+    for (int i = 0; i < PLACE_MAX; i++) {
+        if (db.places[i].used) indexInsert(db, i);
+    }
+}
+
+// ============ Signature ============
+
+void placeSigBegin(PlaceSignature &sig) {
+    for (int k = 0; k < PLACE_SIG_LEN; k++) sig.slot[k] = 0xFFFF;
+    sig.nets = 0;
+}
+
+void placeSigAdd(PlaceSignature &sig, const uint8_t bssid[6]) {
+    uint32_t x = mix32(((uint32_t)bssid[0] << 24 | (uint32_t)bssid[1] << 16 |
+                        (uint32_t)bssid[2] << 8  | bssid[3]) ^
+                       mix32((uint32_t)bssid[4] << 8 | bssid[5]));
+    for (int k = 0; k < PLACE_SIG_LEN; k++) {
+        uint16_t h = (uint16_t)(mix32(x + (uint32_t)k * 0x9e3779b9u) >> 16);
+        if (h < sig.slot[k]) sig.slot[k] = h;
+    }
+    if (sig.nets < 255) sig.nets++;
+}
+
+// ============ Database ============
+
+void placeDbInit(PlaceDb &db) {
+    memset(&db, 0, sizeof(db));
+}
+
+// Best place among the ids set in mask.
+static int bestOf(const PlaceDb &db, const PlaceSignature &sig, uint16_t mask, uint8_t &bestSim) {
+    int best = -1;
+    bestSim  = 0;
+    for (int id = 0; mask; id++, mask >>= 1) {
+        if (!(mask & 1) || !db.places[id].used) continue;
+
+        uint8_t sim = sigSimilarity(sig, db.places[id].sig);
+        if (sim > bestSim) { bestSim = sim; best = id; }
+    }
+    return best;
+}
+
+// Places sharing a band bucket with sig in at least PLACE_MATCH_MIN_SLOTS
+// bands. Votes are counted for all 16 ids at once in a bit-sliced 3-bit
+// counter (lane i = place i) that saturates at 7, so a place that only
+// collides in a bucket or two is never compared.
+static uint16_t bandCandidates(const PlaceDb &db, const PlaceSignature &sig) {
+    uint16_t c0 = 0, c1 = 0, c2 = 0;
+    for (int b = 0; b < PLACE_LSH_BANDS; b++) {
+        uint16_t in = db.index[b][bandBucket(sig, b)] & (uint16_t)~(c0 & c1 & c2);
+        uint16_t carry0 = c0 & in;
+        c0 ^= in;
+        uint16_t carry1 = c1 & carry0;
+        c1 ^= carry0;
+        c2 |= carry1;
+    }
+
+    uint16_t cand = 0;
+    for (int v = PLACE_MATCH_MIN_SLOTS; v <= 7; v++) {
+        cand |= (uint16_t)((v & 1 ? c0 : ~c0) & (v & 2 ? c1 : ~c1) & (v & 4 ? c2 : ~c2));
+    }
+    return cand;
+}
+
+static void placeRemove(PlaceDb &db, int id) {
+    indexRemove(db, id);
+    memset(&db.places[id], 0, sizeof(db.places[id]));
+    db.count--;
+}
+
+int placeDbMatch(const PlaceDb &db, const PlaceSignature &sig, uint8_t *similarity) {
+    // Only places with enough band votes are compared, each once
+    uint16_t cand = bandCandidates(db, sig);
+
+    uint8_t bestSim;
+    int     best = bestOf(db, sig, cand, bestSim);
+
+    if (similarity) *similarity = bestSim;
+    return (bestSim >= PLACE_MATCH_MIN_SLOTS) ? best : -1;
+}
+
+int placeDbHome(const PlaceDb &db) {
+    int      home  = -1;
+    uint16_t scans = PLACE_HOME_MIN_SCANS - 1;
+    for (int i = 0; i < PLACE_MAX; i++) {
+        if (db.places[i].used && db.places[i].scans > scans) {
+            scans = db.places[i].scans;
+            home  = i;
+        }
+    }
+    return home;
+}
+
+PlaceMatch placeDbObserve(PlaceDb &db, const PlaceSignature &sig) {
+    PlaceMatch m = { PLACE_UNKNOWN, -1, 0 };
+    if (sig.nets < PLACE_MIN_NETS) return m;
+
+    int id = placeDbMatch(db, sig, &m.similarity);
+    if (id >= 0) {
+        int homeBefore = placeDbHome(db);
+
+        // One place learned twice (a sparse scan that matched nothing): when
+        // this scan matches another place as well, fold the less visited one
+        // into the other.
+        uint16_t dup = bandCandidates(db, sig) & (uint16_t)~(1u << id);
+        for (int j = 0; dup; j++, dup >>= 1) {
+            if (!(dup & 1) || !db.places[j].used) continue;
+            if (sigSimilarity(sig, db.places[j].sig) < PLACE_MATCH_MIN_SLOTS) continue;
+
+            int keep = (db.places[j].scans > db.places[id].scans) ? j : id;
+            int drop = (keep == j) ? id : j;
+            uint32_t scans = (uint32_t)db.places[keep].scans + db.places[drop].scans;
+            db.places[keep].scans = (uint16_t)(scans < 0xFFFF ? scans : 0xFFFF);
+            placeRemove(db, drop);
+            id = keep;
+            db.dirty = true;
+        }
+
+        KnownPlace &p = db.places[id];
+        if (p.scans < 0xFFFF) p.scans++;
+
+        // Decaying union: every slot keeps the minimum over this scan and the
+        // previous visits, except a rotating 1/PLACE_SIG_REFRESH of the slots
+        // which restart from this scan. Each slot thus covers the last
+        // PLACE_SIG_REFRESH visits: APs that come and go at the same place keep
+        // matching, APs that left age out instead of piling up forever.
+        int phase = p.scans % PLACE_SIG_REFRESH;
+        PlaceSignature next = p.sig;
+        for (int k = 0; k < PLACE_SIG_LEN; k++) {
+            bool restart = (k % PLACE_SIG_REFRESH) == phase;
+            if (restart || sig.slot[k] < next.slot[k]) next.slot[k] = sig.slot[k];
+        }
+        if (memcmp(next.slot, p.sig.slot, sizeof(next.slot)) != 0) {
+            indexRemove(db, id);
+            memcpy(p.sig.slot, next.slot, sizeof(next.slot));
+            indexInsert(db, id);
+        }
+        p.sig.nets = sig.nets;
+
+        // A visit always moves the counts, but that alone is not worth a flash
+        // write per scan; only a new home is
+        int home = placeDbHome(db);
+        if (home != homeBefore) db.dirty = true;
+        else                    db.touched = true;
+
+        m.id   = (int8_t)id;
+        m.kind = (id == home) ? PLACE_HOME : PLACE_KNOWN;
+        return m;
+    }
+
+    // Learn: free slot, else evict the least visited place
+    int slot = -1;
+    for (int i = 0; i < PLACE_MAX; i++) {
+        if (!db.places[i].used) { slot = i; break; }
+        if (slot < 0 || db.places[i].scans < db.places[slot].scans) slot = i;
+    }
+    if (db.places[slot].used) placeRemove(db, slot);   // evicted
+    db.count++;
+
+    db.places[slot].sig   = sig;
+    db.places[slot].scans = 1;
+    db.places[slot].used  = true;
+    indexInsert(db, slot);
+
+    db.dirty = true;
+    m.id   = (int8_t)slot;
+    m.kind = PLACE_NEW;
+    return m;
+}
+
+// ============ Serialization ============
+// Layout: version, count, then PLACE_MAX x { nets (0 = unused), scans (le16), slots (le16 x N) }
+
+size_t placeDbSerialize(const PlaceDb &db, uint8_t *buf, size_t len) {
+    if (len < PLACE_DB_BLOB_SIZE) return 0;
+    uint8_t *p = buf;
+    *p++ = PLACE_BLOB_VERSION;
+    *p++ = db.count;
+    for (int i = 0; i < PLACE_MAX; i++) {
+        const KnownPlace &kp = db.places[i];
+        *p++ = kp.used ? kp.sig.nets : 0;          // nets > 0 doubles as "used"
+        *p++ = (uint8_t)(kp.scans & 0xFF);
+        *p++ = (uint8_t)(kp.scans >> 8);
+        for (int k = 0; k < PLACE_SIG_LEN; k++) {
+            *p++ = (uint8_t)(kp.sig.slot[k] & 0xFF);
+            *p++ = (uint8_t)(kp.sig.slot[k] >> 8);
+        }
+    }
+    return (size_t)(p - buf);
+}
+
+bool placeDbDeserialize(PlaceDb &db, const uint8_t *buf, size_t len) {
+    placeDbInit(db);
+    if (len < PLACE_DB_BLOB_SIZE || buf[0] != PLACE_BLOB_VERSION) return false;
+
+    const uint8_t *p = buf + 2;
+    for (int i = 0; i < PLACE_MAX; i++) {
+        KnownPlace &kp = db.places[i];
+        kp.sig.nets = *p++;
+        kp.used     = (kp.sig.nets > 0);
+        kp.scans    = (uint16_t)(p[0] | (p[1] << 8));
+        p += 2;
+        for (int k = 0; k < PLACE_SIG_LEN; k++) {
+            kp.sig.slot[k] = (uint16_t)(p[0] | (p[1] << 8));
+            p += 2;
+        }
+        if (kp.used) db.count++;
+    }
+    indexRebuild(db);
+    return true;
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ============ Location fingerprinting (MinHash + LSH) ============
+//
+// Each scan's BSSID set is reduced to a MinHash signature. Known places live
+// in a small table indexed by LSH bands, so a match costs a fixed number of
+// bucket probes no matter how many places are stored. A bucket holds a bit
+// set of place ids, so places whose bands collide all stay reachable.
+// Bands are one row wide: a place that shares k signature slots with the scan
+// sits in the scan's bucket of at least k bands, so counting band votes per
+// place and comparing only those with enough votes finds every place that can
+// reach the match threshold. Bucket collisions only add votes, never hide a
+// place, and nothing outside the candidates is ever compared.
+// Zero hardware deps.
+
+#define PLACE_SIG_LEN      16    // MinHash slots (16-bit each)
+#define PLACE_LSH_BANDS    16    // bands of PLACE_SIG_LEN / PLACE_LSH_BANDS rows
+#define PLACE_LSH_BUCKETS  64    // buckets per band (power of two)
+#define PLACE_MAX          16    // known places kept (<= 16: one bit per place in a bucket)
+#define PLACE_MIN_NETS     3     // fewer BSSIDs -> too weak to fingerprint
+
+struct PlaceSignature {
+    uint16_t slot[PLACE_SIG_LEN];
+    uint8_t  nets;               // BSSIDs folded in
+};
+
+struct KnownPlace {
+    PlaceSignature sig;
+    uint16_t       scans;        // scans matched here (saturating) — "home" = most
+    bool           used;
+};
+
+// Persisted part is `places` only; the LSH index is rebuilt on load.
+struct PlaceDb {
+    KnownPlace places[PLACE_MAX];
+    uint16_t   index[PLACE_LSH_BANDS][PLACE_LSH_BUCKETS];   // bit i = place i in bucket
+    uint8_t    count;
+    bool       dirty;            // place added / evicted / merged or home moved: save soon
+    bool       touched;          // only visit counts / signatures moved: save on a long timer
+};
+
+enum PlaceKind {
+    PLACE_UNKNOWN,    // too few networks to tell
+    PLACE_NEW,        // just learned
+    PLACE_KNOWN,      // matched a stored place
+    PLACE_HOME        // matched the most visited place
+};
+
+struct PlaceMatch {
+    PlaceKind kind;
+    int8_t    id;          // place id, -1 if none
+    uint8_t   similarity;  // matching signature slots (0..PLACE_SIG_LEN)
+};
+
+// --- Signature ---
+
+void placeSigBegin(PlaceSignature &sig);
+void placeSigAdd(PlaceSignature &sig, const uint8_t bssid[6]);
+
+// --- Database ---
+
+void placeDbInit(PlaceDb &db);
+
+// Look up signature without modifying the db. Returns id or -1.
+int  placeDbMatch(const PlaceDb &db, const PlaceSignature &sig, uint8_t *similarity = nullptr);
+
+// Match and learn: counts the visit and moves the stored signature toward this
+// scan, or stores a new place (evicting the least visited one when full).
+PlaceMatch placeDbObserve(PlaceDb &db, const PlaceSignature &sig);
+
+// Id of the most visited place, -1 if none qualifies yet.
+int  placeDbHome(const PlaceDb &db);
+
+// Flat little-endian blob for NVS / LittleFS. Returns bytes written / 0 on error.
+size_t placeDbSerialize(const PlaceDb &db, uint8_t *buf, size_t len);
+bool   placeDbDeserialize(PlaceDb &db, const uint8_t *buf, size_t len);
+
+// Size of the serialized blob.
+#define PLACE_DB_BLOB_SIZE  (2 + PLACE_MAX * (PLACE_SIG_LEN * 2 + 3))
@@ -0,0 +1,97 @@
+#include "wifi_scan_esp.h"
+#include <WiFi.h>
+#include <LittleFS.h>
+
+// ============ Radio ============
+
+void WifiScanEsp::powerUp() {
+    WiFi.mode(WIFI_STA);           // esp_wifi_start(); we never associate, no disconnect needed
+}
+
+void WifiScanEsp::powerDown() {
+    WiFi.mode(WIFI_OFF);           // esp_wifi_stop() + deinit, RF powered down
+}
+
+bool WifiScanEsp::start(unsigned long now) {
+    _startMs = now;
+    return WiFi.scanNetworks(true) != WIFI_SCAN_FAILED;   // async
+}
+
+int WifiScanEsp::poll(unsigned long now) {
+    int n = WiFi.scanComplete();
+    if (n == WIFI_SCAN_RUNNING) return WIFI_SCAN_SRC_RUNNING;
+    if (n < 0)                  return WIFI_SCAN_SRC_FAILED;
+
+    if (_recording) recordScan(n, now);
+    return n;
+}
+
+bool WifiScanEsp::get(int i, WifiScanRecord &out) {
+    const uint8_t *bssid = WiFi.BSSID(i);
+    if (!bssid) return false;
+
+    memcpy(out.bssid, bssid, 6);
+    out.rssi    = (int8_t)WiFi.RSSI(i);
+    out.channel = (uint8_t)WiFi.channel(i);
+    out.isOpen  = (WiFi.encryptionType(i) == WIFI_AUTH_OPEN);
+
+    String ssid = WiFi.SSID(i);
+    strncpy(out.ssid, ssid.c_str(), sizeof(out.ssid) - 1);
+    out.ssid[sizeof(out.ssid) - 1] = '\0';
+    return true;
+}
+
+void WifiScanEsp::release() {
+    WiFi.scanDelete();
+}
+
+// ============ Trace recording ============
+
+bool WifiScanEsp::startRecording(const char *path) {
+    if (_recording) return true;
+    if (!LittleFS.begin(true)) return false;
+
+    _trace = LittleFS.open(path, FILE_APPEND);
+    if (!_trace) return false;
+
+    _recordStartMs = millis();
+    _recording     = true;
+    return true;
+}
+
+void WifiScanEsp::stopRecording() {
+    if (!_recording) return;
+    _trace.close();
+    _recording = false;
+}
+
+void WifiScanEsp::recordScan(int n, unsigned long now) {
+    _trace.printf("{\"t\":%lu,\"d\":%lu,\"aps\":[", now - _recordStartMs, now - _startMs);
+
+    char ap[128];
+    bool first = true;
+    for (int i = 0; i < n && i < WIFI_SCAN_SRC_MAX; i++) {
+        WifiScanRecord rec;
+        if (!get(i, rec)) continue;
+        size_t len = wifiTraceFormatAp(ap, sizeof(ap), rec);
+        if (len == 0) continue;
+        if (!first) _trace.write(',');
+        _trace.write((const uint8_t*)ap, len);
+        first = false;
+    }
+    _trace.print("]}\n");
+    _trace.flush();
+}
+
+// ============ File trace reader ============
+
+bool WifiTraceFileReader::readLine(char *buf, size_t cap) {
+    if (cap == 0) return false;
+    while (_file.available()) {
+        size_t n = _file.readBytesUntil('\n', buf, cap - 1);
+        if (n > 0 && buf[n - 1] == '\r') n--;
+        buf[n] = '\0';
+        if (n > 0) return true;    // skip blank lines
+    }
+    return false;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <Arduino.h>
+#include <FS.h>
+#include "wifi_scan_source.h"
+
+// Real ESP32 radio backend (Arduino WiFi). Can append every completed scan to
+// a JSON-lines trace on LittleFS for later replay (WifiScanReplay).
+class WifiScanEsp : public WifiScanSource {
+public:
+    void powerUp() override;
+    void powerDown() override;
+    bool start(unsigned long now) override;
+    int  poll(unsigned long now) override;
+    bool get(int i, WifiScanRecord &out) override;
+    void release() override;
+
+    // Start appending scans to path (mounts LittleFS, formats on first use).
+    bool startRecording(const char *path);
+    void stopRecording();
+    bool isRecording() const { return _recording; }
+
+private:
+    void recordScan(int n, unsigned long now);
+
+    unsigned long _startMs       = 0;
+    unsigned long _recordStartMs = 0;
+    bool          _recording     = false;
+    fs::File      _trace;
+};
+
+// Trace reader over a LittleFS file, for replaying recorded traces on device.
+class WifiTraceFileReader : public WifiTraceReader {
+public:
+    explicit WifiTraceFileReader(fs::File file) : _file(file) {}
+    bool readLine(char *buf, size_t cap) override;
+    void rewind() override { _file.seek(0); }
+
+private:
+    fs::File _file;
+};
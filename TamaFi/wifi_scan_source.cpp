@@ -0,0 +1,304 @@
+#include "wifi_scan_source.h"
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// ============ Memory trace reader ============
+
+bool WifiTraceMemoryReader::readLine(char *buf, size_t cap) {
+    if (cap == 0) return false;
+    // Skip blank lines
+    while (_pos < _len && (_text[_pos] == '\n' || _text[_pos] == '\r')) _pos++;
+    if (_pos >= _len) return false;
+
+    size_t n = 0;
+    while (_pos < _len && _text[_pos] != '\n') {
+        char c = _text[_pos++];
+        if (c != '\r' && n + 1 < cap) buf[n++] = c;
+    }
+    buf[n] = '\0';
+    return true;
+}
+
+// ============ JSON-lines helpers ============
+// Minimal parser for the flat trace format only: objects, one array, ints, strings.
+
+static const char* skipWs(const char *p) {
+    while (*p == ' ' || *p == '\t') p++;
+    return p;
+}
+
+static bool parseInt(const char *&p, long &v) {
+    char *end;
+    v = strtol(p, &end, 10);
+    if (end == p) return false;
+    p = end;
+    return true;
+}
+
+static bool parseString(const char *&p, char *out, size_t cap) {
+    if (*p != '"') return false;
+    p++;
+    size_t n = 0;
+    while (*p && *p != '"') {
+        char c = *p++;
+        if (c == '\\' && *p) c = *p++;
+        if (out && n + 1 < cap) out[n++] = c;
+    }
+    if (*p != '"') return false;
+    p++;
+    if (out && cap > 0) out[n] = '\0';
+    return true;
+}
+
+static bool parseMac(const char *s, uint8_t out[6]) {
+    unsigned v[6];
+    if (sscanf(s, "%2x:%2x:%2x:%2x:%2x:%2x", &v[0], &v[1], &v[2], &v[3], &v[4], &v[5]) != 6) return false;
+    for (int i = 0; i < 6; i++) out[i] = (uint8_t)v[i];
+    return true;
+}
+
+// Skip a scalar value we do not know (int or string).
+static bool skipValue(const char *&p) {
+    if (*p == '"') return parseString(p, nullptr, 0);
+    long dummy;
+    return parseInt(p, dummy);
+}
+
+static bool parseAp(const char *&p, WifiScanRecord &rec) {
+    memset(&rec, 0, sizeof(rec));
+    rec.rssi = -100;
+    if (*p != '{') return false;
+    p = skipWs(p + 1);
+
+    while (*p && *p != '}') {
+        char key[4];
+        if (!parseString(p, key, sizeof(key))) return false;
+        p = skipWs(p);
+        if (*p != ':') return false;
+        p = skipWs(p + 1);
+
+        long v;
+        if (strcmp(key, "b") == 0) {
+            char mac[18];
+            if (!parseString(p, mac, sizeof(mac)) || !parseMac(mac, rec.bssid)) return false;
+        } else if (strcmp(key, "s") == 0) {
+            if (!parseString(p, rec.ssid, sizeof(rec.ssid))) return false;
+        } else if (strcmp(key, "r") == 0) {
+            if (!parseInt(p, v)) return false;
+            rec.rssi = (int8_t)v;
+        } else if (strcmp(key, "c") == 0) {
+            if (!parseInt(p, v)) return false;
+            rec.channel = (uint8_t)v;
+        } else if (strcmp(key, "o") == 0) {
+            if (!parseInt(p, v)) return false;
+            rec.isOpen = (v != 0);
+        } else if (!skipValue(p)) {
+            return false;
+        }
+
+        p = skipWs(p);
+        if (*p == ',') p = skipWs(p + 1);
+    }
+    if (*p != '}') return false;
+    p++;
+    return true;
+}
+
+int wifiTraceParseLine(const char *line, unsigned long &t, unsigned long &dur,
+                       WifiScanRecord *recs, int maxRecs) {
+    const char *p = skipWs(line);
+    if (*p != '{') return -1;
+    p = skipWs(p + 1);
+
+    t = 0;
+    dur = 0;
+    int count = 0;
+
+    while (*p && *p != '}') {
+        char key[8];
+        if (!parseString(p, key, sizeof(key))) return -1;
+        p = skipWs(p);
+        if (*p != ':') return -1;
+        p = skipWs(p + 1);
+
+        long v;
+        if (strcmp(key, "t") == 0) {
+            if (!parseInt(p, v)) return -1;
+            t = (unsigned long)v;
+        } else if (strcmp(key, "d") == 0) {
+            if (!parseInt(p, v)) return -1;
+            dur = (unsigned long)v;
+        } else if (strcmp(key, "aps") == 0) {
+            if (*p != '[') return -1;
+            p = skipWs(p + 1);
+            while (*p && *p != ']') {
+                WifiScanRecord rec;
+                if (!parseAp(p, rec)) return -1;
+                if (count < maxRecs) recs[count++] = rec;   // extra APs dropped
+                p = skipWs(p);
+                if (*p == ',') p = skipWs(p + 1);
+            }
+            if (*p != ']') return -1;
+            p++;
+        } else if (!skipValue(p)) {
+            return -1;
+        }
+
+        p = skipWs(p);
+        if (*p == ',') p = skipWs(p + 1);
+    }
+    return (*p == '}') ? count : -1;
+}
+
+size_t wifiTraceFormatAp(char *buf, size_t cap, const WifiScanRecord &rec) {
+    // Escape quotes/backslashes in SSID
+    char ssid[sizeof(rec.ssid) * 2];
+    size_t n = 0;
+    for (const char *s = rec.ssid; *s && n + 2 < sizeof(ssid); s++) {
+        if (*s == '"' || *s == '\\') ssid[n++] = '\\';
+        ssid[n++] = *s;
+    }
+    ssid[n] = '\0';
+
+    int len = snprintf(buf, cap,
+                       "{\"b\":\"%02x:%02x:%02x:%02x:%02x:%02x\",\"r\":%d,\"c\":%u,\"o\":%d,\"s\":\"%s\"}",
+                       rec.bssid[0], rec.bssid[1], rec.bssid[2], rec.bssid[3], rec.bssid[4], rec.bssid[5],
+                       (int)rec.rssi, (unsigned)rec.channel, rec.isOpen ? 1 : 0, ssid);
+    return (len > 0 && (size_t)len < cap) ? (size_t)len : 0;
+}
+
+// ============ Replay backend ============
+
+// Longest line we accept: ~90 chars per AP.
+static char replayLine[WIFI_SCAN_SRC_MAX * 96 + 64];
+
+bool WifiScanReplay::start(unsigned long now) {
+    if (_running) return true;
+
+    unsigned long t;
+    int n = -1;
+    // Skip malformed lines; rewind once at end when looping
+    for (int attempts = 0; attempts < 2 && n < 0; ) {
+        if (!_reader.readLine(replayLine, sizeof(replayLine))) {
+            if (!_loop) return false;
+            _reader.rewind();
+            attempts++;
+            continue;
+        }
+        n = wifiTraceParseLine(replayLine, t, _durMs, _recs, WIFI_SCAN_SRC_MAX);
+    }
+    if (n < 0) return false;
+
+    _count   = n;
+    _startMs = now;
+    _running = true;
+    return true;
+}
+
+int WifiScanReplay::poll(unsigned long now) {
+    if (!_running) return WIFI_SCAN_SRC_FAILED;
+    if (now - _startMs < _durMs) return WIFI_SCAN_SRC_RUNNING;   // recorded scan timing
+    _running = false;
+    return _count;
+}
+
+bool WifiScanReplay::get(int i, WifiScanRecord &out) {
+    if (i < 0 || i >= _count) return false;
+    out = _recs[i];
+    return true;
+}
+
+// ============ Synthetic backend ============
+
+static uint32_t synthMix(uint32_t x) {
+    x ^= x >> 16; x *= 0x7feb352du;
+    x ^= x >> 15; x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return x;
+}
+
+uint32_t WifiScanSynth::next() {
+    // xorshift32
+    _rng ^= _rng << 13;
+    _rng ^= _rng >> 17;
+    _rng ^= _rng << 5;
+    return _rng;
+}
+
+// Deterministic AP identity for (population, index): same BSSID/SSID every scan.
+void WifiScanSynth::makeAp(uint32_t population, uint32_t apIndex, int baseRssi, WifiScanRecord &rec) {
+    uint32_t h  = synthMix(population * 1000003u + apIndex + _seed * 7919u);
+    uint32_t h2 = synthMix(h);
+
+    rec.bssid[0] = (uint8_t)((h >> 24) & 0xFE);     // unicast
+    rec.bssid[1] = (uint8_t)(h >> 16);
+    rec.bssid[2] = (uint8_t)(h >> 8);
+    rec.bssid[3] = (uint8_t)h;
+    rec.bssid[4] = (uint8_t)(h2 >> 8);
+    rec.bssid[5] = (uint8_t)h2;
+
+    rec.channel = (uint8_t)(1 + (h2 >> 16) % 13);
+    rec.isOpen  = ((h2 >> 4) % 7) == 0;
+    if (((h2 >> 12) % 11) == 0) rec.ssid[0] = '\0';
+    else snprintf(rec.ssid, sizeof(rec.ssid), "net-%04x", (unsigned)(h & 0xFFFF));
+
+    int noise = (int)(next() % 9) - 4;               // +-4 dB per scan
+    int rssi  = baseRssi - (int)((h2 >> 20) % 30) + noise;
+    rec.rssi  = (int8_t)(rssi < -99 ? -99 : (rssi > -20 ? -20 : rssi));
+}
+
+void WifiScanSynth::emitPopulation(uint32_t population, int apCount, int visiblePct, int baseRssi) {
+    for (int i = 0; i < apCount && _count < WIFI_SCAN_SRC_MAX; i++) {
+        if ((int)(next() % 100) >= visiblePct) continue;
+        makeAp(population, (uint32_t)i, baseRssi, _recs[_count++]);
+    }
+}
+
+void WifiScanSynth::generate() {
+    _count = 0;
+
+    switch (_scenario) {
+        case SYNTH_DENSE_CITY:
+            emitPopulation(1, 50, 80, -50);
+            emitPopulation(0x10000u + _scanIndex, 3, 100, -70);   // passers-by hotspots
+            break;
+
+        case SYNTH_EMPTY_FIELD:
+            if (next() % 10 == 0) emitPopulation(2, 1, 100, -80);
+            break;
+
+        case SYNTH_COMMUTE: {
+            // 10 scans per leg: home, street, office, office, street, home
+            static const uint8_t LEGS[6] = { 0, 1, 2, 2, 1, 0 };
+            switch (LEGS[(_scanIndex / 10) % 6]) {
+                case 0:  emitPopulation(3, 15, 85, -50); break;                   // home
+                case 1:  emitPopulation(0x20000u + _scanIndex, 6, 70, -65); break; // street: all transient
+                default: emitPopulation(4, 25, 80, -55); break;                   // office
+            }
+            break;
+        }
+    }
+    _scanIndex++;
+}
+
+bool WifiScanSynth::start(unsigned long now) {
+    if (_running) return true;
+    generate();
+    _startMs = now;
+    _running = true;
+    return true;
+}
+
+int WifiScanSynth::poll(unsigned long now) {
+    if (!_running) return WIFI_SCAN_SRC_FAILED;
+    if (now - _startMs < _scanMs) return WIFI_SCAN_SRC_RUNNING;
+    _running = false;
+    return _count;
+}
+
+bool WifiScanSynth::get(int i, WifiScanRecord &out) {
+    if (i < 0 || i >= _count) return false;
+    out = _recs[i];
+    return true;
+}
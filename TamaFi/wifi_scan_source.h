@@ -0,0 +1,144 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ============ WiFi scan source abstraction ============
+//
+// wifi_service talks to a WifiScanSource instead of the Arduino WiFi object,
+// so everything that consumes scans (env model, places, pet logic) can run
+// off-device. Backends:
+//   - WifiScanEsp     (wifi_scan_esp.h)  — real ESP32 radio, optional trace recording
+//   - WifiScanReplay  — recorded JSON-lines traces, honours recorded scan durations
+//   - WifiScanSynth   — generated scenarios (dense city, empty field, commute)
+// Replay and synth have zero hardware deps.
+
+// One access point of a completed scan.
+struct WifiScanRecord {
+    uint8_t bssid[6];
+    int8_t  rssi;
+    uint8_t channel;
+    bool    isOpen;
+    char    ssid[33];    // "" = hidden
+};
+
+// poll() results besides the network count
+#define WIFI_SCAN_SRC_RUNNING  (-1)
+#define WIFI_SCAN_SRC_FAILED   (-2)
+
+// Upper bound of records a non-radio backend returns per scan.
+#define WIFI_SCAN_SRC_MAX      64
+
+class WifiScanSource {
+public:
+    virtual ~WifiScanSource() {}
+
+    // Radio power (no-op for non-radio backends).
+    virtual void powerUp()   {}
+    virtual void powerDown() {}
+
+    // Begin an async scan. Returns false if it could not start.
+    virtual bool start(unsigned long now) = 0;
+
+    // WIFI_SCAN_SRC_RUNNING, WIFI_SCAN_SRC_FAILED, or number of networks found.
+    virtual int  poll(unsigned long now) = 0;
+
+    // Record i of the completed scan (0 <= i < poll() result).
+    virtual bool get(int i, WifiScanRecord &out) = 0;
+
+    // Drop results of the completed scan.
+    virtual void release() = 0;
+};
+
+// ============ Trace format (JSON lines) ============
+//
+// One scan per line:
+//   {"t":12345,"d":2140,"aps":[{"b":"a4:2b:b0:11:22:33","r":-61,"c":6,"o":0,"s":"MyNet"},...]}
+// t = ms since recording started, d = scan duration ms, o = open (1/0), s = SSID.
+
+// Line source for replay. readLine() returns false at end of trace.
+class WifiTraceReader {
+public:
+    virtual ~WifiTraceReader() {}
+    virtual bool readLine(char *buf, size_t cap) = 0;
+    virtual void rewind() = 0;
+};
+
+// Trace held in memory (flash string on device, loaded file on host).
+class WifiTraceMemoryReader : public WifiTraceReader {
+public:
+    WifiTraceMemoryReader(const char *text, size_t len) : _text(text), _len(len), _pos(0) {}
+    bool readLine(char *buf, size_t cap) override;
+    void rewind() override { _pos = 0; }
+
+private:
+    const char *_text;
+    size_t      _len;
+    size_t      _pos;
+};
+
+// Format one AP object ({"b":..}) into buf. Returns chars written (0 if it did not fit).
+size_t wifiTraceFormatAp(char *buf, size_t cap, const WifiScanRecord &rec);
+
+// Parse one trace line. Returns records parsed (<= maxRecs) or -1 on malformed line.
+int wifiTraceParseLine(const char *line, unsigned long &t, unsigned long &dur,
+                       WifiScanRecord *recs, int maxRecs);
+
+// ============ Replay backend ============
+
+class WifiScanReplay : public WifiScanSource {
+public:
+    // loop: rewind at end of trace instead of failing.
+    WifiScanReplay(WifiTraceReader &reader, bool loop = true)
+        : _reader(reader), _loop(loop), _count(0), _startMs(0), _durMs(0), _running(false) {}
+
+    bool start(unsigned long now) override;
+    int  poll(unsigned long now) override;
+    bool get(int i, WifiScanRecord &out) override;
+    void release() override { _count = 0; }
+
+private:
+    WifiTraceReader &_reader;
+    bool            _loop;
+    WifiScanRecord  _recs[WIFI_SCAN_SRC_MAX];
+    int             _count;
+    unsigned long   _startMs;
+    unsigned long   _durMs;
+    bool            _running;
+};
+
+// ============ Synthetic backend ============
+
+enum WifiSynthScenario {
+    SYNTH_DENSE_CITY,    // dozens of APs, many strong, some open/hidden, churn
+    SYNTH_EMPTY_FIELD,   // nothing, occasionally one weak AP
+    SYNTH_COMMUTE        // home -> street -> office -> street -> home, repeating
+};
+
+class WifiScanSynth : public WifiScanSource {
+public:
+    WifiScanSynth(WifiSynthScenario scenario, uint32_t seed = 1, unsigned long scanMs = 2000)
+        : _scenario(scenario), _seed(seed), _rng(seed), _scanMs(scanMs),
+          _scanIndex(0), _count(0), _startMs(0), _running(false) {}
+
+    bool start(unsigned long now) override;
+    int  poll(unsigned long now) override;
+    bool get(int i, WifiScanRecord &out) override;
+    void release() override { _count = 0; }
+
+private:
+    uint32_t next();
+    void     makeAp(uint32_t population, uint32_t apIndex, int baseRssi, WifiScanRecord &rec);
+    void     emitPopulation(uint32_t population, int apCount, int visiblePct, int baseRssi);
+    void     generate();
+
+    WifiSynthScenario _scenario;
+    uint32_t          _seed;
+    uint32_t          _rng;
+    unsigned long     _scanMs;
+    uint32_t          _scanIndex;
+    WifiScanRecord    _recs[WIFI_SCAN_SRC_MAX];
+    int               _count;
+    unsigned long     _startMs;
+    bool              _running;
+};
@@ -1,79 +1,226 @@
 #include "wifi_service.h"
-#include <WiFi.h>
+#include "wifi_ingest.h"
+#include "wifi_scan_esp.h"
+#include "wifi_sniffer.h"
+#include "device_config.h"      // WIFI_RECORD_TRACES, WIFI_TRACE_PATH
 
 // --- State ---
 
 WifiStats       wifiStats;
+WifiEnvModel    wifiEnv;
+PlaceDb         wifiPlaces;
+PlaceMatch      wifiPlace          = { PLACE_UNKNOWN, -1, 0 };
 WifiNetworkInfo wifiList[MAX_WIFI_LIST];
 int             wifiListCount      = 0;
 bool            wifiScanInProgress = false;
 unsigned long   lastWifiScanTime   = 0;
 
+// ============ Scan backend ============
+
+static WifiScanEsp     espScanSource;
+static WifiScanSource *scanSource = &espScanSource;
+
+// ============ Radio lifecycle ============
+
+// Radio stays up this long after a scan completes, then esp_wifi_stop().
+static const unsigned long RADIO_GRACE_MS = 3000;
+
+static WifiRadioState radioState      = RADIO_OFF;
+static unsigned long  radioGraceStart = 0;
+
+// Passive sensing: beacons folded into wifiEnv this often
+static const unsigned long AMBIENT_FOLD_MS = 10000;
+
+static bool           passiveMode     = false;
+static bool           suspended       = false;   // power emergency: radio stays off
+static unsigned long  lastAmbientFold = 0;
+static bool           ambientUpdated  = false;
+
+// Radio-on accounting: 60 one-minute buckets = rolling hour.
+static const int      RADIO_BUCKETS = 60;
+static uint16_t       radioOnBucketMs[RADIO_BUCKETS];
+static int            radioBucketIdx     = 0;
+static unsigned long  radioBucketStart   = 0;
+static unsigned long  radioLastAccountMs = 0;
+
+static void radioAccount(unsigned long now) {
+    // Rotate minute buckets (zero the ones we skipped over)
+    while (now - radioBucketStart >= 60000UL) {
+        radioBucketStart += 60000UL;
+        radioBucketIdx = (radioBucketIdx + 1) % RADIO_BUCKETS;
+        radioOnBucketMs[radioBucketIdx] = 0;
+    }
+
+    if (radioState != RADIO_OFF) {
+        uint32_t total = radioOnBucketMs[radioBucketIdx] + (now - radioLastAccountMs);
+        radioOnBucketMs[radioBucketIdx] = (uint16_t)min(total, (uint32_t)60000);
+    }
+    radioLastAccountMs = now;
+}
+
+static void radioUp(unsigned long now) {
+    if (radioState != RADIO_OFF) return;
+    radioAccount(now);
+    scanSource->powerUp();
+}
+
+static void radioDown(unsigned long now) {
+    if (radioState == RADIO_OFF) return;
+    wifiSnifferStop();
+    radioAccount(now);
+    scanSource->powerDown();       // real radio: esp_wifi_stop(), RF powered down
+    radioState = RADIO_OFF;
+}
+
 // ============ Public API ============
 
+void wifiSetScanSource(WifiScanSource *src) {
+    if (wifiScanInProgress) return;
+    scanSource->powerDown();
+    scanSource = src ? src : &espScanSource;
+    radioState = RADIO_OFF;
+}
+
 void wifiInit() {
-    WiFi.mode(WIFI_STA);
-    WiFi.disconnect(true);
+    scanSource->powerDown();
+    radioState         = RADIO_OFF;
+    radioBucketStart   = millis();
+    lastAmbientFold    = radioBucketStart;
+    radioLastAccountMs = radioBucketStart;
+    for (int i = 0; i < RADIO_BUCKETS; i++) radioOnBucketMs[i] = 0;
+
+    wifiEnvInit(wifiEnv);
+    placeDbInit(wifiPlaces);
+    wifiSnifferInit(BEACON_MAX_FRAMES_PER_SEC, BEACON_DECIMATION);
+
+#if WIFI_RECORD_TRACES
+    espScanSource.startRecording(WIFI_TRACE_PATH);
+#endif
 }
 
 void wifiStartScan() {
-    WiFi.mode(WIFI_STA);
-    WiFi.disconnect(true);
-    WiFi.scanNetworks(true);       // async
+    if (wifiScanInProgress) return;
+
+    if (suspended) {
+        // Completes as a failed (empty) scan in wifiCheckScanDone()
+        wifiScanInProgress = true;
+        return;
+    }
+
+    unsigned long now = millis();
+    radioUp(now);
+    wifiSnifferStop();             // active scan hops channels itself
+    radioState = RADIO_SCANNING;
+
+    // A failed start surfaces as WIFI_SCAN_SRC_FAILED from poll() -> empty result
+    scanSource->start(now);
     wifiScanInProgress = true;
 }
 
+// Fold the live beacon table into the environment model as one "scan".
+static void foldAmbient() {
+    const BeaconAgg &agg = wifiSnifferAgg();
+    wifiEnvBeginScan(wifiEnv);
+    for (int i = 0; i < BEACON_AGG_MAX; i++) {
+        const BeaconAp &ap = agg.ap[i];
+        if (!ap.used) continue;
+        wifiEnvAddNetwork(wifiEnv, ap.bssid, ap.rssiQ4 / 16,
+                          ap.flags & BEACON_FLAG_OPEN, ap.flags & BEACON_FLAG_HIDDEN);
+    }
+    wifiEnvEndScan(wifiEnv);
+    ambientUpdated = true;
+}
+
+void wifiUpdate(unsigned long now) {
+    radioAccount(now);
+
+    if (radioState == RADIO_GRACE && now - radioGraceStart >= RADIO_GRACE_MS) {
+        if (passiveMode && !suspended) {
+            wifiSnifferStart();
+            radioState = RADIO_LISTEN;
+        } else {
+            radioDown(now);
+        }
+    }
+
+    if (radioState == RADIO_LISTEN) {
+        wifiSnifferUpdate(now);
+        if (now - lastAmbientFold >= AMBIENT_FOLD_MS) {
+            lastAmbientFold = now;
+            foldAmbient();
+        }
+    }
+}
+
+void wifiSetPassive(bool enabled) {
+    passiveMode = enabled;
+    if (suspended) return;              // applied by wifiSetSuspended(false)
+    unsigned long now = millis();
+
+    if (enabled && radioState == RADIO_OFF) {
+        radioUp(now);
+        wifiSnifferStart();
+        radioState      = RADIO_LISTEN;
+        lastAmbientFold = now;
+    } else if (!enabled && radioState == RADIO_LISTEN) {
+        radioDown(now);
+    }
+    // SCANNING / GRACE: wifiUpdate() picks the right follow-up state
+}
+
+void wifiSetSuspended(bool on) {
+    if (on == suspended) return;
+    unsigned long now = millis();
+
+    if (on) {
+        radioDown(now);
+        suspended = true;
+    } else {
+        suspended = false;
+        wifiSetPassive(passiveMode);
+    }
+}
+
+bool wifiCheckAmbientUpdate() {
+    bool updated = ambientUpdated;
+    ambientUpdated = false;
+    return updated;
+}
+
+WifiRadioState wifiRadioState() {
+    return radioState;
+}
+
+uint32_t wifiRadioOnMsPerHour() {
+    uint32_t total = 0;
+    for (int i = 0; i < RADIO_BUCKETS; i++) total += radioOnBucketMs[i];
+    return total;
+}
+
 bool wifiCheckScanDone() {
     if (!wifiScanInProgress) return false;
 
-    int n = WiFi.scanComplete();
-    if (n == WIFI_SCAN_RUNNING) return false;
+    int n = suspended ? WIFI_SCAN_SRC_FAILED : scanSource->poll(millis());
+    if (n == WIFI_SCAN_SRC_RUNNING) return false;
 
     wifiScanInProgress = false;
     lastWifiScanTime   = millis();
 
+    radioState      = suspended ? RADIO_OFF : RADIO_GRACE;
+    radioGraceStart = lastWifiScanTime;
+
     if (n < 0) {
+        // Failed scan is not an observation: the environment model and the
+        // place stay as they were (only a real empty scan means "nothing here")
         wifiStats     = WifiStats();
         wifiListCount = 0;
-        WiFi.scanDelete();
+        scanSource->release();
         return true;
     }
 
-    WifiStats s;
-    s.netCount    = n;
-    s.strongCount = 0;
-    s.hiddenCount = 0;
-    s.openCount   = 0;
-    s.wpaCount    = 0;
-    int totalRSSI = 0;
-
-    wifiListCount = 0;
-
-    for (int i = 0; i < n; i++) {
-        int rssi = WiFi.RSSI(i);
-        totalRSSI += rssi;
-        if (rssi > -60) s.strongCount++;
-
-        String ssid    = WiFi.SSID(i);
-        bool   isHidden = (ssid.length() == 0);
-        if (isHidden) s.hiddenCount++;
-
-        wifi_auth_mode_t enc = WiFi.encryptionType(i);
-        bool isOpen = (enc == WIFI_AUTH_OPEN);
-        if (isOpen) s.openCount++;
-        else        s.wpaCount++;
-
-        if (wifiListCount < MAX_WIFI_LIST) {
-            WifiNetworkInfo &info = wifiList[wifiListCount++];
-            info.ssid   = isHidden ? String("(hidden)") : ssid;
-            info.rssi   = rssi;
-            info.isOpen = isOpen;
-        }
-    }
-
-    s.avgRSSI = (n > 0) ? (totalRSSI / n) : -100;
-    wifiStats = s;
+    WifiScanSink sink = { wifiEnv, wifiPlaces, wifiStats, wifiPlace, wifiList, wifiListCount };
+    wifiIngestScan(*scanSource, n, sink);
 
-    WiFi.scanDelete();
+    scanSource->release();
     return true;
 }
@@ -2,19 +2,59 @@
 
 #include <Arduino.h>
 #include "pet_logic.h"   // WifiStats, WifiNetworkInfo, MAX_WIFI_LIST
+#include "wifi_env.h"    // WifiEnvModel
+#include "wifi_places.h" // PlaceDb, PlaceMatch
+#include "wifi_scan_source.h"
 
-// Initialize WiFi in STA mode.
+// Radio power state. The radio is brought up on demand by wifiStartScan()
+// and stopped (esp_wifi_stop) once the scan is done and the grace period ends.
+enum WifiRadioState {
+    RADIO_OFF,        // driver stopped, RF unpowered
+    RADIO_SCANNING,   // STA up, async scan running
+    RADIO_GRACE,      // scan done, radio kept up briefly for a follow-up scan
+    RADIO_LISTEN      // passive mode: promiscuous beacon listening between scans
+};
+
+// Initialize WiFi service. Radio stays off until the first scan.
 void wifiInit();
 
-// Start async WiFi scan.
+// Use another scan backend (replay / synthetic); nullptr = real ESP32 radio.
+// Call before wifiInit() or while no scan is running.
+void wifiSetScanSource(WifiScanSource *src);
+
+// Start async WiFi scan (powers the radio up if needed).
 void wifiStartScan();
 
 // Check if scan completed. Returns true when done (results in wifiStats/wifiList).
 bool wifiCheckScanDone();
 
+// Radio lifecycle: power down after grace period, account radio-on time,
+// drive passive listening. Call every loop().
+void wifiUpdate(unsigned long now);
+
+// Passive sensing: keep the radio up and listen to beacons between scans.
+// Costs radio-on time; off by default.
+void wifiSetPassive(bool enabled);
+
+// Power emergency: force the radio off and answer scan requests with an empty
+// result until released. Passive mode resumes on release.
+void wifiSetSuspended(bool on);
+
+// True once per passive refresh that folded beacons into wifiEnv.
+bool wifiCheckAmbientUpdate();
+
+// Current radio power state.
+WifiRadioState wifiRadioState();
+
+// Radio-on time over the last 60 minutes (rolling window), ms.
+uint32_t wifiRadioOnMsPerHour();
+
 // --- State (readable by UI and orchestrator) ---
 
 extern WifiStats       wifiStats;
+extern WifiEnvModel    wifiEnv;         // smoothed environment, updated per scan
+extern PlaceDb         wifiPlaces;      // known places (persisted by persistence.cpp)
+extern PlaceMatch      wifiPlace;       // fingerprint match of the last scan
 extern WifiNetworkInfo wifiList[MAX_WIFI_LIST];
 extern int             wifiListCount;
 extern bool            wifiScanInProgress;
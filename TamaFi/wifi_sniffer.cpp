@@ -0,0 +1,109 @@
+#include "wifi_sniffer.h"
+#include <esp_wifi.h>
+
+static const unsigned long HOP_INTERVAL_MS    = 200;
+static const unsigned long REFRESH_INTERVAL_MS = 1000;
+static const unsigned long AP_WINDOW_MS       = 30000;
+static const uint8_t       CHANNEL_MAX        = 13;
+
+static BeaconRing ring;
+static BeaconAgg  agg;
+
+static volatile uint8_t decimation = 1;
+static uint8_t          decimCount = 0;     // touched by RX callback only
+
+static bool          active       = false;
+static uint8_t       channel      = 1;
+static unsigned long lastHopMs    = 0;
+static unsigned long lastRefresh  = 0;
+
+// ============ RX callback (WiFi task context — keep it short) ============
+
+static void onPromiscuousRx(void *buf, wifi_promiscuous_pkt_type_t type) {
+    if (type != WIFI_PKT_MGMT) return;
+
+    const wifi_promiscuous_pkt_t *pkt = (const wifi_promiscuous_pkt_t*)buf;
+    const uint8_t *f   = pkt->payload;
+    int            len = pkt->rx_ctrl.sig_len;
+    if (len < 38 || f[0] != 0x80) return;          // beacon subtype only
+
+    if (++decimCount < decimation) return;
+    decimCount = 0;
+
+    BeaconSample s;
+    memcpy(s.bssid, f + 16, 6);                    // addr3 = BSSID
+    s.rssi    = (int8_t)pkt->rx_ctrl.rssi;
+    s.channel = (uint8_t)pkt->rx_ctrl.channel;
+
+    uint16_t capab = (uint16_t)(f[34] | (f[35] << 8));
+    s.flags = (capab & 0x0010) ? 0 : BEACON_FLAG_OPEN;   // privacy bit
+
+    // First IE is SSID: empty or all-zero => hidden
+    if (f[36] == 0) {
+        uint8_t ssidLen = f[37];
+        bool    hidden  = true;
+        for (int i = 0; i < ssidLen && 38 + i < len; i++) {
+            if (f[38 + i] != 0) { hidden = false; break; }
+        }
+        if (hidden) s.flags |= BEACON_FLAG_HIDDEN;
+    }
+
+    beaconRingPush(ring, s);
+}
+
+// ============ Public API ============
+
+void wifiSnifferInit(uint32_t maxFramesPerSec, uint8_t decim) {
+    beaconRingInit(ring);
+    beaconAggInit(agg, maxFramesPerSec, AP_WINDOW_MS);
+    decimation = decim ? decim : 1;
+}
+
+void wifiSnifferStart() {
+    if (active) return;
+
+    wifi_promiscuous_filter_t filter = {};
+    filter.filter_mask = WIFI_PROMIS_FILTER_MASK_MGMT;
+    esp_wifi_set_promiscuous_filter(&filter);
+    esp_wifi_set_promiscuous_rx_cb(&onPromiscuousRx);
+    esp_wifi_set_promiscuous(true);
+    esp_wifi_set_channel(channel, WIFI_SECOND_CHAN_NONE);
+
+    lastHopMs = lastRefresh = agg.lastRefillMs = millis();
+    active = true;
+}
+
+void wifiSnifferStop() {
+    if (!active) return;
+    esp_wifi_set_promiscuous(false);
+    active = false;
+}
+
+bool wifiSnifferActive() {
+    return active;
+}
+
+void wifiSnifferUpdate(unsigned long now) {
+    if (!active) return;
+
+    beaconAggProcess(agg, ring, now);
+
+    if (now - lastHopMs >= HOP_INTERVAL_MS) {
+        lastHopMs = now;
+        channel = (channel % CHANNEL_MAX) + 1;
+        esp_wifi_set_channel(channel, WIFI_SECOND_CHAN_NONE);
+    }
+
+    if (now - lastRefresh >= REFRESH_INTERVAL_MS) {
+        lastRefresh = now;
+        beaconAggRefresh(agg, now);
+    }
+}
+
+const BeaconAgg& wifiSnifferAgg() {
+    return agg;
+}
+
+uint32_t wifiSnifferDropped() {
+    return ring.dropped.load(std::memory_order_relaxed);
+}
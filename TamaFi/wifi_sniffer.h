@@ -0,0 +1,25 @@
+#pragma once
+
+#include <Arduino.h>
+#include "beacon_agg.h"
+
+// Passive environment sensing: promiscuous RX filtered to beacon frames,
+// hopping channels 1..13. The RX callback only parses and pushes into a
+// lock-free ring; wifiSnifferUpdate() folds frames under a per-second budget.
+// Radio must already be up in STA mode (wifi_service handles that).
+
+// Configure budget and decimation (1 = every beacon, N = every Nth).
+void wifiSnifferInit(uint32_t maxFramesPerSec, uint8_t decimation);
+
+void wifiSnifferStart();
+void wifiSnifferStop();
+bool wifiSnifferActive();
+
+// Drain ring, hop channel, refresh stats. Call every loop() while active.
+void wifiSnifferUpdate(unsigned long now);
+
+// Aggregated view (per-BSSID table + stats).
+const BeaconAgg& wifiSnifferAgg();
+
+// Frames lost because the ring was full.
+uint32_t wifiSnifferDropped();
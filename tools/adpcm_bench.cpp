@@ -0,0 +1,52 @@
+// ============================================================
+// adpcm_bench — decode cost and flash use of the sampled effects on the host
+//
+//   g++ -O2 -std=gnu++17 -I../TamaFi adpcm_bench.cpp ../TamaFi/adpcm.cpp
+//       ../TamaFi/sfx.cpp -o adpcm_bench
+//   ./adpcm_bench [out.raw]
+//
+// Decodes every clip in mixer-sized blocks (as the audio task does) and
+// prints decode time per second of audio and flash bytes per second. With an
+// argument, also writes the decoded clips as raw 16-bit mono PCM.
+// ============================================================
+
+#include "adpcm.h"
+#include "sfx.h"
+
+#include <chrono>
+#include <cstdio>
+
+static const int BLOCK = 128;      // RENDER_BLOCK
+static const int REPS  = 200;
+
+int main(int argc, char **argv) {
+    FILE *raw = argc > 1 ? fopen(argv[1], "wb") : nullptr;
+    int16_t buf[BLOCK];
+    double  totalUs = 0, totalSec = 0;
+    uint32_t totalBytes = 0;
+
+    for (uint8_t id = 0; id < SFX_COUNT; id++) {
+        const AdpcmClip *clip = sfxClip(id);
+        AdpcmStream s;
+        uint32_t check = 0;
+
+        auto t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < REPS; r++) {
+            adpcmStart(s, clip);
+            int n;
+            while ((n = adpcmDecode(s, buf, BLOCK)) > 0) {
+                check += (uint16_t)buf[n - 1];
+                if (raw && r == 0) fwrite(buf, sizeof(int16_t), (size_t)n, raw);
+            }
+        }
+        double us  = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / REPS;
+        double sec = (double)clip->samples / clip->rate;
+        totalUs += us; totalSec += sec; totalBytes += clip->bytes;
+        printf("clip %u: %5u samples, %5u bytes, %6.0f B/s flash, %6.1f us decode per second of audio (chk %08x)\n",
+               id, clip->samples, clip->bytes, clip->bytes / sec, us / sec, check);
+    }
+    printf("all    : %.2f s of audio in %u bytes, %.0f B/s flash (PCM16 32000), %.1f us/s decode\n",
+           totalSec, totalBytes, totalBytes / totalSec, totalUs / totalSec);
+    if (raw) fclose(raw);
+    return 0;
+}
@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+"""Encode WAV sound effects into TamaFi/sfx_assets.h (IMA-ADPCM, 4:1).
+
+    python3 tools/adpcm_encode.py -o TamaFi/sfx_assets.h \\
+        chirp=tools/sfx/chirp.wav growl=tools/sfx/growl.wav crack=tools/sfx/crack.wav
+
+Each input is mixed to mono, resampled (linear) to the I2S rate, peak
+normalised and encoded in WAV-style IMA-ADPCM blocks, which TamaFi/adpcm.cpp
+decodes while streaming from flash. Assets are emitted in argument order and
+must match SfxId in TamaFi/sfx.h. Prints flash use per second and the
+round-trip SNR of every clip.
+
+Standard library only.
+"""
+
+import argparse
+import math
+import os
+import struct
+import sys
+import wave
+
+RATE = 16000          # I2S_SAMPLE_RATE in sound_es8311.cpp
+BLOCK_ALIGN = 256     # bytes per ADPCM block
+
+STEP = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767,
+]
+INDEX_ADJ = [-1, -1, -1, -1, 2, 4, 6, 8]
+
+
+def read_wav(path):
+    """WAV -> (list of float mono samples in -1..1, rate)."""
+    with wave.open(path, "rb") as w:
+        ch, width, rate, n = w.getnchannels(), w.getsampwidth(), w.getframerate(), w.getnframes()
+        raw = w.readframes(n)
+    if width == 1:
+        vals = [(b - 128) / 128.0 for b in raw]
+    elif width == 2:
+        vals = [v / 32768.0 for v in struct.unpack("<%dh" % (len(raw) // 2), raw)]
+    elif width == 3:
+        vals = []
+        for i in range(0, len(raw), 3):
+            v = raw[i] | (raw[i + 1] << 8) | (raw[i + 2] << 16)
+            vals.append((v - (1 << 24) if v & 0x800000 else v) / 8388608.0)
+    else:
+        sys.exit("%s: %d-bit samples not supported" % (path, width * 8))
+    mono = [sum(vals[i:i + ch]) / ch for i in range(0, len(vals), ch)]
+    return mono, rate
+
+
+def resample(x, src, dst):
+    if src == dst or not x:
+        return x
+    n = int(len(x) * dst / src)
+    out = []
+    for i in range(n):
+        p = i * src / dst
+        k = int(p)
+        f = p - k
+        b = x[k + 1] if k + 1 < len(x) else x[k]
+        out.append(x[k] + (b - x[k]) * f)
+    return out
+
+
+def to_pcm16(x, peak_db):
+    peak = max((abs(v) for v in x), default=0.0)
+    gain = (10 ** (peak_db / 20.0)) / peak if peak > 0 else 1.0
+    return [max(-32768, min(32767, int(round(v * gain * 32767)))) for v in x]
+
+
+def encode_nibble(sample, pred, index):
+    step = STEP[index]
+    diff = sample - pred
+    nib = 0
+    if diff < 0:
+        nib = 8
+        diff = -diff
+    # Same reconstruction as the decoder, so encoder and device stay in step
+    vpdiff = step >> 3
+    if diff >= step:
+        nib |= 4
+        diff -= step
+        vpdiff += step
+    step >>= 1
+    if diff >= step:
+        nib |= 2
+        diff -= step
+        vpdiff += step
+    step >>= 1
+    if diff >= step:
+        nib |= 1
+        vpdiff += step
+    pred = pred - vpdiff if nib & 8 else pred + vpdiff
+    pred = max(-32768, min(32767, pred))
+    index = max(0, min(88, index + INDEX_ADJ[nib & 7]))
+    return nib, pred, index
+
+
+def encode(pcm):
+    """PCM16 list -> (ADPCM bytes, decoded PCM as the device will hear it)."""
+    per_block = 2 * (BLOCK_ALIGN - 4) + 1
+    out = bytearray()
+    decoded = []
+    index = 0
+    for b in range(0, len(pcm), per_block):
+        blk = pcm[b:b + per_block]
+        pred = blk[0]
+        out += struct.pack("<hBB", pred, index, 0)
+        decoded.append(pred)
+        nibs = []
+        for s in blk[1:]:
+            nib, pred, index = encode_nibble(s, pred, index)
+            nibs.append(nib)
+            decoded.append(pred)
+        if len(nibs) & 1:
+            nibs.append(0)
+        for i in range(0, len(nibs), 2):
+            out.append(nibs[i] | (nibs[i + 1] << 4))
+    return bytes(out), decoded
+
+
+def snr_db(ref, got):
+    sig = sum(v * v for v in ref)
+    err = sum((a - b) ** 2 for a, b in zip(ref, got))
+    return 10 * math.log10(sig / err) if err and sig else float("inf")
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("assets", nargs="+", help="name=path.wav")
+    ap.add_argument("-o", "--output", required=True, help="header to write")
+    ap.add_argument("--peak-db", type=float, default=-1.0, help="normalise peak to this dBFS")
+    args = ap.parse_args()
+
+    lines = [
+        "#pragma once",
+        "",
+        "// Generated by tools/adpcm_encode.py -- do not edit.",
+        "// IMA-ADPCM, %d Hz mono, %d-byte blocks. Order matches SfxId (sfx.h)." % (RATE, BLOCK_ALIGN),
+        "",
+        '#include "adpcm.h"',
+        "",
+    ]
+    table = []
+    total_bytes = total_samples = 0
+    for spec in args.assets:
+        if "=" not in spec:
+            sys.exit("asset must be name=path.wav: " + spec)
+        name, path = spec.split("=", 1)
+        x, rate = read_wav(path)
+        pcm = to_pcm16(resample(x, rate, RATE), args.peak_db)
+        data, decoded = encode(pcm)
+        total_bytes += len(data)
+        total_samples += len(pcm)
+
+        ident = "SFX_%s_ADPCM" % name.upper()
+        lines.append("// %s: %d samples (%.0f ms), %d bytes" % (os.path.basename(path), len(pcm), len(pcm) * 1000.0 / RATE, len(data)))
+        lines.append("static const uint8_t %s[%d] = {" % (ident, len(data)))
+        for i in range(0, len(data), 16):
+            lines.append("    " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+        lines.append("};")
+        lines.append("")
+        table.append("    { %s, %d, %d, %d, %d }," % (ident, len(data), len(pcm), BLOCK_ALIGN, RATE))
+        print("%-6s %6d samples %6d bytes  %5.0f B/s flash  SNR %.1f dB" %
+              (name, len(pcm), len(data), len(data) * RATE / max(len(pcm), 1), snr_db(pcm, decoded)))
+
+    lines.append("static const AdpcmClip SFX_ASSET_TABLE[] = {")
+    lines += table
+    lines.append("};")
+    lines.append("")
+    with open(args.output, "w") as f:
+        f.write("\n".join(lines))
+    print("total  %6d samples %6d bytes  %5.0f B/s flash (PCM16: %d B/s) -> %s" %
+          (total_samples, total_bytes, total_bytes * RATE / max(total_samples, 1), RATE * 2, args.output))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,154 @@
+// ============================================================
+// audio_ring_check — SPSC audio ring: threaded integrity + underrun margin
+//
+//   g++ -O2 -std=gnu++17 -pthread -I../TamaFi audio_ring_check.cpp ../TamaFi/audio_ring.cpp
+//       -o audio_ring_check
+//   ./audio_ring_check [samples]
+//
+// 1. Two preemptive threads push `samples` (default 2000000) counting
+//    samples through a 512-sample ring in random chunk sizes. The consumer
+//    checks that every sample follows the previous one and sometimes discards
+//    the ring as a stop does; after a discard the count may only jump forward.
+// 2. The render / i2s_out pair of sound_es8311.cpp is replayed in
+//    simulated time with the device sizes: the writer takes WRITE_CHUNK
+//    samples every 8 ms, the renderer refills in RENDER_BLOCK blocks after
+//    each chunk. The renderer is then stalled for 0..80 ms at every phase
+//    of the write cycle, and the worst-case underrun count (chunks of silence
+//    while a voice is playing) and minimum fill are printed per stall.
+// Exit code 1 on a sample mismatch, or if a stall shorter than the ring's
+// audio minus one chunk (24 ms) causes an underrun.
+// ============================================================
+
+#include "audio_ring.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+// sound_es8311.cpp
+#define I2S_SAMPLE_RATE     16000
+#define AUDIO_RING_SAMPLES  512
+#define RENDER_BLOCK        128
+#define WRITE_CHUNK         128
+
+static const uint32_t CHUNK_US = WRITE_CHUNK * 1000000ULL / I2S_SAMPLE_RATE;   // 8 ms
+
+// ---------- 1. threaded integrity ----------
+
+static bool threaded(uint32_t total) {
+    static int16_t storage[AUDIO_RING_SAMPLES];
+    static AudioRing r;
+    audioRingInit(r, storage, AUDIO_RING_SAMPLES);
+
+    std::atomic<bool> done(false);
+    std::thread producer([&] {
+        uint32_t rng = 7, next = 0;
+        int16_t  block[RENDER_BLOCK];
+        while (next < total) {
+            uint32_t n = 1 + (rng = rng * 1664525 + 1013904223) % RENDER_BLOCK;
+            if (n > total - next) n = total - next;
+            for (uint32_t i = 0; i < n; i++) block[i] = (int16_t)(next + i);
+            uint32_t put = audioRingWrite(r, block, n);
+            next += put;
+            if (put == 0) std::this_thread::yield();
+        }
+        done.store(true);
+    });
+
+    uint32_t rng = 99, got = 0, mismatches = 0, discards = 0;
+    int16_t  last = -1;
+    bool     afterDiscard = false;
+    int16_t  buf[WRITE_CHUNK];
+    for (;;) {
+        bool finished = done.load();
+        uint32_t n = audioRingRead(r, buf, 1 + (rng = rng * 1664525 + 1013904223) % WRITE_CHUNK);
+        for (uint32_t i = 0; i < n; i++) {
+            int16_t want = (int16_t)(last + 1);
+            bool ok = afterDiscard ? (int16_t)(buf[i] - last) > 0 : buf[i] == want;
+            if (!ok) mismatches++;
+            afterDiscard = false;
+            last = buf[i];
+        }
+        got += n;
+        if ((rng >> 8) % 5000 == 0) {
+            audioRingDiscard(r);
+            afterDiscard = true;
+            discards++;
+        }
+        if (n == 0) {
+            if (finished && audioRingFill(r) == 0) break;
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    printf("threaded: %u samples pushed, %u read, %u discards, %u mismatches\n",
+           total, got, discards, mismatches);
+    return mismatches == 0 && got > 0;
+}
+
+// ---------- 2. underrun margin ----------
+
+struct StallResult {
+    uint32_t underruns;
+    uint32_t minFill;
+};
+
+// Renderer blocked for stallUs starting phaseUs into a write cycle, after
+// ten cycles of steady playback.
+static StallResult stall(uint32_t stallUs, uint32_t phaseUs) {
+    static int16_t storage[AUDIO_RING_SAMPLES];
+    static AudioRing r;
+    audioRingInit(r, storage, AUDIO_RING_SAMPLES);
+
+    int16_t block[RENDER_BLOCK] = {};
+    int16_t chunk[WRITE_CHUNK];
+    auto render = [&] {
+        while (audioRingFree(r) >= RENDER_BLOCK) audioRingWrite(r, block, RENDER_BLOCK);
+    };
+
+    const uint64_t stallFrom = 10ULL * CHUNK_US + phaseUs;
+    const uint64_t stallTo   = stallFrom + stallUs;
+    StallResult res = { 0, AUDIO_RING_SAMPLES };
+    bool rendered = false;
+
+    render();
+    for (uint64_t t = CHUNK_US; t < stallTo + 8ULL * CHUNK_US; t += CHUNK_US) {
+        // Stall ends between two chunks: the renderer catches up right away
+        if (!rendered && t > stallTo) render();
+
+        uint32_t fill = audioRingFill(r);
+        if (fill < res.minFill) res.minFill = fill;
+        if (audioRingRead(r, chunk, WRITE_CHUNK) == 0) res.underruns++;
+
+        bool stalled = t >= stallFrom && t < stallTo;
+        rendered = !stalled;
+        if (!stalled) render();       // woken by the writer's notify
+    }
+    return res;
+}
+
+int main(int argc, char **argv) {
+    uint32_t total = (argc > 1) ? (uint32_t)strtoul(argv[1], nullptr, 10) : 2000000;
+    if (total == 0) total = 2000000;
+
+    bool ok = threaded(total);
+
+    const uint32_t ringUs = AUDIO_RING_SAMPLES * 1000000ULL / I2S_SAMPLE_RATE;
+    printf("\nring %u samples = %u ms, writer chunk %u ms\n", AUDIO_RING_SAMPLES, ringUs / 1000, CHUNK_US / 1000);
+    printf("  stall ms  worst underruns  min fill\n");
+    for (uint32_t ms = 0; ms <= 80; ms += 4) {
+        StallResult worst = { 0, AUDIO_RING_SAMPLES };
+        for (uint32_t phase = 0; phase < CHUNK_US; phase += 500) {
+            StallResult s = stall(ms * 1000, phase);
+            if (s.underruns > worst.underruns) worst.underruns = s.underruns;
+            if (s.minFill < worst.minFill)     worst.minFill   = s.minFill;
+        }
+        printf("  %8u  %15u  %8u\n", ms, worst.underruns, worst.minFill);
+        if (ms * 1000 < ringUs - CHUNK_US && worst.underruns) ok = false;
+    }
+
+    printf("%s\n", ok ? "ok" : "FAIL");
+    return ok ? 0 : 1;
+}
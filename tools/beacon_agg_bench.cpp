@@ -0,0 +1,143 @@
+// ============================================================
+// beacon_agg_bench — beacon ring + aggregator under synthetic air traffic
+//
+//   g++ -O2 -std=gnu++17 -I../TamaFi beacon_agg_bench.cpp ../TamaFi/beacon_agg.cpp
+//       -o beacon_agg_bench
+//   ./beacon_agg_bench [loopMs]
+//
+// Simulates the passive listener with the device settings
+// (BEACON_MAX_FRAMES_PER_SEC, BEACON_DECIMATION from device_config.h): APs
+// beaconing at ~10 Hz, the RX callback decimating and pushing into the SPSC
+// ring, loop() calling beaconAggProcess() every loopMs (default 10) and
+// beaconAggRefresh() once a second. For each air rate it prints frames
+// folded per second, ring drops and token-bucket hits over 60 s of
+// simulated time. Then it times push + process on this machine.
+// Exit code 1 if the fold rate exceeds the cap or frames are dropped while
+// the decimated rate is under the cap.
+// ============================================================
+
+#include "beacon_agg.h"
+#include "device_config.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+static const unsigned long SIM_MS    = 60000;
+static const unsigned long WINDOW_MS = 30000;   // wifi_sniffer.cpp AP_WINDOW_MS
+
+static void makeSample(uint32_t apIndex, uint32_t n, BeaconSample &s) {
+    uint32_t h = (apIndex + 1) * 2654435761u;
+    s.bssid[0] = (uint8_t)((h >> 24) & 0xFE);
+    s.bssid[1] = (uint8_t)(h >> 16);
+    s.bssid[2] = (uint8_t)(h >> 8);
+    s.bssid[3] = (uint8_t)h;
+    s.bssid[4] = (uint8_t)(apIndex >> 8);
+    s.bssid[5] = (uint8_t)apIndex;
+    s.rssi     = (int8_t)(-45 - (int)(h % 45) - (int)(n % 5));
+    s.channel  = (uint8_t)(1 + apIndex % 13);
+    s.flags    = (apIndex % 7 == 0) ? BEACON_FLAG_OPEN : 0;
+}
+
+struct RunResult {
+    double   foldedPerSec;
+    uint32_t afterDecimation;
+    uint32_t dropped;
+    uint32_t budgetHits;
+    uint16_t apCount;
+};
+
+// airRate beacons/s from airRate / 10 APs, in random order.
+static RunResult runRate(uint32_t airRate, unsigned long loopMs) {
+    static BeaconRing ring;
+    static BeaconAgg  agg;
+    beaconRingInit(ring);
+    beaconAggInit(agg, BEACON_MAX_FRAMES_PER_SEC, WINDOW_MS);
+
+    uint32_t aps      = airRate / 10 ? airRate / 10 : 1;
+    uint32_t rng      = 12345;
+    uint32_t decim    = 0;
+    uint32_t pushed   = 0;
+    uint64_t airSent  = 0;
+    unsigned long lastRefresh = 0;
+
+    for (unsigned long now = 0; now < SIM_MS; now += loopMs) {
+        // Beacons that arrived during this loop period (RX callback side)
+        uint64_t due = (uint64_t)airRate * (now + loopMs) / 1000;
+        for (; airSent < due; airSent++) {
+            if (++decim < BEACON_DECIMATION) continue;
+            decim = 0;
+            // Random AP per frame: a strict round robin would alias with the decimation
+            rng ^= rng << 13; rng ^= rng >> 17; rng ^= rng << 5;
+            BeaconSample s;
+            makeSample(rng % aps, (uint32_t)airSent, s);
+            beaconRingPush(ring, s);
+            pushed++;
+        }
+
+        beaconAggProcess(agg, ring, now);
+        if (now - lastRefresh >= 1000) {
+            lastRefresh = now;
+            beaconAggRefresh(agg, now);
+        }
+    }
+
+    RunResult r;
+    r.foldedPerSec    = agg.stats.framesProcessed * 1000.0 / SIM_MS;
+    r.afterDecimation = pushed;
+    r.dropped         = ring.dropped.load();
+    r.budgetHits      = agg.stats.budgetHits;
+    r.apCount         = agg.stats.apCount;
+    return r;
+}
+
+// Host cost of one frame through push + process (no budget in the way).
+static double nsPerFrame() {
+    static BeaconRing ring;
+    static BeaconAgg  agg;
+    beaconRingInit(ring);
+    beaconAggInit(agg, 0xFFFFFFFFu, WINDOW_MS);
+
+    const uint32_t FRAMES = 8000000;
+    BeaconSample s[40];
+    for (uint32_t i = 0; i < 40; i++) makeSample(i, i, s[i]);
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < FRAMES; i += BEACON_RING_SIZE / 2) {
+        for (uint32_t k = 0; k < BEACON_RING_SIZE / 2; k++) beaconRingPush(ring, s[(i + k) % 40]);
+        beaconAggProcess(agg, ring, 1 + i / 1000);
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+    if (agg.stats.framesProcessed != FRAMES) printf("  (bench folded %u of %u)\n", agg.stats.framesProcessed, FRAMES);
+    return ns / FRAMES;
+}
+
+int main(int argc, char **argv) {
+    unsigned long loopMs = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 10;
+    if (loopMs == 0) loopMs = 10;
+
+    printf("cap %d frames/s, decimation %d, ring %d, loop %lu ms, %lu s simulated\n\n",
+           BEACON_MAX_FRAMES_PER_SEC, BEACON_DECIMATION, BEACON_RING_SIZE, loopMs, SIM_MS / 1000);
+    printf("  air/s  APs  decimated/s  folded/s  dropped   drop%%  budget hits  APs tracked\n");
+
+    static const uint32_t RATES[] = { 100, 200, 400, 600, 800, 1000, 1500, 2000, 4000 };
+    bool ok = true;
+    for (uint32_t rate : RATES) {
+        RunResult r = runRate(rate, loopMs);
+        double decimPerSec = r.afterDecimation * 1000.0 / SIM_MS;
+        double dropPct     = r.afterDecimation ? 100.0 * r.dropped / r.afterDecimation : 0;
+        printf("  %5u  %3u  %11.0f  %8.1f  %7u  %5.1f%%  %11u  %11u\n",
+               rate, rate / 10, decimPerSec, r.foldedPerSec, r.dropped, dropPct,
+               r.budgetHits, r.apCount);
+
+        // Cap holds (one full bucket of slack at start-up)
+        double capSlack = BEACON_MAX_FRAMES_PER_SEC * (1.0 + 1000.0 / SIM_MS);
+        if (r.foldedPerSec > capSlack) ok = false;
+        // Under the cap nothing may be lost
+        if (decimPerSec < BEACON_MAX_FRAMES_PER_SEC * 0.9 && r.dropped > 0) ok = false;
+    }
+
+    printf("\nhost cost: %.1f ns/frame (push + fold, 40 APs)\n", nsPerFrame());
+    printf("%s\n", ok ? "ok" : "FAIL");
+    return ok ? 0 : 1;
+}
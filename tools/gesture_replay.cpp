@@ -0,0 +1,141 @@
+// ============================================================
+// gesture_replay — run the gesture recogniser over recorded touch traces
+//
+//   g++ -O2 -std=gnu++17 -I../TamaFi gesture_replay.cpp ../TamaFi/gesture.cpp
+//       -o gesture_replay
+//   python3 touch_traces.py /tmp/touch && ./gesture_replay /tmp/touch/*.csv
+//
+// Input: lines "touch,<ms>,<x>,<y>,<down>" (device serial with
+// INPUT_TOUCH_TRACE on, or touch_traces.py); anything else is ignored. Ticks
+// run every 5 ms between samples, like inputPoll(). Prints the gestures and
+// the mapped buttons, then the cost per sample (feed + tick). Exit code 1 if
+// a "# expect: type[:dir] ..." line does not match.
+// ============================================================
+
+#include "gesture.h"
+#include "device_config.h"   // LCD_H, CONTENT_H
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+static const uint32_t TICK_MS = 5;
+static const uint32_t TAIL_MS = 1000;   // ticks after the last sample
+
+struct Trace {
+    std::vector<TouchSample> samples;
+    std::string              expect;     // "" = no expectation line
+    bool                     hasExpect = false;
+};
+
+static bool load(const char *path, Trace &t) {
+    FILE *f = fopen(path, "r");
+    if (!f) return false;
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+        unsigned long ms;
+        int x, y, d;
+        if (strncmp(line, "# expect:", 9) == 0) {
+            t.expect = line + 9;
+            while (!t.expect.empty() && (t.expect.back() == '\n' || t.expect.back() == ' ')) t.expect.pop_back();
+            while (!t.expect.empty() && t.expect[0] == ' ') t.expect.erase(0, 1);
+            t.hasExpect = true;
+        } else if (const char *p = strstr(line, "touch,")) {
+            if (sscanf(p, "touch,%lu,%d,%d,%d", &ms, &x, &y, &d) == 4)
+                t.samples.push_back({ (uint32_t)ms, (int16_t)x, (int16_t)y, d != 0 });
+        }
+    }
+    fclose(f);
+    return true;
+}
+
+static void describe(const Gesture &g, std::string &out) {
+    if (!out.empty()) out += ' ';
+    out += gestureName(g.type);
+    if (g.dir) { out += ':'; out += gestureDirName(g.dir); }
+}
+
+// Replays one trace; returns gestures as "type[:dir] ..."
+static std::string run(const Trace &t, bool print) {
+    GestureEngine g;
+    gestureInit(g, gestureDefaultConfig(0, CONTENT_H));
+    Gesture out[GESTURE_MAX_OUT];
+    std::string got;
+
+    auto emit = [&](int n) {
+        for (int i = 0; i < n; i++) {
+            describe(out[i], got);
+            if (!print) continue;
+            InputButton b = gestureButton(out[i]);
+            printf("  %6lu ms  %-10s %-5s at %3d,%3d  d %4d,%4d  %5u px/s  -> button %d\n",
+                   (unsigned long)out[i].tMs, gestureName(out[i].type), gestureDirName(out[i].dir),
+                   out[i].x, out[i].y, out[i].dx, out[i].dy, out[i].speed, (int)b);
+        }
+    };
+
+    if (t.samples.empty()) return got;
+    uint32_t now = t.samples[0].tMs;
+    for (const TouchSample &s : t.samples) {
+        for (; now + TICK_MS < s.tMs; now += TICK_MS) emit(gestureTick(g, now, out));
+        now = s.tMs;
+        emit(gestureFeed(g, s, out));
+        emit(gestureTick(g, now, out));
+    }
+    for (uint32_t end = now + TAIL_MS; now < end; now += TICK_MS) emit(gestureTick(g, now, out));
+    return got;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s trace.csv...\n", argv[0]);
+        return 2;
+    }
+    int failed = 0;
+    size_t samples = 0;
+    std::vector<Trace> traces;
+    for (int i = 1; i < argc; i++) {
+        Trace t;
+        if (!load(argv[i], t)) { fprintf(stderr, "%s: cannot read\n", argv[i]); return 2; }
+        printf("%s (%zu samples)\n", argv[i], t.samples.size());
+        std::string got = run(t, true);
+        if (t.hasExpect && got != t.expect) {
+            printf("  FAIL: got [%s], expected [%s]\n", got.c_str(), t.expect.c_str());
+            failed++;
+        }
+        samples += t.samples.size();
+        traces.push_back(t);
+    }
+
+    // Cost: whole traces replayed repeatedly, feed + the ticks between samples
+    const int reps = 20000;
+    size_t sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < reps; r++)
+        for (const Trace &t : traces) sink += run(t, false).size();
+    double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    printf("%zu samples x %d: %.1f ns per sample (incl. ticks and string building)\n",
+           samples, reps, sec * 1e9 / ((double)samples * reps));
+
+    // Recogniser alone: feed only, no output formatting
+    GestureEngine g;
+    Gesture out[GESTURE_MAX_OUT];
+    size_t fed = 0;
+    t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < reps; r++) {
+        for (const Trace &t : traces) {
+            gestureInit(g, gestureDefaultConfig(0, CONTENT_H));
+            for (const TouchSample &s : t.samples) {
+                sink += (size_t)gestureFeed(g, s, out);
+                sink += (size_t)gestureTick(g, s.tMs, out);
+                fed++;
+            }
+        }
+    }
+    sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    printf("feed + tick: %.1f ns per sample (%zu)\n", sec * 1e9 / (double)fed, sink % 10);
+
+    printf(failed ? "%d trace(s) FAILED\n" : "all traces match\n", failed);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,116 @@
+// ============================================================
+// governor_sim — CPU governor against synthetic frame loads
+//
+//   g++ -O2 -std=gnu++17 -I../TamaFi governor_sim.cpp ../TamaFi/cpu_governor.cpp
+//       -o governor_sim
+//   ./governor_sim
+//
+// Runs governorStep() once per frame like loop() does, from 240 MHz at
+// boot. Frame time is modelled as CPU work that scales with 1 / clock plus a
+// fixed SPI flush part that does not. Each scenario runs for 20 s:
+//   static light / heavy, animated light / heavy, an input burst, display
+//   sleep, two loads that alternate frame by frame across the up and down
+//   thresholds, and heavy / light bursts shorter than the down hold.
+// Per scenario it prints the level it settles on, residency per clock and
+// the number of switches. Exit code 1 if a scenario settles on the wrong
+// clock or switches more than once in its second half (ping-pong).
+// ============================================================
+
+#include "cpu_governor.h"
+
+#include <cstdio>
+
+struct Scenario {
+    const char *name;
+    bool        animated;
+    bool        scanning;
+    bool        asleep;
+    uint32_t    cpuUs240;      // CPU part of a frame at 240 MHz
+    uint32_t    cpuUs240Alt;   // alternate load (0 = same as cpuUs240)
+    uint32_t    altMs;         // switch load every altMs, 0 = every other frame
+    uint32_t    flushUs;       // SPI part, independent of the clock
+    unsigned long inputUntil;  // input on every frame until this time
+    uint16_t    wantMhz;       // level it must settle on
+};
+
+static const unsigned long RUN_MS = 20000;
+
+static const Scenario SCENARIOS[] = {
+    // name                anim   scan   sleep  cpu    alt    altMs  flush  input  want
+    { "static light",      false, false, false,  3000,     0,     0, 4000,     0,  80 },
+    { "static heavy",      false, false, false, 24000,     0,     0, 6000,     0, 160 },
+    { "static + scan",     false, true,  false,  3000,     0,     0, 4000,     0, 160 },
+    { "animated light",    true,  false, false,  2000,     0,     0, 6000,     0, 160 },
+    { "animated heavy",    true,  false, false, 11000,     0,     0, 8000,     0, 240 },
+    { "input burst",       false, false, false,  3000,     0,     0, 4000,  5000,  80 },
+    { "display asleep",    false, false, true,   3000,     0,     0, 4000,     0,  80 },
+    // 78 % / 82 % of the budget at 160 MHz, frame by frame
+    { "around up edge",    true,  false, false, 11800, 12700,     0, 8000,     0, 240 },
+    // would be 50 % / 60 % at 160 MHz, frame by frame
+    { "around down edge",  true,  false, false,  5600,  7900,     0, 8000,     0, 240 },
+    // heavy and light for 1 s each, shorter than GOV_DOWN_HOLD_MS
+    { "1 s bursts",        true,  false, false, 13000,  2000,  1000, 8000,     0, 240 },
+};
+
+static uint32_t frameUs(uint32_t cpuUs240, uint32_t flushUs, uint16_t mhz) {
+    return cpuUs240 * 240 / mhz + flushUs;
+}
+
+static bool run(const Scenario &s) {
+    Governor g;
+    governorInit(g, GOV_LEVELS - 1, 0);
+
+    uint32_t      lastFrameUs    = 0;
+    uint32_t      switchesLate   = 0;
+    uint32_t      peakDuringInput = 0;
+    unsigned long now = 0;
+    bool          odd = false;
+
+    while (now < RUN_MS) {
+        GovernorInputs in;
+        in.asleep   = s.asleep;
+        in.animated = s.animated;
+        in.scanning = s.scanning;
+        in.input    = now < s.inputUntil;
+        in.frameUs  = s.asleep ? 0 : lastFrameUs;
+
+        uint32_t before = g.switches;
+        uint8_t  level  = governorStep(g, in, now);
+        if (now >= RUN_MS / 2) switchesLate += g.switches - before;
+        if (in.input && GOV_MHZ[level] > peakDuringInput) peakDuringInput = GOV_MHZ[level];
+
+        bool alt = s.altMs ? ((now / s.altMs) & 1) != 0 : odd;
+        uint32_t cpu = (alt && s.cpuUs240Alt) ? s.cpuUs240Alt : s.cpuUs240;
+        odd = !odd;
+        lastFrameUs = frameUs(cpu, s.flushUs, GOV_MHZ[level]);
+
+        // Next frame after the render or the frame period, whichever is later
+        uint32_t periodUs = s.asleep ? 200000 : s.animated ? GOV_BUDGET_ANIM_US : GOV_BUDGET_STATIC_US;
+        now += (lastFrameUs > periodUs ? lastFrameUs : periodUs) / 1000;
+    }
+
+    uint32_t res[GOV_LEVELS], switches;
+    uint16_t settled = GOV_MHZ[g.level];
+    uint32_t totalSwitches = g.switches;
+    governorTakeResidency(g, res, switches);
+
+    bool ok = settled == s.wantMhz && switchesLate <= 1;
+    if (s.inputUntil && peakDuringInput != GOV_MHZ[GOV_LEVELS - 1]) ok = false;
+
+    printf("  %-17s %3u MHz  %5.1f%% %5.1f%% %5.1f%%  %3u  %3u  %s\n",
+           s.name, settled,
+           100.0 * res[0] / RUN_MS, 100.0 * res[1] / RUN_MS, 100.0 * res[2] / RUN_MS,
+           totalSwitches, switchesLate, ok ? "ok" : "FAIL");
+    return ok;
+}
+
+int main() {
+    printf("  scenario          settled   @80    @160   @240  sw  late\n");
+
+    int failed = 0;
+    for (const Scenario &s : SCENARIOS) {
+        if (!run(s)) failed++;
+    }
+    printf("%s\n", failed ? "FAIL" : "ok");
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,147 @@
+// ============================================================
+// journal_torn_write — cut journal writes at every byte and reload
+//
+//   g++ -O2 -std=gnu++17 -I../TamaFi journal_torn_write.cpp ../TamaFi/save_journal.cpp
+//       ../TamaFi/save_blob.cpp -o journal_torn_write
+//   ./journal_torn_write
+//
+// An in-memory SaveStore whose next write can be torn after N bytes. For a
+// chain of saves, each save is cut at every N from 0 to the full image, in
+// three tear models:
+//   - truncated: the slot holds only the first N bytes
+//   - in place:  first N new bytes over the old slot contents
+//   - erased:    first N new bytes, rest of the image reads 0xFF
+// After each tear the journal is reloaded from the store (reboot). The
+// payload must be exactly the previous save, or the new one when nothing was
+// cut; never garbage or nothing. A full save afterwards must then load too.
+// Exit code 1 on the first failure.
+// ============================================================
+
+#include "save_journal.h"
+#include "save_blob.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+enum TearMode { TEAR_TRUNCATE, TEAR_IN_PLACE, TEAR_ERASED };
+static const char *MODE_NAMES[] = { "truncated", "in place", "erased" };
+
+class MemSaveStore : public SaveStore {
+public:
+    size_t read(uint8_t slot, void *buf, size_t cap) override {
+        const std::vector<uint8_t> &s = _slot[slot];
+        if (s.empty() || s.size() > cap) return 0;
+        memcpy(buf, s.data(), s.size());
+        return s.size();
+    }
+
+    bool write(uint8_t slot, const void *buf, size_t len) override {
+        const uint8_t *p = (const uint8_t*)buf;
+        if (_tearAt < 0 || (size_t)_tearAt >= len) {
+            _slot[slot].assign(p, p + len);
+            return true;
+        }
+
+        size_t n = (size_t)_tearAt;
+        std::vector<uint8_t> &s = _slot[slot];
+        switch (_mode) {
+            case TEAR_TRUNCATE:
+                s.assign(p, p + n);
+                break;
+            case TEAR_IN_PLACE:
+                if (s.size() < n) s.resize(n);
+                memcpy(s.data(), p, n);
+                break;
+            case TEAR_ERASED:
+                s.assign(len, 0xFF);
+                memcpy(s.data(), p, n);
+                break;
+        }
+        _tearAt = -1;
+        return false;    // power went away mid-write
+    }
+
+    void tearNextWrite(int atByte, TearMode mode) { _tearAt = atByte; _mode = mode; }
+
+private:
+    std::vector<uint8_t> _slot[JOURNAL_SLOTS];
+    int                  _tearAt = -1;
+    TearMode             _mode   = TEAR_TRUNCATE;
+};
+
+static const size_t PAYLOAD = sizeof(SaveBlob);
+
+// Distinct, non-trivial payload per save number.
+static void makePayload(uint32_t n, uint8_t *out) {
+    uint32_t x = n * 2654435761u + 1;
+    for (size_t i = 0; i < PAYLOAD; i++) {
+        x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+        out[i] = (uint8_t)x;
+    }
+}
+
+static bool loadIs(MemSaveStore &store, uint32_t want) {
+    SaveJournal j;
+    journalInit(j, &store);
+    uint8_t got[JOURNAL_MAX_PAYLOAD], exp[PAYLOAD];
+    size_t  len = journalLoad(j, got, sizeof(got));
+    makePayload(want, exp);
+    return len == PAYLOAD && memcmp(got, exp, PAYLOAD) == 0;
+}
+
+// Saves 1..prev complete, then save prev+1 torn at atByte.
+static bool runCase(uint32_t prev, int atByte, TearMode mode) {
+    MemSaveStore store;
+    SaveJournal  j;
+    journalInit(j, &store);
+
+    uint8_t p[PAYLOAD];
+    for (uint32_t n = 1; n <= prev; n++) {
+        makePayload(n, p);
+        if (!journalWrite(j, p, PAYLOAD)) return false;
+    }
+
+    store.tearNextWrite(atByte, mode);
+    makePayload(prev + 1, p);
+    bool wrote = journalWrite(j, p, PAYLOAD);
+
+    // Reboot: whatever is on "flash" must be one of the two saves
+    uint32_t want = wrote ? prev + 1 : prev;
+    if (!loadIs(store, want)) {
+        printf("FAIL: %s tear at byte %d of save %u: load is not save %u\n",
+               MODE_NAMES[mode], atByte, prev + 1, want);
+        return false;
+    }
+
+    // The next save after the reboot goes through and wins
+    journalInit(j, &store);
+    uint8_t scratch[JOURNAL_MAX_PAYLOAD];
+    journalLoad(j, scratch, sizeof(scratch));
+    makePayload(prev + 2, p);
+    if (!journalWrite(j, p, PAYLOAD) || !loadIs(store, prev + 2)) {
+        printf("FAIL: %s tear at byte %d of save %u: next save lost\n",
+               MODE_NAMES[mode], atByte, prev + 1);
+        return false;
+    }
+    return true;
+}
+
+int main() {
+    const int image = (int)(sizeof(JournalHeader) + PAYLOAD);
+    int cases = 0;
+
+    // prev = 1..4 covers both target slots and a slot being rewritten over an older image
+    for (int mode = TEAR_TRUNCATE; mode <= TEAR_ERASED; mode++) {
+        for (uint32_t prev = 1; prev <= 4; prev++) {
+            for (int at = 0; at <= image; at++) {
+                if (!runCase(prev, at, (TearMode)mode)) return 1;
+                cases++;
+            }
+        }
+    }
+
+    printf("%d torn writes (%d-byte image, 3 tear models): load always old or new save\n",
+           cases, image);
+    return 0;
+}
@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+"""Write microphone test fixtures for sound_detect (16 kHz mono WAV).
+
+    python3 tools/mic_fixtures.py /tmp/mic
+    ./sound_detect_run /tmp/mic/*.wav
+
+Every fixture sits on a -55 dBFS noise bed. The expected detections are in
+the file name: clap_x3 -> 3 claps, quiet_speech_x0 -> nothing.
+Replace or extend with real recordings (same rate) when available.
+"""
+
+import math
+import os
+import random
+import struct
+import sys
+import wave
+
+RATE = 16000
+rnd = random.Random(3)
+
+
+def bed(seconds, db=-55):
+    a = 10 ** (db / 20)
+    return [a * (rnd.random() * 2 - 1) for _ in range(int(seconds * RATE))]
+
+
+def add(x, at, y):
+    k = int(at * RATE)
+    for i, v in enumerate(y):
+        if k + i < len(x):
+            x[k + i] += v
+
+
+def clap(db=-8):
+    a, out, lp = 10 ** (db / 20), [], 0.0
+    for i in range(int(0.05 * RATE)):
+        lp += 0.7 * ((rnd.random() * 2 - 1) - lp)
+        out.append(a * lp * 1.4 * math.exp(-i / (0.006 * RATE)))
+    return out
+
+
+def whistle(f0, f1, seconds, db=-20, vib=0.0):
+    a, out, ph = 10 ** (db / 20), [], 0.0
+    n = int(seconds * RATE)
+    for i in range(n):
+        t = i / n
+        f = f0 + (f1 - f0) * t + vib * math.sin(2 * math.pi * 5 * i / RATE)
+        ph += 2 * math.pi * f / RATE
+        env = min(1.0, i / 400, (n - i) / 400)
+        out.append(a * env * (math.sin(ph) + 0.03 * (rnd.random() * 2 - 1)))
+    return out
+
+
+def noise(seconds, db):
+    a, out, lp = 10 ** (db / 20), [], 0.0
+    for _ in range(int(seconds * RATE)):
+        lp += 0.3 * ((rnd.random() * 2 - 1) - lp)
+        out.append(a * lp * 2.2)
+    return out
+
+
+def speech(seconds, db=-22):
+    """Voiced syllables: 110-220 Hz harmonic stacks, 4 Hz syllable rhythm."""
+    a, out, ph = 10 ** (db / 20), [], 0.0
+    for i in range(int(seconds * RATE)):
+        t = i / RATE
+        f = 150 + 50 * math.sin(2 * math.pi * 0.7 * t)
+        ph += 2 * math.pi * f / RATE
+        s = sum(math.sin(h * ph) / h ** 1.2 for h in range(1, 20) if h * f < 3800)
+        syl = max(0.0, math.sin(2 * math.pi * 4 * t)) ** 0.5
+        out.append(a * 0.5 * syl * s)
+    return out
+
+
+def write(path, x):
+    with wave.open(path, "wb") as w:
+        w.setnchannels(1)
+        w.setsampwidth(2)
+        w.setframerate(RATE)
+        w.writeframes(b"".join(struct.pack("<h", int(max(-1, min(1, v)) * 32767)) for v in x))
+    print("wrote", path)
+
+
+def main():
+    outdir = sys.argv[1] if len(sys.argv) > 1 else "mic_fixtures"
+    os.makedirs(outdir, exist_ok=True)
+
+    x = bed(4)
+    for at in (0.5, 1.7, 2.9):
+        add(x, at, clap())
+    write(os.path.join(outdir, "clap_x3.wav"), x)
+
+    x = bed(4)
+    add(x, 0.4, whistle(1800, 2300, 0.6))
+    add(x, 2.2, whistle(2600, 2600, 0.8, db=-30, vib=40))
+    write(os.path.join(outdir, "whistle_x2.wav"), x)
+
+    x = bed(3)
+    add(x, 0.8, noise(1.0, -6))
+    write(os.path.join(outdir, "loud_x1.wav"), x)
+
+    x = bed(5)
+    add(x, 0.5, speech(4))
+    write(os.path.join(outdir, "quiet_speech_x0.wav"), x)
+
+    write(os.path.join(outdir, "silence_x0.wav"), bed(3))
+
+
+if __name__ == "__main__":
+    main()
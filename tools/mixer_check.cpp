@@ -0,0 +1,180 @@
+// ============================================================
+// mixer_check — voice stealing, saturation and mixAddSat16 throughput
+//
+//   g++ -O2 -std=gnu++17 -I../TamaFi mixer_check.cpp ../TamaFi/mixer.cpp
+//       ../TamaFi/synth.cpp ../TamaFi/adpcm.cpp -o mixer_check
+//   ./mixer_check
+//
+// Checks:
+//   - allocation: free voices first, then the lowest priority and oldest
+//     voice is stolen; a sound is dropped when every voice outranks it;
+//     steals / drops are counted
+//   - saturation: four in-phase full-scale voices, and random data through
+//     mixAddSat16 at every length 0..130, must equal the int32 sum clamped
+//     to [-32768, 32767], so nothing wraps
+// Then it times mixAddSat16 on 128-sample blocks against the same clamp
+// built without vectorisation, and mixerRender() with four voices.
+// Exit code 1 on any mismatch.
+// ============================================================
+
+#include "mixer.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+static const uint32_t RATE = 16000;
+static int failures = 0;
+
+static void expect(bool cond, const char *what) {
+    printf("  %-58s %s\n", what, cond ? "ok" : "FAIL");
+    if (!cond) failures++;
+}
+
+static void checkAllocation() {
+    printf("allocation\n");
+    Mixer m;
+    mixerInit(m, RATE, 8000);
+
+    int a = mixerPlayTone(m, MIX_PRIO_EVENT,   500, 1000);
+    int b = mixerPlayTone(m, MIX_PRIO_UI,      600, 1000);
+    int c = mixerPlayTone(m, MIX_PRIO_UI,      700, 1000);
+    int d = mixerPlayTone(m, MIX_PRIO_AMBIENT, 800, 1000);
+    expect(a == 0 && b == 1 && c == 2 && d == 3 && m.steals == 0, "four sounds take the four free voices");
+
+    int e = mixerPlayTone(m, MIX_PRIO_UI, 900, 1000);
+    expect(e == d && m.steals == 1, "next UI sound steals the ambient voice");
+
+    int f = mixerPlayTone(m, MIX_PRIO_UI, 1000, 1000);
+    expect(f == b, "then the oldest UI voice");
+
+    int g = mixerPlayTone(m, MIX_PRIO_ALERT, 1100, 1000);
+    expect(g == c, "an alert takes the remaining oldest UI voice");
+
+    mixerPlayTone(m, MIX_PRIO_ALERT, 1200, 1000);
+    mixerPlayTone(m, MIX_PRIO_ALERT, 1300, 1000);
+    mixerPlayTone(m, MIX_PRIO_ALERT, 1400, 1000);
+    uint32_t drops = m.drops;
+    int h = mixerPlayTone(m, MIX_PRIO_UI, 1500, 1000);
+    expect(h < 0 && m.drops == drops + 1, "UI sound is dropped when all voices are alerts");
+    expect(mixerActiveVoices(m) == MIX_VOICES, "all voices still playing");
+
+    // Run everything out: voices free up again
+    int16_t buf[MIX_BLOCK_MAX];
+    while (mixerRender(m, buf, MIX_BLOCK_MAX) > 0) {}
+    expect(mixerPlayTone(m, MIX_PRIO_AMBIENT, 500, 10) >= 0 && mixerActiveVoices(m) == 1,
+           "finished voices are free for any priority");
+}
+
+static void clampRef(int16_t *acc, const int16_t *src, int n) {
+    for (int i = 0; i < n; i++) {
+        int32_t s = (int32_t)acc[i] + src[i];
+        acc[i] = (int16_t)(s > 32767 ? 32767 : s < -32768 ? -32768 : s);
+    }
+}
+
+static void checkSaturation() {
+    printf("saturation\n");
+
+    // Four identical full-scale voices vs. one voice summed by hand
+    Mixer four, one;
+    mixerInit(four, RATE, 32767);
+    mixerInit(one,  RATE, 32767);
+    for (int i = 0; i < MIX_VOICES; i++) mixerPlayTone(four, MIX_PRIO_EVENT, 800, 200);
+    mixerPlayTone(one, MIX_PRIO_EVENT, 800, 200);
+
+    alignas(16) int16_t mixed[MIX_BLOCK_MAX], single[MIX_BLOCK_MAX];
+    long clipped = 0, wrong = 0, total = 0;
+    int16_t lo = 0, hi = 0;
+    while (mixerRender(four, mixed, MIX_BLOCK_MAX) > 0) {
+        mixerRender(one, single, MIX_BLOCK_MAX);
+        for (int i = 0; i < MIX_BLOCK_MAX; i++) {
+            int32_t s = (int32_t)single[i] * MIX_VOICES;
+            int32_t want = s > 32767 ? 32767 : s < -32768 ? -32768 : s;
+            if (mixed[i] != want) wrong++;
+            if (want != s) clipped++;
+            if (mixed[i] < lo) lo = mixed[i];
+            if (mixed[i] > hi) hi = mixed[i];
+            total++;
+        }
+    }
+    printf("  4 x full scale: %ld samples, %ld clipped, range [%d, %d]\n", total, clipped, lo, hi);
+    expect(wrong == 0 && clipped > 0 && lo == -32768 && hi == 32767, "four full-scale voices clamp, never wrap");
+
+    uint32_t x = 1;
+    alignas(16) int16_t acc[136], src[136], ref[136];
+    wrong = 0;
+    for (int n = 0; n <= 130; n++) {
+        for (int rep = 0; rep < 200; rep++) {
+            for (int i = 0; i < n; i++) {
+                x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+                acc[i] = (int16_t)x;
+                src[i] = (int16_t)(x >> 16);
+            }
+            memcpy(ref, acc, sizeof(acc));
+            clampRef(ref, src, n);
+            mixAddSat16(acc, src, n);
+            if (memcmp(acc, ref, (size_t)n * sizeof(int16_t)) != 0) wrong++;
+        }
+    }
+    expect(wrong == 0, "mixAddSat16 == int32 clamp, random data, n = 0..130");
+}
+
+// Same clamp, kept scalar so the timing shows what vectorising buys
+__attribute__((optimize("no-tree-vectorize")))
+static void addSatScalar(int16_t *__restrict acc, const int16_t *__restrict src, int n) {
+    for (int i = 0; i < n; i++) {
+        int32_t s = (int32_t)acc[i] + (int32_t)src[i];
+        s = s > 32767 ? 32767 : s;
+        s = s < -32768 ? -32768 : s;
+        acc[i] = (int16_t)s;
+    }
+}
+
+template <typename F>
+static double nsPerSample(F add) {
+    alignas(16) static int16_t acc[MIX_BLOCK_MAX], src[MIX_BLOCK_MAX];
+    for (int i = 0; i < MIX_BLOCK_MAX; i++) src[i] = (int16_t)(i * 517);
+
+    const int REPS = 2000000;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < REPS; r++) {
+        add(acc, src, MIX_BLOCK_MAX);
+        asm volatile("" : : "r"(acc) : "memory");
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+    return ns / ((double)REPS * MIX_BLOCK_MAX);
+}
+
+static void bench() {
+    printf("host timing (%d-sample blocks)\n", MIX_BLOCK_MAX);
+    double vec = nsPerSample(mixAddSat16);
+    double sca = nsPerSample(addSatScalar);
+    printf("  mixAddSat16 %.2f ns/sample, scalar clamp %.2f ns/sample (%.1fx)\n", vec, sca, sca / vec);
+
+    Mixer m;
+    mixerInit(m, RATE, 8000);
+    alignas(16) int16_t out[MIX_BLOCK_MAX];
+    const long SAMPLES = 16000L * 600;
+    long done = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    while (done < SAMPLES) {
+        if (mixerActiveVoices(m) < MIX_VOICES) {
+            for (int i = mixerActiveVoices(m); i < MIX_VOICES; i++)
+                mixerPlayTone(m, MIX_PRIO_EVENT, 400 + 200 * (uint32_t)i, 60000);
+        }
+        done += mixerRender(m, out, MIX_BLOCK_MAX);
+        asm volatile("" : : "r"(out) : "memory");
+    }
+    double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    printf("  mixerRender, 4 voices: %.1f Msamples/s (%.0fx real time at 16 kHz)\n",
+           done / s / 1e6, done / s / RATE);
+}
+
+int main() {
+    checkAllocation();
+    checkSaturation();
+    bench();
+    printf("%s\n", failures ? "FAIL" : "ok");
+    return failures ? 1 : 0;
+}
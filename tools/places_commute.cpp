@@ -0,0 +1,243 @@
+// ============================================================
+// places_commute — place recognition over the synthetic commute scenario
+//
+//   g++ -O2 -std=gnu++17 -I../TamaFi places_commute.cpp ../TamaFi/wifi_ingest.cpp
+//       ../TamaFi/wifi_env.cpp ../TamaFi/wifi_places.cpp ../TamaFi/wifi_scan_source.cpp
+//       -o places_commute
+//   ./places_commute [days]
+//
+// Runs WifiScanSynth(SYNTH_COMMUTE) through wifiIngestScan for several seeds.
+// Every "day" is home -> street -> office -> office -> street -> home, 10
+// scans per leg. Checks per seed:
+//   - home scans land on one place (at most 1 + 2% strays: a scan that sees
+//     only a few of the APs may not match anything), same for office
+//   - home and office are different places
+//   - no street scan matches home or office
+//   - every stored place is found again from its own signature (LSH index
+//     keeps places whose bands collide)
+//   - "dirty" counts scans that marked the DB for an immediate save. Only a
+//     new, evicted or merged place or a home move may do that; a plain
+//     revisit must not. (Home and office get equal scans per day here, so
+//     "home" moves between them twice a day.)
+// Then it prints placeDbMatch() time per trace scan (matched / not matched)
+// and the time of an unmatched lookup as the table fills up to PLACE_MAX,
+// and checks placeDbMatch() against a full pass over the stored places for
+// scans sharing 0..PLACE_SIG_LEN slots with each of them.
+// Exit code 1 if any check fails; timing only prints.
+// ============================================================
+
+#include "wifi_ingest.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+enum Leg { LEG_HOME, LEG_STREET, LEG_OFFICE };
+
+static const int  SCANS_PER_LEG = 10;
+static const Leg  LEGS[6] = { LEG_HOME, LEG_STREET, LEG_OFFICE, LEG_OFFICE, LEG_STREET, LEG_HOME };
+static const char *LEG_NAMES[] = { "home", "street", "office" };
+
+// placeDbMatch() time per trace scan, split by outcome
+static std::vector<double> matchNsHit, matchNsMiss;
+
+static double timeMatch(const PlaceDb &db, const PlaceSignature &sig, int &id) {
+    const int REPS = 200;    // one call is below the clock resolution
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < REPS; r++) {
+        id = placeDbMatch(db, sig);
+        asm volatile("" : : "r"(id) : "memory");
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / REPS;
+}
+
+static PlaceSignature sigOf(WifiScanSource &src, int n) {
+    PlaceSignature sig;
+    placeSigBegin(sig);
+    for (int k = 0; k < n; k++) {
+        WifiScanRecord rec;
+        if (src.get(k, rec)) placeSigAdd(sig, rec.bssid);
+    }
+    return sig;
+}
+
+static bool runSeed(uint32_t seed, int days) {
+    WifiScanSynth synth(SYNTH_COMMUTE, seed, 2000);
+
+    static WifiEnvModel env;
+    static PlaceDb      places;
+    WifiStats       stats;
+    PlaceMatch      place = { PLACE_UNKNOWN, -1, 0 };
+    WifiNetworkInfo list[MAX_WIFI_LIST];
+    int             listCount = 0;
+    wifiEnvInit(env);
+    placeDbInit(places);
+    WifiScanSink sink = { env, places, stats, place, list, listCount };
+
+    int  placeOf[3]  = { -1, -1, -1 };   // first id seen per leg (home / office)
+    int  miss[3]     = { 0, 0, 0 };      // scans not on that id
+    int  total[3]    = { 0, 0, 0 };
+    int  streetHits  = 0;
+    int  dirty[3]    = { 0, 0, 0 };      // scans that would trigger a places save
+    int  homeMoves   = 0;
+    int  visitWrites = 0;                // dirty without a new place or a home move
+    unsigned long now = 0;
+
+    for (int i = 0; i < days * 6 * SCANS_PER_LEG; i++) {
+        Leg leg = LEGS[(i / SCANS_PER_LEG) % 6];
+
+        synth.start(now);
+        now += 2000;
+        int n = synth.poll(now);
+        if (n < 0) { printf("seed %u: scan %d failed\n", seed, i); return false; }
+        PlaceSignature scanSig = sigOf(synth, n);
+        if (scanSig.nets >= PLACE_MIN_NETS) {
+            int    id;
+            double ns = timeMatch(places, scanSig, id);
+            (id >= 0 ? matchNsHit : matchNsMiss).push_back(ns);
+        }
+        int homeBefore  = placeDbHome(places);
+        int countBefore = places.count;
+        wifiIngestScan(synth, n, sink);
+        synth.release();
+        now += 28000;
+        total[leg]++;
+        bool moved = placeDbHome(places) != homeBefore;
+        homeMoves += moved;
+        if (places.dirty) {
+            dirty[leg]++;
+            bool merged = places.count < countBefore;
+            if (!moved && !merged && place.kind != PLACE_NEW) visitWrites++;
+            places.dirty = false;
+        }
+
+        if (leg == LEG_STREET) continue;
+        if (placeOf[leg] < 0) { placeOf[leg] = place.id; continue; }
+        if (place.id != placeOf[leg]) miss[leg]++;
+    }
+
+    // Street is judged against the final home / office ids
+    WifiScanSynth again(SYNTH_COMMUTE, seed, 2000);
+    for (int i = 0; i < days * 6 * SCANS_PER_LEG; i++) {
+        again.start(0);
+        int n = again.poll(2000);
+        if (LEGS[(i / SCANS_PER_LEG) % 6] == LEG_STREET) {
+            int id = placeDbMatch(places, sigOf(again, n));
+            if (id >= 0 && (id == placeOf[LEG_HOME] || id == placeOf[LEG_OFFICE])) streetHits++;
+        }
+        again.release();
+    }
+
+    int lost = 0;
+    for (int i = 0; i < PLACE_MAX; i++) {
+        if (places.places[i].used && placeDbMatch(places, places.places[i].sig) != i) lost++;
+    }
+
+    bool ok = placeOf[LEG_HOME] >= 0 && placeOf[LEG_OFFICE] >= 0 &&
+              placeOf[LEG_HOME] != placeOf[LEG_OFFICE] &&
+              miss[LEG_HOME] <= 1 + total[LEG_HOME] / 50 &&
+              miss[LEG_OFFICE] <= 1 + total[LEG_OFFICE] / 50 &&
+              streetHits == 0 && lost == 0 && visitWrites == 0;
+
+    printf("seed %2u: %s id=%2d miss %d/%d  %s id=%2d miss %d/%d  %s->home/office %d/%d"
+           "  places %2u unreachable %d  dirty home/office %d street %d (home moved %d)  %s\n",
+           seed, LEG_NAMES[LEG_HOME], placeOf[LEG_HOME], miss[LEG_HOME], total[LEG_HOME],
+           LEG_NAMES[LEG_OFFICE], placeOf[LEG_OFFICE], miss[LEG_OFFICE], total[LEG_OFFICE],
+           LEG_NAMES[LEG_STREET], streetHits, total[LEG_STREET],
+           places.count, lost, dirty[LEG_HOME] + dirty[LEG_OFFICE], dirty[LEG_STREET],
+           homeMoves, ok ? "ok" : "FAIL");
+    return ok;
+}
+
+static void printLatency(const char *what, std::vector<double> &ns) {
+    if (ns.empty()) return;
+    std::sort(ns.begin(), ns.end());
+    double sum = 0;
+    for (double v : ns) sum += v;
+    printf("  %-13s %6zu scans  mean %6.0f ns  p99 %6.0f ns  max %6.0f ns\n", what, ns.size(),
+           sum / ns.size(), ns[ns.size() * 99 / 100], ns.back());
+}
+
+static const int MATCH_MIN_SLOTS = 6;     // wifi_places.cpp PLACE_MATCH_MIN_SLOTS
+
+// placeDbMatch() against a pass over every stored place, for scans that share
+// 0..PLACE_SIG_LEN slots with a stored place. Returns the number of disagreements.
+static int exactness(const PlaceDb &db, uint32_t &x) {
+    int wrong = 0;
+    for (int id = 0; id < PLACE_MAX; id++) {
+        if (!db.places[id].used) continue;
+        for (int keep = 0; keep <= PLACE_SIG_LEN; keep++) {
+            PlaceSignature q = db.places[id].sig;
+            for (int k = keep; k < PLACE_SIG_LEN; k++) {
+                x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+                q.slot[(k + id) % PLACE_SIG_LEN] = (uint16_t)x;
+            }
+
+            int bestId = -1, bestSim = 0;
+            for (int j = 0; j < PLACE_MAX; j++) {
+                if (!db.places[j].used) continue;
+                int sim = 0;
+                for (int k = 0; k < PLACE_SIG_LEN; k++) sim += q.slot[k] == db.places[j].sig.slot[k];
+                if (sim > bestSim) { bestSim = sim; bestId = j; }
+            }
+            int want = bestSim >= MATCH_MIN_SLOTS ? bestId : -1;
+            if (placeDbMatch(db, q) != want) wrong++;
+        }
+    }
+    return wrong;
+}
+
+// Unmatched lookups against a db holding 1..PLACE_MAX random places: the LSH
+// probe must not turn into a pass over every place as the table fills.
+static int matchScaling() {
+    static PlaceDb db;
+    placeDbInit(db);
+    uint32_t x = 12345;
+    auto randomSig = [&x] {
+        PlaceSignature sig;
+        placeSigBegin(sig);
+        for (int k = 0; k < 12; k++) {
+            uint8_t b[6];
+            for (int j = 0; j < 6; j++) { x ^= x << 13; x ^= x >> 17; x ^= x << 5; b[j] = (uint8_t)x; }
+            placeSigAdd(sig, b);
+        }
+        return sig;
+    };
+
+    printf("unmatched lookup vs. stored places\n");
+    const int QUERIES = 2000;
+    std::vector<PlaceSignature> queries;
+    for (int q = 0; q < QUERIES; q++) queries.push_back(randomSig());
+    for (int count = 1; count <= PLACE_MAX; count++) {
+        placeDbObserve(db, randomSig());
+        if (count != 1 && count != 4 && count != 8 && count != PLACE_MAX) continue;
+        double sum = 0;
+        for (const PlaceSignature &q : queries) {
+            int id;
+            sum += timeMatch(db, q, id);
+        }
+        printf("  %2u places: mean %5.0f ns\n", db.count, sum / QUERIES);
+    }
+    return exactness(db, x);
+}
+
+int main(int argc, char **argv) {
+    int days = (argc > 1) ? atoi(argv[1]) : 10;
+    if (days < 1) days = 1;
+
+    int failed = 0;
+    for (uint32_t seed = 1; seed <= 8; seed++) {
+        if (!runSeed(seed, days)) failed++;
+    }
+    printf("%d days x 8 seeds: %s\n", days, failed ? "FAIL" : "all ok");
+
+    printf("placeDbMatch per trace scan (this machine)\n");
+    printLatency("matched", matchNsHit);
+    printLatency("no match", matchNsMiss);
+    int wrong = matchScaling();
+    printf("index vs. full pass, %d stored places x 17 overlaps: %d disagreements\n", PLACE_MAX, wrong);
+    if (wrong) failed++;
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,146 @@
+// ============================================================
+// power_guard_replay — replay PMIC event scripts through the power guard
+//
+//   g++ -O2 -std=gnu++17 -I../TamaFi power_guard_replay.cpp ../TamaFi/power_guard.cpp
+//       -o power_guard_replay
+//   ./power_guard_replay
+//
+// Each scenario feeds a PmicEventScript through powerGuardStep() on a 100 ms
+// loop clock, the way processPowerEvents() does on the device, and compares
+// the SAVE / EMERGENCY / RESUME actions (and when they fire) with the
+// expected list. The USB flag follows VBUS events like the battery poll does.
+// Exit code 1 if any scenario differs.
+// ============================================================
+
+#include "power_guard.h"
+
+#include <cstdio>
+#include <vector>
+
+struct Expect {
+    unsigned long atMs;
+    PowerAction   action;
+};
+
+struct Scenario {
+    const char           *name;
+    bool                  usbAtStart;
+    const PmicScriptStep *steps;
+    size_t                stepCount;
+    const Expect         *expect;
+    size_t                expectCount;
+};
+
+static const char *ACTION_NAMES[] = { "NONE", "SAVE", "EMERGENCY", "RESUME" };
+
+// Battery drains: one early save, emergency at the critical level, a key
+// hold while already off does nothing, USB brings it back and re-arms the warning.
+static const PmicScriptStep DRAIN[] = {
+    { 1000, PMIC_EVT_LOW_WARN },
+    { 2000, PMIC_EVT_LOW_WARN },
+    { 3000, PMIC_EVT_LOW_CRIT },
+    { 4000, PMIC_EVT_PKEY_LONG },
+    { 5000, PMIC_EVT_LOW_CRIT },
+    { 6000, PMIC_EVT_VBUS_IN },
+    { 8000, PMIC_EVT_VBUS_OUT },
+    { 9000, PMIC_EVT_LOW_WARN },
+};
+static const Expect DRAIN_EXPECT[] = {
+    { 1000, PWR_ACT_SAVE },
+    { 3000, PWR_ACT_EMERGENCY },
+    { 6000, PWR_ACT_RESUME },
+    { 9000, PWR_ACT_SAVE },
+};
+
+// On USB a critical level or key hold only saves, every time.
+static const PmicScriptStep USB[] = {
+    { 1000, PMIC_EVT_LOW_CRIT },
+    { 2000, PMIC_EVT_PKEY_LONG },
+    { 3000, PMIC_EVT_LOW_WARN },
+};
+static const Expect USB_EXPECT[] = {
+    { 1000, PWR_ACT_SAVE },
+    { 2000, PWR_ACT_SAVE },
+    { 3000, PWR_ACT_SAVE },
+};
+
+// Key hold on battery -> emergency; unplugging again inside the emergency
+// changes nothing, the next plug-in resumes.
+static const PmicScriptStep KEY[] = {
+    {  500, PMIC_EVT_PKEY_LONG },
+    { 1500, PMIC_EVT_VBUS_OUT },
+    { 2500, PMIC_EVT_LOW_WARN },
+    { 3500, PMIC_EVT_VBUS_IN },
+    { 4500, PMIC_EVT_PKEY_LONG },
+};
+static const Expect KEY_EXPECT[] = {
+    {  500, PWR_ACT_EMERGENCY },
+    { 3500, PWR_ACT_RESUME },
+    { 4500, PWR_ACT_SAVE },
+};
+
+// Plug-in and critical level in the same poll: USB wins, save only.
+static const PmicScriptStep SAME_TICK[] = {
+    { 1000, PMIC_EVT_VBUS_IN | PMIC_EVT_LOW_CRIT },
+    { 2000, PMIC_EVT_VBUS_OUT },
+    { 3000, PMIC_EVT_LOW_CRIT },
+    { 3050, PMIC_EVT_VBUS_IN },
+};
+static const Expect SAME_TICK_EXPECT[] = {
+    { 1000, PWR_ACT_SAVE },
+    { 3000, PWR_ACT_EMERGENCY },
+    { 3100, PWR_ACT_RESUME },
+};
+
+#define N(a) (sizeof(a) / sizeof((a)[0]))
+
+static const Scenario SCENARIOS[] = {
+    { "drain",     false, DRAIN,     N(DRAIN),     DRAIN_EXPECT,     N(DRAIN_EXPECT) },
+    { "usb",       true,  USB,       N(USB),       USB_EXPECT,       N(USB_EXPECT) },
+    { "key-hold",  false, KEY,       N(KEY),       KEY_EXPECT,       N(KEY_EXPECT) },
+    { "same-tick", false, SAME_TICK, N(SAME_TICK), SAME_TICK_EXPECT, N(SAME_TICK_EXPECT) },
+};
+
+static bool runScenario(const Scenario &sc) {
+    PmicEventScript script(sc.steps, sc.stepCount);
+    PowerGuard      guard;
+    powerGuardInit(guard);
+
+    const unsigned long LOOP_MS = 100;
+    unsigned long end = sc.steps[sc.stepCount - 1].atMs + 1000;
+    bool usb = sc.usbAtStart;
+
+    std::vector<Expect> got;
+    for (unsigned long now = 0; now <= end; now += LOOP_MS) {
+        uint32_t    events = script.take(now);
+        PowerAction act    = powerGuardStep(guard, events, usb);
+        if (act != PWR_ACT_NONE) got.push_back({ now, act });
+
+        // Battery poll sees VBUS after the event
+        if (events & PMIC_EVT_VBUS_IN)  usb = true;
+        if (events & PMIC_EVT_VBUS_OUT) usb = false;
+    }
+
+    bool ok = got.size() == sc.expectCount;
+    for (size_t i = 0; ok && i < got.size(); i++) {
+        ok = got[i].atMs == sc.expect[i].atMs && got[i].action == sc.expect[i].action;
+    }
+
+    printf("%-10s %s\n", sc.name, ok ? "ok" : "FAIL");
+    if (!ok) {
+        for (size_t i = 0; i < sc.expectCount; i++)
+            printf("  want %5lu ms %s\n", sc.expect[i].atMs, ACTION_NAMES[sc.expect[i].action]);
+        for (size_t i = 0; i < got.size(); i++)
+            printf("  got  %5lu ms %s\n", got[i].atMs, ACTION_NAMES[got[i].action]);
+    }
+    return ok;
+}
+
+int main() {
+    int failed = 0;
+    for (size_t i = 0; i < N(SCENARIOS); i++) {
+        if (!runScenario(SCENARIOS[i])) failed++;
+    }
+    printf("%zu scenarios: %s\n", N(SCENARIOS), failed ? "FAIL" : "all ok");
+    return failed ? 1 : 0;
+}
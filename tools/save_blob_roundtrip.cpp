@@ -0,0 +1,164 @@
+// ============================================================
+// save_blob_roundtrip — CRC32 and SaveBlob seal / validate round trip
+//
+//   g++ -O2 -std=gnu++17 -I../TamaFi save_blob_roundtrip.cpp ../TamaFi/save_blob.cpp
+//       -o save_blob_roundtrip
+//   ./save_blob_roundtrip [blobs]
+//
+// Checks:
+//   - crc32Calc("123456789") == 0xCBF43926 (the standard check value)
+//   - the nibble-table CRC matches a bitwise reference on random buffers of
+//     every length up to 256 bytes, including split crc32Update() calls
+//   - `blobs` random SaveBlobs (default 100000) survive seal -> bytes ->
+//     saveBlobValid() / saveBlobUpgrade() with every field intact
+//   - every single-bit flip of a sealed image, every shorter or longer length,
+//     and a wrong version byte are rejected
+// Then it times crc32Calc over one SaveBlob on this machine.
+// Exit code 1 on any mismatch.
+// ============================================================
+
+#include "save_blob.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+static uint32_t rng = 0x2545F491;
+
+static uint32_t next() {
+    rng ^= rng << 13; rng ^= rng >> 17; rng ^= rng << 5;
+    return rng;
+}
+
+static uint32_t crcBitwise(const uint8_t *p, size_t len) {
+    uint32_t crc = 0xFFFFFFFF;
+    while (len--) {
+        crc ^= *p++;
+        for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320 & (0u - (crc & 1)));
+    }
+    return ~crc;
+}
+
+static bool checkCrc() {
+    uint32_t v = crc32Calc("123456789", 9);
+    if (v != 0xCBF43926) {
+        printf("FAIL: check value 0x%08X, want 0xCBF43926\n", v);
+        return false;
+    }
+
+    uint8_t buf[256];
+    for (size_t len = 0; len <= sizeof(buf); len++) {
+        for (int rep = 0; rep < 16; rep++) {
+            for (size_t i = 0; i < len; i++) buf[i] = (uint8_t)next();
+            uint32_t ref = crcBitwise(buf, len);
+            size_t   cut = len ? next() % (len + 1) : 0;
+            uint32_t split = crc32Update(crc32Update(0, buf, cut), buf + cut, len - cut);
+            if (crc32Calc(buf, len) != ref || split != ref) {
+                printf("FAIL: CRC mismatch at length %zu (split at %zu)\n", len, cut);
+                return false;
+            }
+        }
+    }
+    printf("crc32: check value ok, nibble table == bitwise on 0..256 bytes\n");
+    return true;
+}
+
+static void randomBlob(SaveBlob &b) {
+    memset(&b, 0, sizeof(b));
+    b.hunger             = (int16_t)(next() % 101);
+    b.happiness          = (int16_t)(next() % 101);
+    b.health             = (int16_t)(next() % 101);
+    b.ageTotalMin        = next();
+    b.stage              = (uint8_t)(next() % 4);
+    b.hatched            = (uint8_t)(next() & 1);
+    b.traitCuriosity     = (uint8_t)next();
+    b.traitActivity      = (uint8_t)next();
+    b.traitStress        = (uint8_t)next();
+    b.soundVolume        = (uint8_t)(next() % 6);
+    b.tftBrightnessIndex = (uint8_t)(next() % 3);
+    b.petSkin            = (uint8_t)(next() % 4);
+    b.wifiPassive        = (uint8_t)(next() & 1);
+    b.autoSleepMs        = next();
+    b.autoSaveSec        = (uint16_t)next();
+}
+
+static bool sameFields(const SaveBlob &a, const SaveBlob &b) {
+    // Header and CRC are rewritten by seal; compare only the payload
+    return memcmp((const uint8_t*)&a + 4, (const uint8_t*)&b + 4, sizeof(SaveBlob) - 8) == 0;
+}
+
+// Returns the number of corrupt variants that were accepted.
+static int corruptAccepted(const uint8_t *img) {
+    int bad = 0;
+    uint8_t  tmp[SAVE_IMAGE_MAX];
+    SaveBlob out;
+
+    for (size_t bit = 0; bit < sizeof(SaveBlob) * 8; bit++) {
+        memcpy(tmp, img, sizeof(SaveBlob));
+        tmp[bit / 8] ^= (uint8_t)(1u << (bit % 8));
+        memcpy(&out, tmp, sizeof(out));
+        if (saveBlobValid(out, sizeof(out))) bad++;
+        if (saveBlobUpgrade(tmp, sizeof(SaveBlob), out) != 0) bad++;
+    }
+
+    memcpy(tmp, img, sizeof(SaveBlob));
+    tmp[sizeof(SaveBlob)] = 0;
+    for (size_t len = 0; len <= sizeof(SaveBlob) + 1; len++) {
+        if (len == sizeof(SaveBlob)) continue;
+        if (saveBlobUpgrade(tmp, len, out) != 0) bad++;
+        memcpy(&out, tmp, sizeof(out));
+        if (saveBlobValid(out, len)) bad++;
+    }
+
+    // Resealed as a version that does not exist yet
+    memcpy(tmp, img, sizeof(SaveBlob));
+    saveBlobSealAs(tmp, sizeof(SaveBlob), SAVE_BLOB_VERSION + 1);
+    if (saveBlobUpgrade(tmp, sizeof(SaveBlob), out) != 0) bad++;
+    return bad;
+}
+
+int main(int argc, char **argv) {
+    long blobs = (argc > 1) ? strtol(argv[1], nullptr, 10) : 100000;
+    if (blobs <= 0) blobs = 100000;
+
+    bool ok = checkCrc();
+
+    long lost = 0, accepted = 0;
+    for (long i = 0; i < blobs; i++) {
+        SaveBlob b;
+        randomBlob(b);
+        saveBlobSeal(b);
+
+        uint8_t img[SAVE_IMAGE_MAX];
+        memcpy(img, &b, sizeof(b));
+
+        SaveBlob back, up;
+        memcpy(&back, img, sizeof(back));
+        if (!saveBlobValid(back, sizeof(back)) ||
+            saveBlobUpgrade(img, sizeof(b), up) != SAVE_BLOB_VERSION ||
+            !sameFields(b, back) || !sameFields(b, up)) {
+            lost++;
+        }
+        // Corruption sweep is the slow part; a few thousand images are plenty
+        if (i < 5000) accepted += corruptAccepted(img);
+    }
+    printf("blobs: %ld sealed, %ld failed to round-trip, %ld corrupt variants accepted\n",
+           blobs, lost, accepted);
+    if (lost || accepted) ok = false;
+
+    SaveBlob b;
+    randomBlob(b);
+    const int REPS = 2000000;
+    volatile uint32_t sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < REPS; i++) {
+        b.ageTotalMin = (uint32_t)i;
+        sink = sink + crc32Calc(&b, sizeof(b) - 4);
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+    printf("host cost: %.1f ns per %zu-byte CRC\n", ns / REPS, sizeof(b) - 4);
+
+    printf("%s\n", ok ? "ok" : "FAIL");
+    return ok ? 0 : 1;
+}
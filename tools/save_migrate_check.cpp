@@ -0,0 +1,200 @@
+// ============================================================
+// save_migrate_check — upgrade checked-in save fixtures of every version
+//
+//   g++ -O2 -std=gnu++17 -I../TamaFi save_migrate_check.cpp ../TamaFi/save_blob.cpp
+//       -o save_migrate_check
+//   ./save_migrate_check [save_fixtures]
+//
+// Fixtures (never regenerate a shipped one; add a file per new version):
+//   v0_keys.txt  per-key NVS values, key=value; absent keys take the defaults
+//                of persistence.cpp readLegacyKeys()
+//   v1.hex       33-byte SaveBlob image, hex bytes
+// Each file carries "# expect field=value ..." lines naming SaveBlob fields.
+// Every fixture goes through saveBlobUpgrade() and each expected field is
+// compared. Then every single-byte corruption and truncation of the blob
+// fixtures must be rejected. Exit code 1 on any mismatch.
+// ============================================================
+
+#include "save_blob.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+struct Fixture {
+    const char *file;
+    uint8_t     storedVersion;   // what saveBlobUpgrade() must report
+};
+
+static const Fixture FIXTURES[] = {
+    { "v0_keys.txt", 1 },        // v0 is packed as a v1 image first
+    { "v1.hex",      1 },
+};
+
+static bool readLines(const std::string &path, std::vector<std::string> &lines) {
+    FILE *f = fopen(path.c_str(), "r");
+    if (!f) return false;
+    char buf[512];
+    while (fgets(buf, sizeof(buf), f)) {
+        size_t n = strlen(buf);
+        while (n > 0 && (buf[n - 1] == '\n' || buf[n - 1] == '\r')) buf[--n] = '\0';
+        lines.push_back(buf);
+    }
+    fclose(f);
+    return true;
+}
+
+// "# expect a=1 b=2" -> pairs
+static void parseExpect(const std::string &line, std::vector<std::pair<std::string, long>> &out) {
+    const char *p = line.c_str() + strlen("# expect");
+    while (*p) {
+        while (*p == ' ') p++;
+        const char *eq = strchr(p, '=');
+        if (!eq) break;
+        std::string key(p, eq - p);
+        char *end;
+        long v = strtol(eq + 1, &end, 10);
+        out.push_back({ key, v });
+        p = end;
+    }
+}
+
+static bool fieldValue(const SaveBlob &b, const std::string &k, long &v) {
+    if      (k == "hunger")             v = b.hunger;
+    else if (k == "happiness")          v = b.happiness;
+    else if (k == "health")             v = b.health;
+    else if (k == "ageTotalMin")        v = b.ageTotalMin;
+    else if (k == "stage")              v = b.stage;
+    else if (k == "hatched")            v = b.hatched;
+    else if (k == "traitCuriosity")     v = b.traitCuriosity;
+    else if (k == "traitActivity")      v = b.traitActivity;
+    else if (k == "traitStress")        v = b.traitStress;
+    else if (k == "soundVolume")        v = b.soundVolume;
+    else if (k == "tftBrightnessIndex") v = b.tftBrightnessIndex;
+    else if (k == "petSkin")            v = b.petSkin;
+    else if (k == "wifiPassive")        v = b.wifiPassive;
+    else if (k == "autoSleepMs")        v = b.autoSleepMs;
+    else if (k == "autoSaveSec")        v = b.autoSaveSec;
+    else return false;
+    return true;
+}
+
+// v0 key=value lines -> sealed v1 image, same defaults as readLegacyKeys().
+static size_t packKeys(const std::vector<std::string> &lines, uint8_t *img) {
+    SaveLegacyKeys k = { 70, 70, 70, 0, 0, 0, 0, false, 3, 1, 0, 0, 70, 60, 40, 60000, 30 };
+    for (const std::string &l : lines) {
+        if (l.empty() || l[0] == '#') continue;
+        size_t eq = l.find('=');
+        if (eq == std::string::npos) continue;
+        std::string key = l.substr(0, eq);
+        long v = strtol(l.c_str() + eq + 1, nullptr, 10);
+        if      (key == "hunger")  k.hunger  = (int32_t)v;
+        else if (key == "happy")   k.happy   = (int32_t)v;
+        else if (key == "health")  k.health  = (int32_t)v;
+        else if (key == "ageMin")  k.ageMin  = (uint32_t)v;
+        else if (key == "ageHr")   k.ageHr   = (uint32_t)v;
+        else if (key == "ageDay")  k.ageDay  = (uint32_t)v;
+        else if (key == "stage")   k.stage   = (uint8_t)v;
+        else if (key == "hatched") k.hatched = v != 0;
+        else if (key == "sndVol")  k.sndVol  = (uint8_t)v;
+        else if (key == "tftBri")  k.tftBri  = (uint8_t)v;
+        else if (key == "petSkin") k.petSkin = (uint8_t)v;
+        else if (key == "passive") k.passive = (uint8_t)v;
+        else if (key == "tCur")    k.tCur    = (uint8_t)v;
+        else if (key == "tAct")    k.tAct    = (uint8_t)v;
+        else if (key == "tStr")    k.tStr    = (uint8_t)v;
+        else if (key == "sleepMs") k.sleepMs = (uint32_t)v;
+        else if (key == "saveMs")  k.saveMs  = (uint16_t)v;
+        else printf("  unknown key %s\n", key.c_str());
+    }
+    return saveBlobFromLegacy(k, img);
+}
+
+static size_t parseHex(const std::vector<std::string> &lines, uint8_t *img, size_t cap) {
+    size_t n = 0;
+    for (const std::string &l : lines) {
+        if (l.empty() || l[0] == '#') continue;
+        const char *p = l.c_str();
+        char *end;
+        for (;;) {
+            long v = strtol(p, &end, 16);
+            if (end == p) break;
+            if (n < cap) img[n] = (uint8_t)v;
+            n++;
+            p = end;
+        }
+    }
+    return n <= cap ? n : 0;
+}
+
+// Every flipped byte and every shorter length must be refused.
+static int corruptionsAccepted(const uint8_t *img, size_t len) {
+    int bad = 0;
+    uint8_t tmp[SAVE_IMAGE_MAX];
+    SaveBlob out;
+    for (size_t i = 0; i < len; i++) {
+        memcpy(tmp, img, len);
+        tmp[i] ^= 0x5A;
+        if (saveBlobUpgrade(tmp, len, out) != 0) bad++;
+    }
+    for (size_t n = 0; n < len; n++) {
+        if (saveBlobUpgrade(img, n, out) != 0) bad++;
+    }
+    return bad;
+}
+
+static bool checkFixture(const std::string &dir, const Fixture &fx) {
+    std::vector<std::string> lines;
+    if (!readLines(dir + "/" + fx.file, lines)) {
+        printf("%-12s FAIL: cannot read\n", fx.file);
+        return false;
+    }
+
+    bool    isKeys = strstr(fx.file, ".txt") != nullptr;
+    uint8_t img[SAVE_IMAGE_MAX];
+    size_t  len = isKeys ? packKeys(lines, img) : parseHex(lines, img, sizeof(img));
+
+    SaveBlob b;
+    uint8_t  from = saveBlobUpgrade(img, len, b);
+    if (from != fx.storedVersion) {
+        printf("%-12s FAIL: upgrade returned version %u, want %u (%zu bytes)\n",
+               fx.file, from, fx.storedVersion, len);
+        return false;
+    }
+
+    std::vector<std::pair<std::string, long>> expect;
+    for (const std::string &l : lines) {
+        if (l.rfind("# expect", 0) == 0) parseExpect(l, expect);
+    }
+
+    int wrong = 0;
+    for (const auto &e : expect) {
+        long got;
+        if (!fieldValue(b, e.first, got)) {
+            printf("  %s: unknown field %s\n", fx.file, e.first.c_str());
+            wrong++;
+        } else if (got != e.second) {
+            printf("  %s: %s = %ld, want %ld\n", fx.file, e.first.c_str(), got, e.second);
+            wrong++;
+        }
+    }
+
+    int accepted = isKeys ? 0 : corruptionsAccepted(img, len);
+    bool ok = wrong == 0 && accepted == 0 && !expect.empty();
+    printf("%-12s %2zu bytes  v%u -> v%u  %zu fields  corrupt accepted %d  %s\n",
+           fx.file, len, from, SAVE_BLOB_VERSION, expect.size(), accepted, ok ? "ok" : "FAIL");
+    return ok;
+}
+
+int main(int argc, char **argv) {
+    std::string dir = (argc > 1) ? argv[1] : "save_fixtures";
+
+    int failed = 0;
+    for (const Fixture &fx : FIXTURES) {
+        if (!checkFixture(dir, fx)) failed++;
+    }
+    printf("%s\n", failed ? "FAIL" : "all fixtures upgrade to the current layout");
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+"""Write placeholder source WAVs for the sampled effects (tools/sfx/*.wav).
+
+Stand-ins until designer recordings exist; drop real WAVs with the same
+names into tools/sfx/ and re-run adpcm_encode.py instead.
+
+    python3 tools/sfx_synth.py tools/sfx
+"""
+
+import math
+import os
+import random
+import struct
+import sys
+import wave
+
+RATE = 44100          # like a typical designer export; the encoder resamples
+
+
+def write(path, x):
+    with wave.open(path, "wb") as w:
+        w.setnchannels(1)
+        w.setsampwidth(2)
+        w.setframerate(RATE)
+        w.writeframes(b"".join(struct.pack("<h", int(max(-1, min(1, v)) * 32767)) for v in x))
+
+
+def chirp():
+    """Two rising bird-like chirps."""
+    out = []
+    for start, length in ((0.0, 0.09), (0.13, 0.12)):
+        n0, n = int(start * RATE), int(length * RATE)
+        out += [0.0] * (n0 - len(out))
+        ph = 0.0
+        for i in range(n):
+            t = i / n
+            f = 1800 + 2600 * t * t
+            ph += 2 * math.pi * f / RATE
+            env = math.sin(math.pi * t) ** 2
+            out.append(env * (math.sin(ph) + 0.25 * math.sin(2 * ph)))
+    return out
+
+
+def growl():
+    """Low rough growl: saw at 70-90 Hz, amplitude jitter, a little noise."""
+    rnd = random.Random(7)
+    n = int(0.55 * RATE)
+    out, ph, jit = [], 0.0, 1.0
+    for i in range(n):
+        t = i / n
+        f = 90 - 20 * t + 6 * math.sin(2 * math.pi * 23 * i / RATE)
+        ph = (ph + f / RATE) % 1.0
+        if i % 220 == 0:
+            jit = 0.6 + 0.4 * rnd.random()
+        env = min(1.0, t * 12) * (1 - t) ** 0.7
+        out.append(env * jit * (0.8 * (2 * ph - 1) + 0.2 * (rnd.random() * 2 - 1)))
+    return out
+
+
+def crack():
+    """Eggshell crack: a few sharp noise bursts with a resonant knock."""
+    rnd = random.Random(11)
+    n = int(0.45 * RATE)
+    out = [0.0] * n
+    for at, amp in ((0.0, 1.0), (0.07, 0.6), (0.16, 0.8), (0.21, 0.4)):
+        k0 = int(at * RATE)
+        lp = 0.0
+        for i in range(int(0.06 * RATE)):
+            if k0 + i >= n:
+                break
+            env = amp * math.exp(-i / (0.008 * RATE))
+            lp += 0.45 * ((rnd.random() * 2 - 1) - lp)
+            knock = math.sin(2 * math.pi * 620 * i / RATE) * math.exp(-i / (0.02 * RATE))
+            out[k0 + i] += env * lp * 1.6 + 0.35 * amp * knock
+    return out
+
+
+def main():
+    outdir = sys.argv[1] if len(sys.argv) > 1 else "tools/sfx"
+    os.makedirs(outdir, exist_ok=True)
+    for name, gen in (("chirp", chirp), ("growl", growl), ("crack", crack)):
+        path = os.path.join(outdir, name + ".wav")
+        write(path, gen())
+        print("wrote", path)
+
+
+if __name__ == "__main__":
+    main()
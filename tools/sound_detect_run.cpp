@@ -0,0 +1,100 @@
+// ============================================================
+// sound_detect_run — run the microphone detector over WAV fixtures
+//
+//   g++ -O2 -std=gnu++17 -I../TamaFi sound_detect_run.cpp ../TamaFi/sound_detect.cpp
+//       -o sound_detect_run
+//   python3 mic_fixtures.py /tmp/mic && ./sound_detect_run /tmp/mic/*.wav
+//
+// Input: 16-bit PCM WAV at 16 kHz, mono or stereo (averaged). Prints every
+// event with its time, the per-kind counts and detector CPU time per second
+// of audio. Exit code 1 if a file named *_xN.wav does not give N events.
+// ============================================================
+
+#include "sound_detect.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+static bool readWav(const char *path, std::vector<int16_t> &out) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return false;
+    std::vector<uint8_t> b;
+    uint8_t buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) b.insert(b.end(), buf, buf + n);
+    fclose(f);
+    if (b.size() < 12 || memcmp(&b[0], "RIFF", 4) || memcmp(&b[8], "WAVE", 4)) return false;
+
+    auto u16 = [&](size_t o) { return (uint32_t)(b[o] | b[o + 1] << 8); };
+    auto u32 = [&](size_t o) { return u16(o) | u16(o + 2) << 16; };
+    uint32_t channels = 0, rate = 0, bits = 0;
+    for (size_t o = 12; o + 8 <= b.size();) {
+        uint32_t len = u32(o + 4);
+        if (!memcmp(&b[o], "fmt ", 4)) {
+            channels = u16(o + 10);
+            rate     = u32(o + 12);
+            bits     = u16(o + 22);
+        } else if (!memcmp(&b[o], "data", 4)) {
+            if (bits != 16 || rate != DETECT_RATE || channels < 1 || channels > 2) {
+                fprintf(stderr, "%s: need 16-bit %d Hz mono/stereo\n", path, DETECT_RATE);
+                return false;
+            }
+            size_t frames = (len < b.size() - o - 8 ? len : b.size() - o - 8) / (2 * channels);
+            for (size_t i = 0; i < frames; i++) {
+                int32_t s = 0;
+                for (uint32_t c = 0; c < channels; c++) s += (int16_t)u16(o + 8 + (i * channels + c) * 2);
+                out.push_back((int16_t)(s / (int32_t)channels));
+            }
+            return true;
+        }
+        o += 8 + len + (len & 1);
+    }
+    return false;
+}
+
+int main(int argc, char **argv) {
+    int    failed = 0;
+    double allUs = 0, allSec = 0;
+
+    for (int a = 1; a < argc; a++) {
+        std::vector<int16_t> pcm;
+        if (!readWav(argv[a], pcm)) { fprintf(stderr, "%s: unreadable\n", argv[a]); failed++; continue; }
+
+        SoundDetector d;
+        detectInit(d);
+        int counts[3] = {};
+        std::string log;
+
+        auto t0 = std::chrono::steady_clock::now();
+        for (size_t pos = 0; pos + DETECT_FRAME <= pcm.size(); pos += DETECT_FRAME) {
+            uint8_t evt = detectFrame(d, &pcm[pos]);
+            for (int k = 0; k < 3; k++) {
+                if (!(evt & (1 << k))) continue;
+                counts[k]++;
+                char line[64];
+                snprintf(line, sizeof(line), "  %6.2f s  %-7s (rms %u, tonal %u)\n",
+                         (double)pos / DETECT_RATE, detectEventName(1 << k), d.rms, d.tonal);
+                log += line;
+            }
+        }
+        double us  = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+        double sec = (double)pcm.size() / DETECT_RATE;
+        allUs += us;
+        allSec += sec;
+
+        int total = counts[0] + counts[1] + counts[2];
+        const char *x = strstr(argv[a], "_x");
+        int expect = x ? atoi(x + 2) : -1;
+        bool ok = expect < 0 || expect == total;
+        if (!ok) failed++;
+
+        printf("%s: clap %d whistle %d loud %d, floor rms %u, %.1f us/s%s\n%s", argv[a], counts[0], counts[1],
+               counts[2], detectFloorRms(d), us / sec, ok ? "" : "  <-- MISMATCH", log.c_str());
+    }
+    if (allSec > 0) printf("detector: %.1f us CPU per second of audio\n", allUs / allSec);
+    return failed ? 1 : 0;
+}
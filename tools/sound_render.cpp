@@ -0,0 +1,211 @@
+// ============================================================
+// sound_render — render every TamaFi sound effect on the host and check it
+//
+//   g++ -O2 -std=gnu++17 -I../TamaFi sound_render.cpp ../TamaFi/sound.cpp
+//       ../TamaFi/sound_offline.cpp ../TamaFi/audio_engine.cpp
+//       ../TamaFi/mixer.cpp ../TamaFi/synth.cpp ../TamaFi/tracker.cpp
+//       ../TamaFi/music.cpp ../TamaFi/adpcm.cpp ../TamaFi/sfx.cpp -o sound_render
+//   ./sound_render [outdir]
+//
+// Drives the real snd*() layer (sound.cpp) into SoundOutputOffline, i.e. the
+// same AudioEngine the ES8311 render task runs, and writes <effect>.wav
+// (16 kHz mono). Per effect it checks:
+//   - duration: audible length matches the tone table / clip length
+//   - peak:     within the volume amplitude, never at full scale
+//   - clicks:   edges start/end near zero; tone effects never step faster
+//               than a sine at the highest table frequency plus the fade ramp
+// Then benchmarks the synthesis path (4 voices + music) in samples/s.
+// Exit status 1 if any check fails. The PWM buzzer path is not rendered.
+// ============================================================
+
+#include "sound.h"
+#include "sound_offline.h"
+#include "sfx.h"
+#include "synth.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+uint8_t soundVolume = 3;   // navigation.cpp on device
+
+static const int     BLOCK   = MIX_BLOCK_MAX;
+static const int     LEVEL   = 3;            // soundSetVolume() level under test
+static const int16_t AMP     = 8000;         // its tone amplitude
+static const int     QUIET   = 64;           // |sample| below this counts as silence
+static const int     EDGE    = AMP / 8;      // first / last audible sample bound
+
+struct Effect {
+    const char *name;
+    void (*play)();
+    int  tableMs;      // tone table length, ms (0 = clip only)
+    int  clip;         // SfxId, -1 = tones only
+    int  maxHz;        // highest table frequency (slope bound), 0 = skip slope check
+};
+
+static const Effect EFFECTS[] = {
+    { "click",      sndClick,     60,  -1,        2100 },
+    { "good_feed",  sndGoodFeed,  180, -1,        1500 },
+    { "bad_feed",   sndBadFeed,   0,   SFX_GROWL, 0    },
+    { "discover",   sndDiscover,  220, -1,        1500 },
+    { "rest_start", sndRestStart, 220, -1,        600  },
+    { "rest_end",   sndRestEnd,   200, -1,        700  },
+    { "hatch",      sndHatch,     340, SFX_CRACK, 0    },
+    { "evolve",     sndEvolve,    0,   SFX_CHIRP, 0    },
+    { "beep",       sndBeep,      100, -1,        800  },
+    { "beep_ok",    sndBeepOk,    100, -1,        1000 },
+};
+
+struct Metrics {
+    size_t rendered;   // samples until the engine went idle
+    size_t first;      // first audible sample
+    size_t last;       // one past the last audible sample
+    int    peak;
+    int    maxStep;    // largest |x[n] - x[n-1]|
+    int    edgeIn;     // |first audible sample|
+    int    edgeOut;    // |last audible sample|
+};
+
+static Metrics measure(const std::vector<int16_t> &pcm) {
+    Metrics m = { pcm.size(), pcm.size(), 0, 0, 0, 0, 0 };
+    int prev = 0;
+    for (size_t i = 0; i < pcm.size(); i++) {
+        int s = pcm[i];
+        int a = std::abs(s);
+        if (a > m.peak) m.peak = a;
+        if (std::abs(s - prev) > m.maxStep) m.maxStep = std::abs(s - prev);
+        if (a >= QUIET) {
+            if (m.first == pcm.size()) m.first = i;
+            m.last = i + 1;
+        }
+        prev = s;
+    }
+    if (m.last > 0) {
+        m.edgeIn  = std::abs(pcm[m.first]);
+        m.edgeOut = std::abs(pcm[m.last - 1]);
+    } else {
+        m.first = 0;
+    }
+    return m;
+}
+
+static int failures = 0;
+
+static void check(bool ok, const char *name, const char *what) {
+    if (ok) return;
+    printf("  FAIL %s: %s\n", name, what);
+    failures++;
+}
+
+static void runEffect(SoundOutputOffline &out, const Effect &e, const std::string &dir) {
+    out.clear();
+    e.play();
+    out.renderUntilIdle(out.rate() * 10);
+    const std::vector<int16_t> &pcm = out.pcm();
+    Metrics m = measure(pcm);
+
+    size_t tones  = (size_t)e.tableMs * out.rate() / 1000;
+    size_t expect = tones;
+    if (e.clip >= 0) {
+        size_t clip = sfxClip((uint8_t)e.clip)->samples;
+        if (clip > expect) expect = clip;
+    }
+    // Tones fade over SYNTH_FADE_MAX at each end (under QUIET for a few
+    // samples); clips may decay into silence well before their last sample
+    size_t minAudible = tones > 0 ? tones - 2 * SYNTH_FADE_MAX : expect / 2;
+    double audibleMs = (double)(m.last - m.first) * 1000.0 / out.rate();
+    printf("%-11s %7.1f ms (expect %6.1f)  peak %5d  step %5d  edges %4d/%4d\n",
+           e.name, audibleMs, expect * 1000.0 / out.rate(), m.peak, m.maxStep, m.edgeIn, m.edgeOut);
+
+    // Engine renders whole blocks: idle within one block after the sound ends
+    check(m.rendered >= expect && m.rendered <= expect + BLOCK, e.name, "rendered length");
+    check(m.last - m.first >= minAudible && m.last - m.first <= expect, e.name, "audible length");
+    check(m.peak > AMP / 4, e.name, "too quiet");
+    check(m.peak <= (e.clip >= 0 && e.tableMs > 0 ? 2 * AMP : AMP), e.name, "peak above amplitude");
+    check(m.peak < 32767, e.name, "clipped");
+    check(m.edgeIn <= EDGE && m.edgeOut <= EDGE, e.name, "hard start / end");
+    if (e.maxHz > 0) {
+        // Sine slope at the top frequency plus the envelope ramp, 10 % margin
+        double bound = AMP * (2.0 * M_PI * e.maxHz / out.rate() + 1.0 / SYNTH_FADE_MAX) * 1.1;
+        check(m.maxStep <= bound, e.name, "discontinuity");
+    }
+
+    std::string path = dir + "/" + e.name + ".wav";
+    if (!out.writeWav(path.c_str())) check(false, e.name, "cannot write wav");
+}
+
+static void runMusic(SoundOutputOffline &out, const std::string &dir) {
+    for (uint8_t t = MUSIC_NONE + 1; t < MUSIC_THEMES; t++) {
+        out.clear();
+        sndMusic(t, 100);
+        out.render(out.rate() * 4);
+        sndMusic(MUSIC_NONE, 100);
+        Metrics m = measure(out.pcm());
+        printf("music %-5s peak %5d  step %5d\n", musicThemeName(t), m.peak, m.maxStep);
+        check(m.peak > 0 && m.peak <= AMP / AUDIO_MUSIC_AMP_DIV * TRK_MAX_CH, musicThemeName(t), "music peak");
+        std::string path = dir + "/music_" + musicThemeName(t) + ".wav";
+        if (!out.writeWav(path.c_str())) check(false, musicThemeName(t), "cannot write wav");
+    }
+}
+
+static void runMuted(SoundOutputOffline &out) {
+    soundVolume = 0;
+    soundSetVolume(0);
+    out.clear();
+    for (const Effect &e : EFFECTS) e.play();
+    out.render(out.rate());
+    Metrics m = measure(out.pcm());
+    printf("muted       peak %d\n", m.peak);
+    check(m.peak == 0, "muted", "sound at volume 0");
+    soundVolume = LEVEL;
+    soundSetVolume(LEVEL);
+}
+
+// Synthesis path at full load: every voice busy plus music, as fast as possible.
+static void bench() {
+    const uint32_t rate    = SOUND_OFFLINE_RATE;
+    const size_t   seconds = 60;
+    AudioEngine e;
+    audioEngineInit(e, rate, AMP);
+    size_t len = 0;
+    const uint8_t *song = musicSong(MUSIC_BRIGHT, &len);
+    audioEngineApply(e, audioMsgMusic(song, len, 100));
+
+    alignas(16) int16_t block[MIX_BLOCK_MAX];
+    int peak = 0;                // also keeps the render from being optimised out
+    size_t total = (size_t)rate * seconds;
+    auto t0 = std::chrono::steady_clock::now();
+    for (size_t done = 0; done < total; done += BLOCK) {
+        if (mixerActiveVoices(e.mix) < MIX_VOICES) {
+            // Refill: long tones so every block mixes MIX_VOICES voices
+            audioEngineApply(e, audioMsgTone(440 + (int)(done / BLOCK % 8) * 110, 500, MIX_PRIO_EVENT));
+        }
+        audioEngineRender(e, block, BLOCK);
+        for (int i = 0; i < BLOCK; i += 16) peak = std::max(peak, std::abs((int)block[i]));
+    }
+    double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    printf("bench: %d voices + music, %zu s audio in %.3f s: %.2f Msamples/s, %.0fx realtime, peak %d\n",
+           MIX_VOICES, seconds, sec, total / sec / 1e6, seconds / sec, peak);
+}
+
+int main(int argc, char **argv) {
+    std::string dir = argc > 1 ? argv[1] : ".";
+
+    SoundOutputOffline out;
+    soundSetOutput(&out);
+    soundInit();
+    soundVolume = LEVEL;
+    soundSetVolume(LEVEL);
+    check(out.hwVolume() == 100, "volume", "hw volume for level 3");
+
+    for (const Effect &e : EFFECTS) runEffect(out, e, dir);
+    runMusic(out, dir);
+    runMuted(out);
+    bench();
+
+    printf(failures ? "%d check(s) FAILED\n" : "all checks passed\n", failures);
+    return failures ? 1 : 0;
+}
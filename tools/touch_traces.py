@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+"""Write touch traces for the gesture recogniser (gesture.h).
+
+    python3 tools/touch_traces.py /tmp/touch
+    ./gesture_replay /tmp/touch/*.csv
+
+Same line format the device prints with INPUT_TOUCH_TRACE on
+(touch,<ms>,<x>,<y>,<down>), so serial captures replay unchanged. One
+sample per loop() poll (~16 ms with jitter), 2-3 px sensor noise, lift
+reported TOUCH_RELEASE_MS after the last sample. The expected gestures are
+in the "# expect:" line. Add real captures the same way.
+"""
+
+import os
+import random
+import sys
+
+rnd = random.Random(7)
+POLL_MS = 16
+RELEASE_MS = 20
+
+
+class Trace:
+    def __init__(self):
+        self.t = 1000
+        self.lines = []
+
+    def wait(self, ms):
+        self.t += ms
+
+    def stroke(self, x0, y0, x1, y1, ms, noise=2):
+        """Finger down at (x0, y0), moves linearly to (x1, y1) over ms, lifts."""
+        t = 0
+        while True:
+            k = min(t / ms, 1.0) if ms else 1.0
+            x = round(x0 + (x1 - x0) * k + rnd.uniform(-noise, noise))
+            y = round(y0 + (y1 - y0) * k + rnd.uniform(-noise, noise))
+            self.lines.append("touch,%d,%d,%d,1" % (self.t + t, x, y))
+            if t >= ms:
+                break
+            t += POLL_MS + rnd.randint(-3, 3)
+            t = min(t, ms)
+        self.t += t + RELEASE_MS
+        self.lines.append("touch,%d,0,0,0" % self.t)
+
+    def tap(self, x, y, ms=60):
+        self.stroke(x, y, x, y, ms)
+
+
+def write(dirname, name, expect, trace):
+    with open(os.path.join(dirname, name + ".csv"), "w") as f:
+        f.write("# expect: %s\n" % " ".join(expect))
+        f.write("\n".join(trace.lines) + "\n")
+
+
+def main():
+    out = sys.argv[1] if len(sys.argv) > 1 else "."
+    os.makedirs(out, exist_ok=True)
+
+    t = Trace(); t.tap(180, 180)
+    write(out, "tap", ["tap"], t)
+
+    t = Trace(); t.tap(180, 180); t.wait(120); t.tap(184, 176)
+    write(out, "double_tap", ["double_tap"], t)
+
+    t = Trace(); t.tap(180, 180); t.wait(110); t.tap(176, 186); t.wait(100); t.tap(183, 178)
+    write(out, "triple_tap", ["triple_tap"], t)
+
+    t = Trace(); t.stroke(150, 200, 152, 198, 900, noise=3)
+    write(out, "long_press", ["long_press"], t)
+
+    for name, (x0, y0, x1, y1) in {
+        "left":  (300, 180, 80, 190),
+        "right": (60, 180, 290, 170),
+        "up":    (180, 320, 170, 60),
+        "down":  (180, 40, 190, 300),
+    }.items():
+        t = Trace(); t.stroke(x0, y0, x1, y1, 150)
+        write(out, "swipe_" + name, ["swipe:" + name], t)
+
+    # Slow vertical drag: 200 px in 1.2 s -> 4 detents of 48 px
+    t = Trace(); t.stroke(180, 300, 180, 100, 1200)
+    write(out, "drag_up", ["drag:up"] * 4 + ["drag_end:up"], t)
+
+    t = Trace(); t.tap(100, 100); t.wait(80); t.stroke(60, 200, 300, 200, 140)
+    write(out, "tap_then_swipe", ["tap", "swipe:right"], t)
+
+    t = Trace(); t.tap(60, 60); t.wait(120); t.tap(300, 300)
+    write(out, "taps_far_apart", ["tap", "tap"], t)
+
+    t = Trace(); t.tap(180, 180, ms=400)
+    write(out, "slow_tap", [], t)
+
+    t = Trace(); t.tap(180, 420); t.wait(100); t.tap(180, 420)
+    write(out, "strip_taps", [], t)
+
+    # Ten quick taps, 120 ms apart: three triples and a trailing single
+    t = Trace()
+    for _ in range(10):
+        t.tap(180, 180, ms=40); t.wait(60)
+    write(out, "tap_burst", ["triple_tap"] * 3 + ["tap"], t)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,72 @@
+// ============================================================
+// tracker_render — render TamaFi ambient songs to WAV on the host
+//
+//   g++ -O2 -std=gnu++17 -I../TamaFi tracker_render.cpp ../TamaFi/tracker.cpp
+//       ../TamaFi/synth.cpp ../TamaFi/music.cpp -o tracker_render
+//   ./tracker_render [seconds] [tempoPct]
+//
+// Writes music_<theme>.wav (16 kHz mono, same renderer and block size as the
+// audio task) and prints render time per second of audio.
+// ============================================================
+
+#include "tracker.h"
+#include "music.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+static const uint32_t RATE  = 16000;     // I2S_SAMPLE_RATE
+static const int      BLOCK = 128;       // RENDER_BLOCK
+static const int16_t  AMP   = 5000 / 4;  // volume 2, ambient level (MUSIC_AMP_DIV)
+
+static void put16(FILE *f, uint16_t v) { fputc(v & 0xFF, f); fputc(v >> 8, f); }
+static void put32(FILE *f, uint32_t v) { put16(f, v & 0xFFFF); put16(f, v >> 16); }
+
+static bool writeWav(const char *path, const std::vector<int16_t> &pcm) {
+    FILE *f = fopen(path, "wb");
+    if (!f) return false;
+    uint32_t bytes = (uint32_t)pcm.size() * 2;
+    fwrite("RIFF", 1, 4, f); put32(f, 36 + bytes); fwrite("WAVE", 1, 4, f);
+    fwrite("fmt ", 1, 4, f); put32(f, 16); put16(f, 1); put16(f, 1);
+    put32(f, RATE); put32(f, RATE * 2); put16(f, 2); put16(f, 16);
+    fwrite("data", 1, 4, f); put32(f, bytes);
+    for (int16_t s : pcm) put16(f, (uint16_t)s);
+    fclose(f);
+    return true;
+}
+
+int main(int argc, char **argv) {
+    int      seconds  = argc > 1 ? atoi(argv[1]) : 30;
+    uint16_t tempoPct = argc > 2 ? (uint16_t)atoi(argv[2]) : 100;
+    if (seconds <= 0) seconds = 30;
+
+    for (uint8_t theme = MUSIC_NONE + 1; theme < MUSIC_THEMES; theme++) {
+        size_t         len  = 0;
+        const uint8_t *blob = musicSong(theme, &len);
+        Tracker        t;
+        if (!trackerPlay(t, blob, len, RATE, tempoPct)) {
+            printf("%-7s: bad blob\n", musicThemeName(theme));
+            return 1;
+        }
+
+        std::vector<int16_t> pcm((size_t)seconds * RATE);
+        auto t0 = std::chrono::steady_clock::now();
+        for (size_t pos = 0; pos < pcm.size(); pos += BLOCK) {
+            int n = (int)(pcm.size() - pos < (size_t)BLOCK ? pcm.size() - pos : BLOCK);
+            trackerRender(t, &pcm[pos], n, AMP);
+        }
+        double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+
+        int peak = 0;
+        for (int16_t s : pcm) peak = abs(s) > peak ? abs(s) : peak;
+
+        char path[64];
+        snprintf(path, sizeof(path), "music_%s.wav", musicThemeName(theme));
+        writeWav(path, pcm);
+        printf("%-7s: %zu byte blob, %d s, peak %d, %.1f us CPU per second of audio -> %s\n",
+               musicThemeName(theme), len, seconds, peak, us / seconds, path);
+    }
+    return 0;
+}
@@ -0,0 +1,130 @@
+// ============================================================
+// wifi_trace_run — run a JSON-lines scan trace through the scan ingestion
+//
+//   g++ -O2 -std=gnu++17 -I../TamaFi wifi_trace_run.cpp ../TamaFi/wifi_ingest.cpp
+//       ../TamaFi/wifi_env.cpp ../TamaFi/wifi_places.cpp ../TamaFi/wifi_scan_source.cpp
+//       -o wifi_trace_run
+//   ./wifi_trace_run --synth commute 120 > /tmp/commute.jsonl
+//   ./wifi_trace_run /tmp/commute.jsonl
+//
+// Replays a trace recorded by WifiScanEsp (WIFI_RECORD_TRACES) or written by
+// --synth through WifiScanReplay + wifiIngestScan, the code wifi_service runs
+// on the device. Prints one line per scan (stats, place match, smoothed
+// environment) and the learned places. Exit code 1 if the trace cannot be
+// read or holds no valid scan.
+// ============================================================
+
+#include "wifi_ingest.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+static const char *KIND_NAMES[] = { "unknown", "new", "known", "home" };
+
+static bool readFile(const char *path, std::string &out) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return false;
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.append(buf, n);
+    fclose(f);
+    return true;
+}
+
+// Write n synthetic scans in the recorder's trace format.
+static int writeSynth(const char *name, int n) {
+    WifiSynthScenario sc;
+    if      (!strcmp(name, "city"))    sc = SYNTH_DENSE_CITY;
+    else if (!strcmp(name, "field"))   sc = SYNTH_EMPTY_FIELD;
+    else if (!strcmp(name, "commute")) sc = SYNTH_COMMUTE;
+    else {
+        fprintf(stderr, "unknown scenario '%s' (city, field, commute)\n", name);
+        return 1;
+    }
+
+    const unsigned long SCAN_MS = 2000, PERIOD_MS = 30000;
+    WifiScanSynth synth(sc, 1, SCAN_MS);
+    unsigned long t = 0;
+    for (int s = 0; s < n; s++, t += PERIOD_MS) {
+        synth.start(t);
+        int count = synth.poll(t + SCAN_MS);
+        printf("{\"t\":%lu,\"d\":%lu,\"aps\":[", t + SCAN_MS, SCAN_MS);
+        char ap[128];
+        bool first = true;
+        for (int i = 0; i < count; i++) {
+            WifiScanRecord rec;
+            if (!synth.get(i, rec)) continue;
+            size_t len = wifiTraceFormatAp(ap, sizeof(ap), rec);
+            if (len == 0) continue;
+            printf("%s%.*s", first ? "" : ",", (int)len, ap);
+            first = false;
+        }
+        printf("]}\n");
+        synth.release();
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc == 4 && !strcmp(argv[1], "--synth")) return writeSynth(argv[2], atoi(argv[3]));
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s trace.jsonl | --synth city|field|commute N\n", argv[0]);
+        return 1;
+    }
+
+    std::string text;
+    if (!readFile(argv[1], text)) {
+        fprintf(stderr, "%s: cannot read\n", argv[1]);
+        return 1;
+    }
+
+    WifiTraceMemoryReader reader(text.data(), text.size());
+    WifiScanReplay        replay(reader, false);
+
+    static WifiEnvModel env;
+    static PlaceDb      places;
+    WifiStats       stats;
+    PlaceMatch      place = { PLACE_UNKNOWN, -1, 0 };
+    WifiNetworkInfo list[MAX_WIFI_LIST];
+    int             listCount = 0;
+    wifiEnvInit(env);
+    placeDbInit(places);
+    WifiScanSink sink = { env, places, stats, place, list, listCount };
+
+    // Same start / poll / ingest / release cycle as wifiStartScan + wifiCheckScanDone,
+    // on a 50 ms loop clock so recorded scan durations are honoured.
+    const unsigned long LOOP_MS = 50;
+    unsigned long now = 0;
+    int scans = 0;
+    while (replay.start(now)) {
+        int n;
+        while ((n = replay.poll(now)) == WIFI_SCAN_SRC_RUNNING) now += LOOP_MS;
+        if (n < 0) break;
+
+        wifiIngestScan(replay, n, sink);
+        replay.release();
+
+        const WifiEnvSmoothed &e = env.smooth;
+        printf("#%-4d t=%7lus n=%2d strong=%2d hidden=%d open=%d avg=%4d  place=%-7s id=%2d sim=%2u"
+               "  env nets=%5.1f rssi=%6.1f +%u/-%u\n",
+               scans, now / 1000, stats.netCount, stats.strongCount, stats.hiddenCount,
+               stats.openCount, stats.avgRSSI, KIND_NAMES[place.kind], place.id,
+               place.similarity, e.netCount, e.avgRSSI, e.approaching, e.leaving);
+        scans++;
+    }
+
+    if (scans == 0) {
+        fprintf(stderr, "%s: no valid scans\n", argv[1]);
+        return 1;
+    }
+
+    printf("\n%d scans, %u places, home=%d\n", scans, places.count, placeDbHome(places));
+    for (int i = 0; i < PLACE_MAX; i++) {
+        if (!places.places[i].used) continue;
+        printf("  place %2d: %3u scans, %2u nets\n",
+               i, places.places[i].scans, places.places[i].sig.nets);
+    }
+    return 0;
+}